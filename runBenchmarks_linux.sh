@@ -0,0 +1,5 @@
+mkdir -p build
+cd build
+cmake .. -DCMAKE_BUILD_TYPE=RELEASE
+make chimarrao-benchmarks
+./bin/chimarrao-benchmarks --benchmark_out=benchmarks-$(git rev-parse --short HEAD).json --benchmark_out_format=json
@@ -0,0 +1,76 @@
+#include "AnimationClip.h"
+
+#include "exceptions/TexturesNotInitialized.h"
+
+namespace animations
+{
+
+AnimationClip::AnimationClip(std::vector<graphics::TexturePath> consecutiveTexturePathsInit,
+                             std::vector<graphics::TextureHandle> consecutiveTextureHandlesInit,
+                             float timeBetweenTexturesInit)
+    : consecutiveTexturePaths{std::move(consecutiveTexturePathsInit)},
+      consecutiveTextureHandles{std::move(consecutiveTextureHandlesInit)},
+      timeBetweenTextures{timeBetweenTexturesInit}
+{
+    if (consecutiveTexturePaths.empty() || consecutiveTextureHandles.size() != consecutiveTexturePaths.size())
+    {
+        throw exceptions::TexturesNotInitialized{"Textures not initialized"};
+    }
+}
+
+AnimationClip::AnimationClip(graphics::TexturePath spriteSheetTexturePath,
+                             graphics::TextureHandle spriteSheetTextureHandle,
+                             std::vector<utils::IntRect> consecutiveTextureRectsInit,
+                             float timeBetweenTexturesInit)
+    : consecutiveTexturePaths{std::move(spriteSheetTexturePath)},
+      consecutiveTextureHandles{spriteSheetTextureHandle},
+      consecutiveTextureRects{std::move(consecutiveTextureRectsInit)},
+      timeBetweenTextures{timeBetweenTexturesInit}
+{
+    if (consecutiveTextureRects.empty())
+    {
+        throw exceptions::TexturesNotInitialized{"Textures not initialized"};
+    }
+}
+
+const std::vector<graphics::TexturePath>& AnimationClip::getTexturePaths() const
+{
+    return consecutiveTexturePaths;
+}
+
+const graphics::TexturePath& AnimationClip::getTexturePath(std::size_t textureIndex) const
+{
+    return consecutiveTexturePaths[getTextureSourceIndex(textureIndex)];
+}
+
+graphics::TextureHandle AnimationClip::getTextureHandle(std::size_t textureIndex) const
+{
+    return consecutiveTextureHandles[getTextureSourceIndex(textureIndex)];
+}
+
+bool AnimationClip::hasTextureRects() const
+{
+    return not consecutiveTextureRects.empty();
+}
+
+const utils::IntRect& AnimationClip::getTextureRect(std::size_t textureIndex) const
+{
+    return consecutiveTextureRects[textureIndex];
+}
+
+std::size_t AnimationClip::getNumberOfTextures() const
+{
+    return hasTextureRects() ? consecutiveTextureRects.size() : consecutiveTexturePaths.size();
+}
+
+float AnimationClip::getTimeBetweenTextures() const
+{
+    return timeBetweenTextures;
+}
+
+std::size_t AnimationClip::getTextureSourceIndex(std::size_t textureIndex) const
+{
+    return hasTextureRects() ? 0 : textureIndex;
+}
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include "Rect.h"
+#include "TextureHandle.h"
+#include "TexturePath.h"
+
+namespace animations
+{
+class AnimationClip
+{
+public:
+    AnimationClip(std::vector<graphics::TexturePath> consecutiveTexturePaths,
+                  std::vector<graphics::TextureHandle> consecutiveTextureHandles, float timeBetweenTextures);
+    AnimationClip(graphics::TexturePath spriteSheetTexturePath,
+                  graphics::TextureHandle spriteSheetTextureHandle,
+                  std::vector<utils::IntRect> consecutiveTextureRects, float timeBetweenTextures);
+
+    [[nodiscard]] const std::vector<graphics::TexturePath>& getTexturePaths() const;
+    [[nodiscard]] const graphics::TexturePath& getTexturePath(std::size_t textureIndex) const;
+    [[nodiscard]] graphics::TextureHandle getTextureHandle(std::size_t textureIndex) const;
+    [[nodiscard]] bool hasTextureRects() const;
+    [[nodiscard]] const utils::IntRect& getTextureRect(std::size_t textureIndex) const;
+    [[nodiscard]] std::size_t getNumberOfTextures() const;
+    [[nodiscard]] float getTimeBetweenTextures() const;
+
+private:
+    std::size_t getTextureSourceIndex(std::size_t textureIndex) const;
+
+    const std::vector<graphics::TexturePath> consecutiveTexturePaths;
+    const std::vector<graphics::TextureHandle> consecutiveTextureHandles;
+    const std::vector<utils::IntRect> consecutiveTextureRects;
+    const float timeBetweenTextures;
+};
+}
@@ -0,0 +1,92 @@
+#include "AnimationClipLibrary.h"
+
+#include "AnimationsFromSettingsLoader.h"
+#include "AllocationTracker.h"
+#include "FrameProfiler.h"
+#include "exceptions/AnimatorSettingsNotFound.h"
+
+namespace animations
+{
+
+AnimationClipLibrary::AnimationClipLibrary(
+    std::shared_ptr<graphics::RendererPool> rendererPoolInit,
+    std::shared_ptr<AnimatorSettingsRepository> animatorSettingsRepositoryInit)
+    : rendererPool{std::move(rendererPoolInit)},
+      animatorSettingsRepository{std::move(animatorSettingsRepositoryInit)}
+{
+}
+
+std::shared_ptr<const AnimatorDefinition>
+AnimationClipLibrary::getAnimatorDefinition(const std::string& animatorName)
+{
+    const auto animatorDefinitionIter = animatorDefinitions.find(animatorName);
+    if (animatorDefinitionIter != animatorDefinitions.cend())
+    {
+        return animatorDefinitionIter->second;
+    }
+
+    auto animatorDefinition = std::make_shared<AnimatorDefinition>(loadAnimatorDefinition(animatorName));
+    animatorDefinitions.emplace(animatorName, animatorDefinition);
+    return animatorDefinition;
+}
+
+std::size_t AnimationClipLibrary::getNumberOfLoadedAnimators() const
+{
+    return animatorDefinitions.size();
+}
+
+std::vector<graphics::TexturePath> AnimationClipLibrary::getLoadedTexturePaths() const
+{
+    std::vector<graphics::TexturePath> texturePaths;
+    for (const auto& [animatorName, animatorDefinition] : animatorDefinitions)
+    {
+        for (const auto& [animationType, animationClip] : animatorDefinition->animationClips)
+        {
+            const auto& clipTexturePaths = animationClip->getTexturePaths();
+            texturePaths.insert(texturePaths.end(), clipTexturePaths.begin(), clipTexturePaths.end());
+        }
+    }
+    return texturePaths;
+}
+
+void AnimationClipLibrary::reloadAnimatorDefinitions()
+{
+    animatorSettingsRepository->reloadAnimatorsSettings();
+
+    std::vector<std::pair<AnimatorDefinition*, AnimatorDefinition>> reloadedAnimatorDefinitions;
+    reloadedAnimatorDefinitions.reserve(animatorDefinitions.size());
+    for (const auto& [animatorName, animatorDefinition] : animatorDefinitions)
+    {
+        reloadedAnimatorDefinitions.emplace_back(animatorDefinition.get(),
+                                                 loadAnimatorDefinition(animatorName));
+    }
+
+    for (auto& [animatorDefinition, reloadedAnimatorDefinition] : reloadedAnimatorDefinitions)
+    {
+        reloadedAnimatorDefinition.revision = animatorDefinition->revision + 1;
+        *animatorDefinition = std::move(reloadedAnimatorDefinition);
+    }
+}
+
+AnimatorDefinition AnimationClipLibrary::loadAnimatorDefinition(const std::string& animatorName) const
+{
+    PROFILE_ZONE("AnimationClipLibrary::loadAnimatorDefinition");
+    ALLOCATION_TAG(Animations);
+    const auto animatorSettings = animatorSettingsRepository->getAnimatorSettings(animatorName);
+    if (not animatorSettings)
+    {
+        throw exceptions::AnimatorSettingsNotFound{"Animator settings not found: " + animatorName};
+    }
+
+    auto animationClips = AnimationsFromSettingsLoader::loadAnimationClipsFromSettings(
+        animatorSettings->animationsSettings, *rendererPool);
+    auto animationTransitions = AnimationsFromSettingsLoader::loadAnimationTransitionsFromSettings(
+        animatorSettings->animationTransitionsSettings, animationClips);
+    const auto initialAnimationType =
+        toAnimationType(animatorSettings->animationsSettings.front().animationType);
+
+    return AnimatorDefinition{animatorName, std::move(animationClips), initialAnimationType,
+                              std::move(animationTransitions)};
+}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "AnimatorDefinition.h"
+#include "AnimatorSettingsRepository.h"
+#include "RendererPool.h"
+
+namespace animations
+{
+class AnimationClipLibrary
+{
+public:
+    AnimationClipLibrary(std::shared_ptr<graphics::RendererPool>,
+                         std::shared_ptr<AnimatorSettingsRepository>);
+
+    std::shared_ptr<const AnimatorDefinition> getAnimatorDefinition(const std::string& animatorName);
+    std::size_t getNumberOfLoadedAnimators() const;
+    std::vector<graphics::TexturePath> getLoadedTexturePaths() const;
+    void reloadAnimatorDefinitions();
+
+private:
+    AnimatorDefinition loadAnimatorDefinition(const std::string& animatorName) const;
+
+    std::shared_ptr<graphics::RendererPool> rendererPool;
+    std::shared_ptr<AnimatorSettingsRepository> animatorSettingsRepository;
+    std::unordered_map<std::string, std::shared_ptr<AnimatorDefinition>> animatorDefinitions;
+};
+}
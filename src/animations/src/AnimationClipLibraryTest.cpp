@@ -0,0 +1,144 @@
+#include "AnimationClipLibrary.h"
+
+#include "gtest/gtest.h"
+
+#include "AnimatorSettingsRepositoryMock.h"
+#include "RendererPoolMock.h"
+
+#include "GetProjectPath.h"
+#include "exceptions/AnimationsFromSettingsNotFound.h"
+#include "exceptions/AnimatorSettingsNotFound.h"
+
+using namespace ::testing;
+using namespace animations;
+
+class AnimationClipLibraryTest : public Test
+{
+public:
+    const std::string projectPath{utils::getProjectPath("chimarrao-platformer")};
+    const AnimationsSettings animationsSettings{{"walk", "walk/x1.txt", 2, 0.5},
+                                                {"idle", "idle/x1.txt", 3, 1.2}};
+    const AnimationTransitionsSettings animationTransitionsSettings{{"idle", "walk", false}};
+    const std::string playerAnimatorName{"player"};
+    const std::string enemyAnimatorName{"enemy"};
+    const std::string emptyAnimatorName{"empty"};
+    const std::string nonExistingAnimatorName{"nonExisting"};
+    const AnimatorSettings playerAnimatorSettings{playerAnimatorName, animationsSettings,
+                                                  animationTransitionsSettings};
+    const AnimatorSettings enemyAnimatorSettings{enemyAnimatorName, animationsSettings, {}};
+    const AnimatorSettings animatorSettingsWithEmptyAnimationsSettings{emptyAnimatorName, {}, {}};
+    std::shared_ptr<graphics::RendererPoolMock> rendererPool =
+        std::make_shared<NiceMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<AnimatorSettingsRepositoryMock> animatorSettingsRepository =
+        std::make_shared<StrictMock<AnimatorSettingsRepositoryMock>>();
+    AnimationClipLibrary animationClipLibrary{rendererPool, animatorSettingsRepository};
+};
+
+TEST_F(AnimationClipLibraryTest, givenAnimatorWithoutSettings_shouldThrowAnimatorSettingsNotFound)
+{
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(nonExistingAnimatorName))
+        .WillOnce(Return(boost::none));
+
+    ASSERT_THROW(animationClipLibrary.getAnimatorDefinition(nonExistingAnimatorName),
+                 exceptions::AnimatorSettingsNotFound);
+}
+
+TEST_F(AnimationClipLibraryTest,
+       givenAnimatorSettingsWithEmptyAnimations_shouldThrowAnimationsFromSettingsNotFound)
+{
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(emptyAnimatorName))
+        .WillOnce(Return(animatorSettingsWithEmptyAnimationsSettings));
+
+    ASSERT_THROW(animationClipLibrary.getAnimatorDefinition(emptyAnimatorName),
+                 exceptions::AnimationsFromSettingsNotFound);
+    ASSERT_EQ(animationClipLibrary.getNumberOfLoadedAnimators(), 0u);
+}
+
+TEST_F(AnimationClipLibraryTest, shouldLoadAnimatorDefinitionFromSettings)
+{
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(playerAnimatorName))
+        .WillOnce(Return(playerAnimatorSettings));
+
+    const auto animatorDefinition = animationClipLibrary.getAnimatorDefinition(playerAnimatorName);
+
+    ASSERT_EQ(animatorDefinition->animatorName, playerAnimatorName);
+    ASSERT_EQ(animatorDefinition->animationClips.size(), animationsSettings.size());
+    ASSERT_EQ(animatorDefinition->initialAnimationType, AnimationType::Walk);
+    ASSERT_EQ(animatorDefinition->animationTransitions,
+              (AnimationTransitions{{AnimationType::Idle, AnimationType::Walk, false}}));
+}
+
+TEST_F(AnimationClipLibraryTest, givenSameAnimatorName_shouldReturnSharedDefinitionLoadedOnce)
+{
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(playerAnimatorName))
+        .WillOnce(Return(playerAnimatorSettings));
+    EXPECT_CALL(*rendererPool, getTextureHandle(_)).Times(5);
+
+    const auto animatorDefinition = animationClipLibrary.getAnimatorDefinition(playerAnimatorName);
+    const auto sameAnimatorDefinition = animationClipLibrary.getAnimatorDefinition(playerAnimatorName);
+
+    ASSERT_EQ(animatorDefinition, sameAnimatorDefinition);
+    ASSERT_EQ(animationClipLibrary.getNumberOfLoadedAnimators(), 1u);
+}
+
+TEST_F(AnimationClipLibraryTest, givenDifferentAnimatorNames_shouldLoadSeparateDefinitions)
+{
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(playerAnimatorName))
+        .WillOnce(Return(playerAnimatorSettings));
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(enemyAnimatorName))
+        .WillOnce(Return(enemyAnimatorSettings));
+
+    const auto playerAnimatorDefinition = animationClipLibrary.getAnimatorDefinition(playerAnimatorName);
+    const auto enemyAnimatorDefinition = animationClipLibrary.getAnimatorDefinition(enemyAnimatorName);
+
+    ASSERT_NE(playerAnimatorDefinition, enemyAnimatorDefinition);
+    ASSERT_EQ(animationClipLibrary.getNumberOfLoadedAnimators(), 2u);
+}
+
+TEST_F(AnimationClipLibraryTest, getLoadedTexturePaths_shouldReturnTexturePathsOfLoadedAnimators)
+{
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(playerAnimatorName))
+        .WillOnce(Return(playerAnimatorSettings));
+    animationClipLibrary.getAnimatorDefinition(playerAnimatorName);
+
+    const auto texturePaths = animationClipLibrary.getLoadedTexturePaths();
+
+    ASSERT_THAT(texturePaths,
+                UnorderedElementsAre(projectPath + "walk/x1.txt", projectPath + "walk/x2.txt",
+                                     projectPath + "idle/x1.txt", projectPath + "idle/x2.txt",
+                                     projectPath + "idle/x3.txt"));
+}
+
+TEST_F(AnimationClipLibraryTest,
+       reloadAnimatorDefinitions_shouldSwapReloadedSettingsIntoSharedDefinitionAndIncreaseRevision)
+{
+    const AnimatorSettings reloadedPlayerAnimatorSettings{playerAnimatorName, {animationsSettings[1]}, {}};
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(playerAnimatorName))
+        .WillOnce(Return(playerAnimatorSettings))
+        .WillOnce(Return(reloadedPlayerAnimatorSettings));
+    const auto animatorDefinition = animationClipLibrary.getAnimatorDefinition(playerAnimatorName);
+    EXPECT_CALL(*animatorSettingsRepository, reloadAnimatorsSettings());
+
+    animationClipLibrary.reloadAnimatorDefinitions();
+
+    ASSERT_EQ(animationClipLibrary.getAnimatorDefinition(playerAnimatorName), animatorDefinition);
+    ASSERT_EQ(animatorDefinition->revision, 1u);
+    ASSERT_EQ(animatorDefinition->animationClips.size(), 1u);
+    ASSERT_EQ(animatorDefinition->initialAnimationType, AnimationType::Idle);
+    ASSERT_TRUE(animatorDefinition->animationTransitions.empty());
+}
+
+TEST_F(AnimationClipLibraryTest, givenInvalidReloadedSettings_shouldThrowAndKeepPreviousDefinition)
+{
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(playerAnimatorName))
+        .WillOnce(Return(playerAnimatorSettings))
+        .WillOnce(Return(animatorSettingsWithEmptyAnimationsSettings));
+    const auto animatorDefinition = animationClipLibrary.getAnimatorDefinition(playerAnimatorName);
+    EXPECT_CALL(*animatorSettingsRepository, reloadAnimatorsSettings());
+
+    ASSERT_THROW(animationClipLibrary.reloadAnimatorDefinitions(),
+                 exceptions::AnimationsFromSettingsNotFound);
+
+    ASSERT_EQ(animatorDefinition->revision, 0u);
+    ASSERT_EQ(animatorDefinition->animationClips.size(), animationsSettings.size());
+}
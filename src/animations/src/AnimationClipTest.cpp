@@ -0,0 +1,82 @@
+#include "AnimationClip.h"
+
+#include "gtest/gtest.h"
+
+#include "exceptions/TexturesNotInitialized.h"
+
+using namespace ::testing;
+using namespace animations;
+
+class AnimationClipTest : public Test
+{
+public:
+    const std::vector<std::string> textures{"1", "2", "3"};
+    const std::vector<graphics::TextureHandle> textureHandles{4, 5, 6};
+    const std::vector<std::string> emptyTextures{};
+    const std::vector<graphics::TextureHandle> emptyTextureHandles{};
+    const float timeBetweenTextures = 60;
+    const AnimationClip animationClip{textures, textureHandles, timeBetweenTextures};
+};
+
+TEST_F(AnimationClipTest, creationOfAnimationClipWithEmptyTextures_shouldThrowTexturesNotInitialized)
+{
+    ASSERT_THROW(AnimationClip(emptyTextures, emptyTextureHandles, timeBetweenTextures),
+                 exceptions::TexturesNotInitialized);
+}
+
+TEST_F(AnimationClipTest,
+       creationOfAnimationClipWithUnresolvedTextureHandles_shouldThrowTexturesNotInitialized)
+{
+    ASSERT_THROW(AnimationClip(textures, emptyTextureHandles, timeBetweenTextures),
+                 exceptions::TexturesNotInitialized);
+}
+
+TEST_F(AnimationClipTest, shouldReturnTexturesInOrder)
+{
+    ASSERT_EQ(animationClip.getNumberOfTextures(), textures.size());
+    ASSERT_EQ(animationClip.getTexturePath(0), textures[0]);
+    ASSERT_EQ(animationClip.getTexturePath(2), textures[2]);
+}
+
+TEST_F(AnimationClipTest, shouldReturnTextureHandlesInOrder)
+{
+    ASSERT_EQ(animationClip.getTextureHandle(0), textureHandles[0]);
+    ASSERT_EQ(animationClip.getTextureHandle(2), textureHandles[2]);
+}
+
+TEST_F(AnimationClipTest, shouldReturnTimeBetweenTextures)
+{
+    ASSERT_EQ(animationClip.getTimeBetweenTextures(), timeBetweenTextures);
+}
+
+TEST_F(AnimationClipTest, clipWithoutTextureRects_shouldNotHaveTextureRects)
+{
+    ASSERT_FALSE(animationClip.hasTextureRects());
+}
+
+TEST_F(AnimationClipTest, creationOfSpriteSheetClipWithoutTextureRects_shouldThrowTexturesNotInitialized)
+{
+    ASSERT_THROW(AnimationClip(textures[0], textureHandles[0], {}, timeBetweenTextures),
+                 exceptions::TexturesNotInitialized);
+}
+
+TEST_F(AnimationClipTest, shouldReturnTextureRectsInOrder)
+{
+    const std::vector<utils::IntRect> textureRects{{0, 0, 8, 8}, {8, 0, 8, 8}, {16, 0, 8, 8}};
+    const AnimationClip spriteSheetClip{textures[0], textureHandles[0], textureRects, timeBetweenTextures};
+
+    ASSERT_TRUE(spriteSheetClip.hasTextureRects());
+    ASSERT_EQ(spriteSheetClip.getTextureRect(0), textureRects[0]);
+    ASSERT_EQ(spriteSheetClip.getTextureRect(2), textureRects[2]);
+}
+
+TEST_F(AnimationClipTest, spriteSheetClip_shouldHaveSingleTexturePathAndHandleForAllFrames)
+{
+    const std::vector<utils::IntRect> textureRects{{0, 0, 8, 8}, {8, 0, 8, 8}, {16, 0, 8, 8}};
+    const AnimationClip spriteSheetClip{textures[0], textureHandles[0], textureRects, timeBetweenTextures};
+
+    ASSERT_EQ(spriteSheetClip.getNumberOfTextures(), textureRects.size());
+    ASSERT_EQ(spriteSheetClip.getTexturePaths(), std::vector<std::string>{textures[0]});
+    ASSERT_EQ(spriteSheetClip.getTexturePath(2), textures[0]);
+    ASSERT_EQ(spriteSheetClip.getTextureHandle(2), textureHandles[0]);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <ostream>
+#include <tuple>
+
+#include "GraphicsId.h"
+#include "Rect.h"
+#include "TextureHandle.h"
+#include "Vector.h"
+#include "boost/uuid/uuid_io.hpp"
+
+namespace animations
+{
+struct AnimationFrameChange
+{
+    graphics::GraphicsId graphicsId;
+    graphics::TextureHandle textureHandle;
+    boost::optional<utils::IntRect> textureRect{};
+    utils::Vector2f scale{1, 1};
+};
+
+inline bool operator==(const AnimationFrameChange& lhs, const AnimationFrameChange& rhs)
+{
+    auto tieStruct = [](const AnimationFrameChange& frameChange) {
+        return std::tie(frameChange.graphicsId, frameChange.textureHandle, frameChange.textureRect,
+                        frameChange.scale);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const AnimationFrameChange& frameChange)
+{
+    os << "graphicsId: " << frameChange.graphicsId << " textureHandle: " << frameChange.textureHandle;
+    if (frameChange.textureRect)
+    {
+        os << " textureRect: " << *frameChange.textureRect;
+    }
+    return os << " scale: " << frameChange.scale;
+}
+}
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <boost/optional.hpp>
 #include <ostream>
 #include <string>
 #include <tuple>
 
+#include "SpriteSheetSettings.h"
 #include "TexturePath.h"
 
 namespace animations
@@ -14,23 +16,29 @@ struct AnimationSettings
     graphics::TexturePath firstTexturePath;
     int numberOfTextures;
     float timeBetweenTexturesInSeconds;
+    boost::optional<SpriteSheetSettings> spriteSheetSettings{};
 };
 
 inline bool operator==(const AnimationSettings& lhs, const AnimationSettings& rhs)
 {
     auto tieStruct = [](const AnimationSettings& settings) {
         return std::tie(settings.animationType, settings.firstTexturePath, settings.numberOfTextures,
-                        settings.timeBetweenTexturesInSeconds);
+                        settings.timeBetweenTexturesInSeconds, settings.spriteSheetSettings);
     };
     return tieStruct(lhs) == tieStruct(rhs);
 }
 
 inline std::ostream& operator<<(std::ostream& os, const AnimationSettings& animationSettings)
 {
-    return os << "animationType: " << animationSettings.animationType
-              << " firstTexturePath: " << animationSettings.firstTexturePath
-              << " numberOfTextures: " << animationSettings.numberOfTextures
-              << " timeBetweenTexturesInSeconds: " << animationSettings.timeBetweenTexturesInSeconds;
+    os << "animationType: " << animationSettings.animationType
+       << " firstTexturePath: " << animationSettings.firstTexturePath
+       << " numberOfTextures: " << animationSettings.numberOfTextures
+       << " timeBetweenTexturesInSeconds: " << animationSettings.timeBetweenTexturesInSeconds;
+    if (animationSettings.spriteSheetSettings)
+    {
+        os << " spriteSheetSettings: {" << *animationSettings.spriteSheetSettings << "}";
+    }
+    return os;
 }
 
 using AnimationsSettings = std::vector<AnimationSettings>;
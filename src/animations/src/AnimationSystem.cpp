@@ -0,0 +1,269 @@
+#include "AnimationSystem.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "AllocationTracker.h"
+#include "FrameProfiler.h"
+#include "exceptions/AnimationNotFound.h"
+#include "exceptions/TexturesNotInitialized.h"
+
+namespace animations
+{
+namespace
+{
+const std::size_t invalidIndex{std::numeric_limits<std::size_t>::max()};
+const unsigned invalidTextureIndex{std::numeric_limits<unsigned>::max()};
+
+inline unsigned calculateElapsedTexturesCount(double currentTime, double startTime, float timeBetweenTextures)
+{
+    const auto elapsedTime = static_cast<float>(std::max(currentTime - startTime, 0.0));
+    return static_cast<unsigned>(elapsedTime / timeBetweenTextures);
+}
+
+inline boost::optional<utils::IntRect> getTextureRect(const AnimationClip& clip, unsigned textureIndex)
+{
+    if (not clip.hasTextureRects())
+    {
+        return boost::none;
+    }
+    return clip.getTextureRect(textureIndex);
+}
+}
+
+AnimationId AnimationSystem::add(const graphics::GraphicsId& graphicsId,
+                                 std::shared_ptr<const AnimationClip> clip)
+{
+    if (not clip)
+    {
+        throw exceptions::TexturesNotInitialized{"AnimationSystem: Animation clip not initialized"};
+    }
+
+    AnimationId animationId;
+    if (freeAnimationIds.empty())
+    {
+        animationId = indicesByAnimationId.size();
+        indicesByAnimationId.push_back(invalidIndex);
+    }
+    else
+    {
+        animationId = freeAnimationIds.back();
+        freeAnimationIds.pop_back();
+    }
+
+    const auto index = graphicsIds.size();
+    indicesByAnimationId[animationId] = index;
+    graphicsIds.push_back(graphicsId);
+    animationIds.push_back(animationId);
+    startTimes.push_back(0);
+    timesBetweenTextures.push_back(0);
+    elapsedTexturesCounts.push_back(0);
+    currentTextureIndices.push_back(invalidTextureIndex);
+    numbersOfTextures.push_back(0);
+    scales.push_back({1, 1});
+    clips.push_back(nullptr);
+    clipOwners.push_back(nullptr);
+    setClipAtIndex(index, std::move(clip));
+
+    swapAnimations(index, numberOfVisibleAnimations);
+    numberOfVisibleAnimations++;
+    return animationId;
+}
+
+void AnimationSystem::remove(AnimationId animationId)
+{
+    auto index = getIndex(animationId);
+
+    if (index < numberOfVisibleAnimations)
+    {
+        numberOfVisibleAnimations--;
+        swapAnimations(index, numberOfVisibleAnimations);
+        index = numberOfVisibleAnimations;
+    }
+    swapAnimations(index, graphicsIds.size() - 1);
+
+    startTimes.pop_back();
+    timesBetweenTextures.pop_back();
+    elapsedTexturesCounts.pop_back();
+    currentTextureIndices.pop_back();
+    numbersOfTextures.pop_back();
+    scales.pop_back();
+    clips.pop_back();
+    clipOwners.pop_back();
+    graphicsIds.pop_back();
+    animationIds.pop_back();
+
+    indicesByAnimationId[animationId] = invalidIndex;
+    freeAnimationIds.push_back(animationId);
+}
+
+void AnimationSystem::setClip(AnimationId animationId, std::shared_ptr<const AnimationClip> clip)
+{
+    if (not clip)
+    {
+        throw exceptions::TexturesNotInitialized{"AnimationSystem: Animation clip not initialized"};
+    }
+
+    setClipAtIndex(getIndex(animationId), std::move(clip));
+}
+
+void AnimationSystem::chainClip(AnimationId animationId, std::shared_ptr<const AnimationClip> clip)
+{
+    if (not clip)
+    {
+        throw exceptions::TexturesNotInitialized{"AnimationSystem: Animation clip not initialized"};
+    }
+
+    const auto index = getIndex(animationId);
+    const auto currentClipEndTime =
+        startTimes[index] + static_cast<double>(numbersOfTextures[index] * timesBetweenTextures[index]);
+    setClipAtIndex(index, std::move(clip));
+    startTimes[index] = currentClipEndTime;
+}
+
+void AnimationSystem::reset(AnimationId animationId)
+{
+    const auto index = getIndex(animationId);
+    startTimes[index] = currentTime;
+    currentTextureIndices[index] = invalidTextureIndex;
+}
+
+void AnimationSystem::setScale(AnimationId animationId, const utils::Vector2f& scale)
+{
+    const auto index = getIndex(animationId);
+    scales[index] = scale;
+    currentTextureIndices[index] = invalidTextureIndex;
+}
+
+void AnimationSystem::setVisible(AnimationId animationId, bool visible)
+{
+    const auto index = getIndex(animationId);
+    if (visible == (index < numberOfVisibleAnimations))
+    {
+        return;
+    }
+
+    if (visible)
+    {
+        swapAnimations(index, numberOfVisibleAnimations);
+        numberOfVisibleAnimations++;
+    }
+    else
+    {
+        numberOfVisibleAnimations--;
+        swapAnimations(index, numberOfVisibleAnimations);
+    }
+}
+
+bool AnimationSystem::isVisible(AnimationId animationId) const
+{
+    return getIndex(animationId) < numberOfVisibleAnimations;
+}
+
+graphics::TextureHandle AnimationSystem::getCurrentTextureHandle(AnimationId animationId) const
+{
+    const auto index = getIndex(animationId);
+    return clips[index]->getTextureHandle(calculateTextureIndex(index));
+}
+
+bool AnimationSystem::willReachClipEnd(AnimationId animationId, const utils::DeltaTime& deltaTime) const
+{
+    const auto index = getIndex(animationId);
+    return calculateElapsedTexturesCount(currentTime + deltaTime.count(), startTimes[index],
+                                         timesBetweenTextures[index]) >= numbersOfTextures[index];
+}
+
+const std::vector<AnimationFrameChange>& AnimationSystem::update(const utils::DeltaTime& deltaTime)
+{
+    PROFILE_ZONE("AnimationSystem::update");
+    ALLOCATION_TAG(Animations);
+    frameChanges.clear();
+    currentTime += deltaTime.count();
+
+    const auto* startTime = startTimes.data();
+    const auto* timeBetweenTextures = timesBetweenTextures.data();
+    auto* elapsedTexturesCount = elapsedTexturesCounts.data();
+
+    for (std::size_t index = 0; index < numberOfVisibleAnimations; index++)
+    {
+        elapsedTexturesCount[index] =
+            calculateElapsedTexturesCount(currentTime, startTime[index], timeBetweenTextures[index]);
+    }
+
+    for (std::size_t index = 0; index < numberOfVisibleAnimations; index++)
+    {
+        const auto textureIndex = elapsedTexturesCount[index] % numbersOfTextures[index];
+        if (textureIndex == currentTextureIndices[index])
+        {
+            continue;
+        }
+
+        currentTextureIndices[index] = textureIndex;
+        const auto& clip = *clips[index];
+        frameChanges.push_back({graphicsIds[index], clip.getTextureHandle(textureIndex),
+                                getTextureRect(clip, textureIndex), scales[index]});
+    }
+
+    return frameChanges;
+}
+
+std::size_t AnimationSystem::getNumberOfAnimations() const
+{
+    return graphicsIds.size();
+}
+
+std::size_t AnimationSystem::getNumberOfVisibleAnimations() const
+{
+    return numberOfVisibleAnimations;
+}
+
+std::size_t AnimationSystem::getIndex(AnimationId animationId) const
+{
+    if (animationId >= indicesByAnimationId.size() || indicesByAnimationId[animationId] == invalidIndex)
+    {
+        throw exceptions::AnimationNotFound{"AnimationSystem: Animation not found: " +
+                                            std::to_string(animationId)};
+    }
+    return indicesByAnimationId[animationId];
+}
+
+void AnimationSystem::setClipAtIndex(std::size_t index, std::shared_ptr<const AnimationClip> clip)
+{
+    clips[index] = clip.get();
+    timesBetweenTextures[index] = clip->getTimeBetweenTextures();
+    startTimes[index] = currentTime;
+    numbersOfTextures[index] = static_cast<unsigned>(clip->getNumberOfTextures());
+    currentTextureIndices[index] = invalidTextureIndex;
+    clipOwners[index] = std::move(clip);
+}
+
+void AnimationSystem::swapAnimations(std::size_t index, std::size_t otherIndex)
+{
+    if (index == otherIndex)
+    {
+        return;
+    }
+
+    std::swap(startTimes[index], startTimes[otherIndex]);
+    std::swap(timesBetweenTextures[index], timesBetweenTextures[otherIndex]);
+    std::swap(elapsedTexturesCounts[index], elapsedTexturesCounts[otherIndex]);
+    std::swap(currentTextureIndices[index], currentTextureIndices[otherIndex]);
+    std::swap(numbersOfTextures[index], numbersOfTextures[otherIndex]);
+    std::swap(scales[index], scales[otherIndex]);
+    std::swap(clips[index], clips[otherIndex]);
+    std::swap(clipOwners[index], clipOwners[otherIndex]);
+    std::swap(graphicsIds[index], graphicsIds[otherIndex]);
+    std::swap(animationIds[index], animationIds[otherIndex]);
+    indicesByAnimationId[animationIds[index]] = index;
+    indicesByAnimationId[animationIds[otherIndex]] = otherIndex;
+}
+
+unsigned AnimationSystem::calculateTextureIndex(std::size_t index) const
+{
+    const auto elapsedTexturesCount =
+        calculateElapsedTexturesCount(currentTime, startTimes[index], timesBetweenTextures[index]);
+    return elapsedTexturesCount % numbersOfTextures[index];
+}
+
+}
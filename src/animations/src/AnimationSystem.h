@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "AnimationClip.h"
+#include "AnimationFrameChange.h"
+#include "DeltaTime.h"
+#include "GraphicsId.h"
+#include "Vector.h"
+
+namespace animations
+{
+using AnimationId = std::size_t;
+
+class AnimationSystem
+{
+public:
+    AnimationId add(const graphics::GraphicsId&, std::shared_ptr<const AnimationClip>);
+    void remove(AnimationId);
+    void setClip(AnimationId, std::shared_ptr<const AnimationClip>);
+    void chainClip(AnimationId, std::shared_ptr<const AnimationClip>);
+    void reset(AnimationId);
+    void setScale(AnimationId, const utils::Vector2f&);
+    void setVisible(AnimationId, bool visible);
+    [[nodiscard]] bool isVisible(AnimationId) const;
+    [[nodiscard]] graphics::TextureHandle getCurrentTextureHandle(AnimationId) const;
+    [[nodiscard]] bool willReachClipEnd(AnimationId, const utils::DeltaTime&) const;
+    const std::vector<AnimationFrameChange>& update(const utils::DeltaTime&);
+    [[nodiscard]] std::size_t getNumberOfAnimations() const;
+    [[nodiscard]] std::size_t getNumberOfVisibleAnimations() const;
+
+private:
+    std::size_t getIndex(AnimationId) const;
+    void setClipAtIndex(std::size_t index, std::shared_ptr<const AnimationClip>);
+    void swapAnimations(std::size_t index, std::size_t otherIndex);
+    unsigned calculateTextureIndex(std::size_t index) const;
+
+    double currentTime{0};
+    std::size_t numberOfVisibleAnimations{0};
+    std::vector<double> startTimes;
+    std::vector<float> timesBetweenTextures;
+    std::vector<unsigned> elapsedTexturesCounts;
+    std::vector<unsigned> currentTextureIndices;
+    std::vector<unsigned> numbersOfTextures;
+    std::vector<utils::Vector2f> scales;
+    std::vector<const AnimationClip*> clips;
+    std::vector<graphics::GraphicsId> graphicsIds;
+    std::vector<AnimationId> animationIds;
+    std::vector<std::shared_ptr<const AnimationClip>> clipOwners;
+    std::vector<std::size_t> indicesByAnimationId;
+    std::vector<AnimationId> freeAnimationIds;
+    std::vector<AnimationFrameChange> frameChanges;
+};
+}
@@ -0,0 +1,262 @@
+#include "AnimationSystem.h"
+
+#include "gtest/gtest.h"
+
+#include "GraphicsIdGenerator.h"
+#include "exceptions/AnimationNotFound.h"
+#include "exceptions/TexturesNotInitialized.h"
+
+using namespace ::testing;
+using namespace animations;
+
+class AnimationSystemTest : public Test
+{
+public:
+    const graphics::GraphicsId graphicsId1{graphics::GraphicsIdGenerator::generateId()};
+    const graphics::GraphicsId graphicsId2{graphics::GraphicsIdGenerator::generateId()};
+    const graphics::GraphicsId graphicsId3{graphics::GraphicsIdGenerator::generateId()};
+    const std::shared_ptr<const AnimationClip> fastClip{
+        std::make_shared<const AnimationClip>(std::vector<graphics::TexturePath>{"fast1", "fast2"},
+                                              std::vector<graphics::TextureHandle>{0, 1}, 1.f)};
+    const std::shared_ptr<const AnimationClip> slowClip{std::make_shared<const AnimationClip>(
+        std::vector<graphics::TexturePath>{"slow1", "slow2", "slow3"},
+        std::vector<graphics::TextureHandle>{5, 6, 7}, 3.f)};
+    const AnimationId invalidAnimationId{42};
+    AnimationSystem animationSystem;
+};
+
+TEST_F(AnimationSystemTest, addAnimationWithoutClip_shouldThrowTexturesNotInitialized)
+{
+    ASSERT_THROW(animationSystem.add(graphicsId1, nullptr), exceptions::TexturesNotInitialized);
+}
+
+TEST_F(AnimationSystemTest, addedAnimation_shouldStartAtFirstFrame)
+{
+    const auto animationId = animationSystem.add(graphicsId1, slowClip);
+
+    ASSERT_EQ(animationSystem.getNumberOfAnimations(), 1u);
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(animationId), 5u);
+}
+
+TEST_F(AnimationSystemTest, addedAnimations_shouldReportFirstFramesOnFirstUpdate)
+{
+    animationSystem.add(graphicsId1, fastClip);
+    animationSystem.add(graphicsId2, slowClip);
+
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{0.5f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 0}, {graphicsId2, 5}}));
+}
+
+TEST_F(AnimationSystemTest, givenTimeNotExceedingTimeBetweenTextures_shouldNotReportFrameChanges)
+{
+    animationSystem.add(graphicsId1, fastClip);
+    animationSystem.add(graphicsId2, slowClip);
+    animationSystem.update(utils::DeltaTime{0});
+
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{0.5f});
+
+    ASSERT_TRUE(frameChanges.empty());
+}
+
+TEST_F(AnimationSystemTest, shouldReportFrameChangesOnlyForAnimationsWhichAdvanced)
+{
+    const auto fastAnimationId = animationSystem.add(graphicsId1, fastClip);
+    const auto slowAnimationId = animationSystem.add(graphicsId2, slowClip);
+    animationSystem.update(utils::DeltaTime{0});
+
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{1.5f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 1}}));
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(fastAnimationId), 1u);
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(slowAnimationId), 5u);
+}
+
+TEST_F(AnimationSystemTest, animationShouldReturnToFirstFrameAfterLast)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+
+    animationSystem.update(utils::DeltaTime{1.5f});
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{1.f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 0}}));
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(animationId), 0u);
+}
+
+TEST_F(AnimationSystemTest, removedAnimation_shouldNotBeUpdatedAndOthersShouldKeepTheirState)
+{
+    const auto animationId1 = animationSystem.add(graphicsId1, fastClip);
+    const auto animationId2 = animationSystem.add(graphicsId2, slowClip);
+    const auto animationId3 = animationSystem.add(graphicsId3, fastClip);
+    animationSystem.update(utils::DeltaTime{1.5f});
+
+    animationSystem.remove(animationId1);
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{1.f});
+
+    ASSERT_EQ(animationSystem.getNumberOfAnimations(), 2u);
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId3, 0}}));
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(animationId2), 5u);
+    ASSERT_THROW(animationSystem.getCurrentTextureHandle(animationId1), exceptions::AnimationNotFound);
+}
+
+TEST_F(AnimationSystemTest, removedAnimationId_shouldBeReused)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+    animationSystem.remove(animationId);
+
+    const auto reusedAnimationId = animationSystem.add(graphicsId2, slowClip);
+
+    ASSERT_EQ(reusedAnimationId, animationId);
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(reusedAnimationId), 5u);
+}
+
+TEST_F(AnimationSystemTest, setClip_shouldRestartAnimationWithNewClip)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+    animationSystem.update(utils::DeltaTime{1.5f});
+
+    animationSystem.setClip(animationId, slowClip);
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{1.5f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 5}}));
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(animationId), 5u);
+}
+
+TEST_F(AnimationSystemTest, chainedClip_shouldStartWhenCurrentClipEnds)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+    animationSystem.update(utils::DeltaTime{1.5f});
+
+    animationSystem.chainClip(animationId, slowClip);
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{4.f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 6}}));
+}
+
+TEST_F(AnimationSystemTest, willReachClipEnd_shouldTellIfLastFrameEndsWithinDeltaTime)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+    animationSystem.update(utils::DeltaTime{1.5f});
+
+    ASSERT_FALSE(animationSystem.willReachClipEnd(animationId, utils::DeltaTime{0.25f}));
+    ASSERT_TRUE(animationSystem.willReachClipEnd(animationId, utils::DeltaTime{0.5f}));
+}
+
+TEST_F(AnimationSystemTest, setScale_shouldReportCurrentFrameWithNewScale)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+    animationSystem.update(utils::DeltaTime{1.5f});
+
+    animationSystem.setScale(animationId, {-1, 1});
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{0.25f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 1, boost::none, {-1, 1}}}));
+}
+
+TEST_F(AnimationSystemTest, reset_shouldReturnToFirstFrame)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+    animationSystem.update(utils::DeltaTime{1.5f});
+
+    animationSystem.reset(animationId);
+
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(animationId), 0u);
+}
+
+TEST_F(AnimationSystemTest, reset_shouldReportFirstFrameOnNextUpdate)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+    animationSystem.update(utils::DeltaTime{1.5f});
+
+    animationSystem.reset(animationId);
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{0.5f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 0}}));
+}
+
+TEST_F(AnimationSystemTest, setClipAfterNoFrameAdvance_shouldReportFirstFrameOfNewClip)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+
+    animationSystem.setClip(animationId, slowClip);
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{0.5f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 5}}));
+}
+
+TEST_F(AnimationSystemTest, givenInvalidAnimationId_shouldThrowAnimationNotFound)
+{
+    ASSERT_THROW(animationSystem.remove(invalidAnimationId), exceptions::AnimationNotFound);
+    ASSERT_THROW(animationSystem.setClip(invalidAnimationId, fastClip), exceptions::AnimationNotFound);
+    ASSERT_THROW(animationSystem.reset(invalidAnimationId), exceptions::AnimationNotFound);
+}
+
+TEST_F(AnimationSystemTest, givenTimeExceedingManyTexturesInOneUpdate_shouldComputeFrameFromElapsedTime)
+{
+    const auto animationId = animationSystem.add(graphicsId1, slowClip);
+
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{7.f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 7}}));
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(animationId), 7u);
+}
+
+TEST_F(AnimationSystemTest, addedAnimation_shouldBeVisible)
+{
+    const auto animationId = animationSystem.add(graphicsId1, fastClip);
+
+    ASSERT_TRUE(animationSystem.isVisible(animationId));
+    ASSERT_EQ(animationSystem.getNumberOfVisibleAnimations(), 1u);
+}
+
+TEST_F(AnimationSystemTest, invisibleAnimation_shouldNotReportFrameChanges)
+{
+    const auto animationId1 = animationSystem.add(graphicsId1, fastClip);
+    animationSystem.add(graphicsId2, fastClip);
+
+    animationSystem.setVisible(animationId1, false);
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{1.5f});
+
+    ASSERT_FALSE(animationSystem.isVisible(animationId1));
+    ASSERT_EQ(animationSystem.getNumberOfVisibleAnimations(), 1u);
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId2, 1}}));
+}
+
+TEST_F(AnimationSystemTest, animationMadeVisibleAgain_shouldCatchUpWithElapsedTime)
+{
+    const auto animationId = animationSystem.add(graphicsId1, slowClip);
+    animationSystem.setVisible(animationId, false);
+    animationSystem.update(utils::DeltaTime{4.f});
+    animationSystem.update(utils::DeltaTime{3.f});
+
+    animationSystem.setVisible(animationId, true);
+    const auto& frameChanges = animationSystem.update(utils::DeltaTime{0.5f});
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{{graphicsId1, 7}}));
+}
+
+TEST_F(AnimationSystemTest, invisibleAnimation_shouldReturnTextureComputedFromElapsedTime)
+{
+    const auto animationId = animationSystem.add(graphicsId1, slowClip);
+    animationSystem.setVisible(animationId, false);
+
+    animationSystem.update(utils::DeltaTime{3.5f});
+
+    ASSERT_EQ(animationSystem.getCurrentTextureHandle(animationId), 6u);
+}
+
+TEST_F(AnimationSystemTest, removedInvisibleAnimation_shouldKeepOtherAnimationsVisibility)
+{
+    const auto animationId1 = animationSystem.add(graphicsId1, fastClip);
+    const auto animationId2 = animationSystem.add(graphicsId2, fastClip);
+    const auto animationId3 = animationSystem.add(graphicsId3, slowClip);
+    animationSystem.setVisible(animationId1, false);
+    animationSystem.setVisible(animationId3, false);
+
+    animationSystem.remove(animationId1);
+
+    ASSERT_TRUE(animationSystem.isVisible(animationId2));
+    ASSERT_FALSE(animationSystem.isVisible(animationId3));
+    ASSERT_EQ(animationSystem.getNumberOfVisibleAnimations(), 1u);
+    ASSERT_EQ(animationSystem.getNumberOfAnimations(), 2u);
+}
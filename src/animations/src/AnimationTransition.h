@@ -0,0 +1,34 @@
+#pragma once
+
+#include <ostream>
+#include <tuple>
+#include <vector>
+
+#include "AnimationType.h"
+
+namespace animations
+{
+struct AnimationTransition
+{
+    AnimationType fromAnimationType;
+    AnimationType toAnimationType;
+    bool onAnimationEnd;
+};
+
+inline bool operator==(const AnimationTransition& lhs, const AnimationTransition& rhs)
+{
+    auto tieStruct = [](const AnimationTransition& transition) {
+        return std::tie(transition.fromAnimationType, transition.toAnimationType, transition.onAnimationEnd);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const AnimationTransition& transition)
+{
+    return os << "fromAnimationType: " << transition.fromAnimationType
+              << " toAnimationType: " << transition.toAnimationType
+              << " onAnimationEnd: " << transition.onAnimationEnd;
+}
+
+using AnimationTransitions = std::vector<AnimationTransition>;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace animations
+{
+struct AnimationTransitionSettings
+{
+    std::string fromAnimationType;
+    std::string toAnimationType;
+    bool onAnimationEnd;
+};
+
+inline bool operator==(const AnimationTransitionSettings& lhs, const AnimationTransitionSettings& rhs)
+{
+    auto tieStruct = [](const AnimationTransitionSettings& settings) {
+        return std::tie(settings.fromAnimationType, settings.toAnimationType, settings.onAnimationEnd);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const AnimationTransitionSettings& transitionSettings)
+{
+    return os << "fromAnimationType: " << transitionSettings.fromAnimationType
+              << " toAnimationType: " << transitionSettings.toAnimationType
+              << " onAnimationEnd: " << transitionSettings.onAnimationEnd;
+}
+
+using AnimationTransitionsSettings = std::vector<AnimationTransitionSettings>;
+}
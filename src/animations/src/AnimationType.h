@@ -12,13 +12,19 @@ enum class AnimationType
 {
     Idle,
     Walk,
-    Jump
+    Run,
+    Jump,
+    Attack,
+    Hit,
+    Dead
 };
 
 inline std::string toString(AnimationType animationType)
 {
     std::unordered_map<AnimationType, std::string> animationTypeToString{
-        {AnimationType::Idle, "Idle"}, {AnimationType::Walk, "Walk"}, {AnimationType::Jump, "Jump"}};
+        {AnimationType::Idle, "Idle"},     {AnimationType::Walk, "Walk"}, {AnimationType::Run, "Run"},
+        {AnimationType::Jump, "Jump"},     {AnimationType::Attack, "Attack"},
+        {AnimationType::Hit, "Hit"},       {AnimationType::Dead, "Dead"}};
 
     try
     {
@@ -35,7 +41,9 @@ inline AnimationType toAnimationType(const std::string& animationTypeAsString)
     const auto animationTypeLowerString = utils::getLowerCases(animationTypeAsString);
 
     std::unordered_map<std::string, AnimationType> stringToAnimationType{
-        {"idle", AnimationType::Idle}, {"walk", AnimationType::Walk}, {"jump", AnimationType::Jump}};
+        {"idle", AnimationType::Idle},     {"walk", AnimationType::Walk}, {"run", AnimationType::Run},
+        {"jump", AnimationType::Jump},     {"attack", AnimationType::Attack},
+        {"hit", AnimationType::Hit},       {"dead", AnimationType::Dead}};
 
     try
     {
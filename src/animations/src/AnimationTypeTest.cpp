@@ -11,9 +11,11 @@ public:
     const AnimationType animationType1 = AnimationType::Idle;
     const AnimationType animationType2 = AnimationType::Walk;
     const AnimationType animationType3 = AnimationType::Jump;
+    const AnimationType animationType4 = AnimationType::Attack;
     const std::string animationTypeString1 = "Idle";
     const std::string animationTypeString2 = "Walk";
     const std::string animationTypeString3 = "Jump";
+    const std::string animationTypeString4 = "Attack";
     const std::string animationTypeDifferentSize = "IDLE";
     const std::string nonExistingAnimationTypeString = "asdasdas";
 };
@@ -23,6 +25,7 @@ TEST_F(AnimationTypeTest, givenAnimationType_shouldReturnString)
     ASSERT_EQ(toString(animationType1), animationTypeString1);
     ASSERT_EQ(toString(animationType2), animationTypeString2);
     ASSERT_EQ(toString(animationType3), animationTypeString3);
+    ASSERT_EQ(toString(animationType4), animationTypeString4);
 }
 
 TEST_F(AnimationTypeTest, givenStringNotCorrespondingToAnimationType_shouldThrowAnimationTypeNotFound)
@@ -41,4 +44,5 @@ TEST_F(AnimationTypeTest, givenStringCorrespondingToAnimationType_shouldReturnAn
     ASSERT_EQ(toAnimationType(animationTypeString1), animationType1);
     ASSERT_EQ(toAnimationType(animationTypeString2), animationType2);
     ASSERT_EQ(toAnimationType(animationTypeString3), animationType3);
+    ASSERT_EQ(toAnimationType(animationTypeString4), animationType4);
 }
\ No newline at end of file
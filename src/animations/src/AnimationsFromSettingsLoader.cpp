@@ -1,31 +1,110 @@
 #include "AnimationsFromSettingsLoader.h"
 
+#include <cmath>
+
 #include "GetProjectPath.h"
 #include "IncrementalFilePathsCreator.h"
 #include "exceptions/AnimationsFromSettingsNotFound.h"
+#include "exceptions/InvalidAnimatorSettings.h"
 
 namespace animations
 {
+namespace
+{
+std::shared_ptr<const AnimationClip>
+loadSpriteSheetAnimationClip(const SpriteSheetSettings& spriteSheetSettings, float timeBetweenTextures,
+                             const std::string& projectPath, graphics::RendererPool& rendererPool)
+{
+    const auto& [texturePath, rows, columns, frameWidth, frameHeight, numberOfFrames] = spriteSheetSettings;
+    if (rows <= 0 || columns <= 0 || frameWidth <= 0 || frameHeight <= 0 || numberOfFrames <= 0 ||
+        numberOfFrames > rows * columns)
+    {
+        throw exceptions::InvalidAnimatorSettings{"Invalid sprite sheet grid: " + texturePath};
+    }
 
-void AnimationsFromSettingsLoader::loadAnimationsFromSettings(
-    std::unordered_map<AnimationType, Animation>& animations, const AnimationsSettings& animationsSettings)
+    const auto spriteSheetPath = projectPath + texturePath;
+    const auto textureHandle = rendererPool.getTextureHandle(spriteSheetPath);
+    std::vector<utils::IntRect> textureRects;
+    textureRects.reserve(numberOfFrames);
+    for (auto frameIndex = 0; frameIndex < numberOfFrames; frameIndex++)
+    {
+        textureRects.emplace_back((frameIndex % columns) * frameWidth, (frameIndex / columns) * frameHeight,
+                                  frameWidth, frameHeight);
+    }
+    return std::make_shared<const AnimationClip>(spriteSheetPath, textureHandle, std::move(textureRects),
+                                                 timeBetweenTextures);
+}
+}
+
+AnimationClips
+AnimationsFromSettingsLoader::loadAnimationClipsFromSettings(const AnimationsSettings& animationsSettings,
+                                                             graphics::RendererPool& rendererPool)
 {
     if (animationsSettings.empty())
     {
         throw exceptions::AnimationsFromSettingsNotFound{"Animations not found in settings"};
     }
 
-    animations.clear();
-    animations.reserve(animationsSettings.size());
+    const auto projectPath = utils::getProjectPath("chimarrao-platformer");
+    AnimationClips animationClips;
+    animationClips.reserve(animationsSettings.size());
+    utils::IncrementalFilePaths incrementalTexturePaths;
 
     for (const auto& animationSettings : animationsSettings)
     {
         const auto animationType = toAnimationType(animationSettings.animationType);
-        const auto texturePaths = utils::IncrementalFilePathsCreator::createFilePaths(
-            utils::getProjectPath("chimarrao-platformer") + animationSettings.firstTexturePath,
-            animationSettings.numberOfTextures);
         const auto timeBetweenTextures = animationSettings.timeBetweenTexturesInSeconds;
-        animations.insert({animationType, Animation{texturePaths, timeBetweenTextures}});
+        if (timeBetweenTextures <= 0 || std::isnan(timeBetweenTextures))
+        {
+            throw exceptions::InvalidAnimatorSettings{"Invalid time between textures in animation: " +
+                                                      animationSettings.animationType};
+        }
+        if (animationSettings.spriteSheetSettings)
+        {
+            animationClips.insert({animationType, loadSpriteSheetAnimationClip(
+                                                      *animationSettings.spriteSheetSettings,
+                                                      timeBetweenTextures, projectPath, rendererPool)});
+            continue;
+        }
+        utils::IncrementalFilePathsCreator::createFilePaths(projectPath + animationSettings.firstTexturePath,
+                                                            animationSettings.numberOfTextures,
+                                                            incrementalTexturePaths);
+        std::vector<graphics::TexturePath> texturePaths;
+        std::vector<graphics::TextureHandle> textureHandles;
+        texturePaths.reserve(incrementalTexturePaths.size());
+        textureHandles.reserve(incrementalTexturePaths.size());
+        for (std::size_t textureIndex = 0; textureIndex < incrementalTexturePaths.size(); textureIndex++)
+        {
+            const auto& texturePath = texturePaths.emplace_back(incrementalTexturePaths[textureIndex]);
+            textureHandles.push_back(rendererPool.getTextureHandle(texturePath));
+        }
+        animationClips.insert({animationType,
+                               std::make_shared<const AnimationClip>(
+                                   std::move(texturePaths), std::move(textureHandles), timeBetweenTextures)});
+    }
+    return animationClips;
+}
+
+AnimationTransitions AnimationsFromSettingsLoader::loadAnimationTransitionsFromSettings(
+    const AnimationTransitionsSettings& animationTransitionsSettings, const AnimationClips& animationClips)
+{
+    AnimationTransitions animationTransitions;
+    animationTransitions.reserve(animationTransitionsSettings.size());
+
+    for (const auto& animationTransitionSettings : animationTransitionsSettings)
+    {
+        const auto sourceAnimationType = toAnimationType(animationTransitionSettings.fromAnimationType);
+        const auto targetAnimationType = toAnimationType(animationTransitionSettings.toAnimationType);
+
+        if (not animationClips.count(sourceAnimationType) || not animationClips.count(targetAnimationType))
+        {
+            throw exceptions::InvalidAnimatorSettings{"Transition between not loaded animations: " +
+                                                      toString(sourceAnimationType) + " -> " +
+                                                      toString(targetAnimationType)};
+        }
+        animationTransitions.push_back(
+            {sourceAnimationType, targetAnimationType, animationTransitionSettings.onAnimationEnd});
     }
+    return animationTransitions;
 }
 }
\ No newline at end of file
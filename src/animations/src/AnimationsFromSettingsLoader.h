@@ -1,17 +1,17 @@
 #pragma once
 
-#include <unordered_map>
-
-#include "Animation.h"
 #include "AnimationSettings.h"
-#include "AnimationType.h"
+#include "AnimationTransitionSettings.h"
+#include "AnimatorDefinition.h"
+#include "RendererPool.h"
 
 namespace animations
 {
 class AnimationsFromSettingsLoader
 {
 public:
-    static void loadAnimationsFromSettings(std::unordered_map<AnimationType, Animation>&,
-                                           const AnimationsSettings&);
+    static AnimationClips loadAnimationClipsFromSettings(const AnimationsSettings&, graphics::RendererPool&);
+    static AnimationTransitions loadAnimationTransitionsFromSettings(const AnimationTransitionsSettings&,
+                                                                     const AnimationClips&);
 };
-}
\ No newline at end of file
+}
@@ -2,8 +2,11 @@
 
 #include "gtest/gtest.h"
 
+#include "RendererPoolMock.h"
+
 #include "GetProjectPath.h"
 #include "exceptions/AnimationsFromSettingsNotFound.h"
+#include "exceptions/InvalidAnimatorSettings.h"
 
 using namespace ::testing;
 using namespace animations;
@@ -11,38 +14,112 @@ using namespace animations;
 class AnimationsFromSettingsLoaderTest : public Test
 {
 public:
-    const std::vector<std::string> textures{"1", "2", "3"};
-    const Animation animation{textures, 60};
-    std::unordered_map<AnimationType, Animation> nonEmptyAnimations{{AnimationType::Jump, animation}};
-    std::unordered_map<AnimationType, Animation> animations;
     const AnimationsSettings emptyAnimationsSettings{};
     const std::string projectPath{utils::getProjectPath("chimarrao-platformer")};
     const AnimationsSettings animationsSettings{{"idle", "dev/x1.txt", 3, 0.4},
                                                 {"walk", "elo/123.txt", 2, 0.7}};
+    const AnimationsSettings spriteSheetAnimationsSettings{
+        {"walk", "", 0, 0.1, SpriteSheetSettings{"dev/sheet.png", 2, 3, 16, 24, 5}}};
+    const AnimationsSettings spriteSheetAnimationsSettingsWithTooManyFrames{
+        {"walk", "", 0, 0.1, SpriteSheetSettings{"dev/sheet.png", 2, 3, 16, 24, 7}}};
+    const AnimationsSettings animationsSettingsWithZeroTimeBetweenTextures{{"idle", "dev/x1.txt", 3, 0}};
+    const AnimationsSettings spriteSheetAnimationsSettingsWithNegativeTimeBetweenTextures{
+        {"walk", "", 0, -0.1, SpriteSheetSettings{"dev/sheet.png", 2, 3, 16, 24, 5}}};
+    StrictMock<graphics::RendererPoolMock> rendererPool;
 };
 
 TEST_F(AnimationsFromSettingsLoaderTest, givenEmptyAnimationsSettings_shouldThrowAnimationsNotFound)
 {
     ASSERT_THROW(
-        AnimationsFromSettingsLoader::loadAnimationsFromSettings(animations, emptyAnimationsSettings),
+        AnimationsFromSettingsLoader::loadAnimationClipsFromSettings(emptyAnimationsSettings, rendererPool),
         exceptions::AnimationsFromSettingsNotFound);
 }
 
-TEST_F(AnimationsFromSettingsLoaderTest, shouldLoadAnimationsFromSettings)
+TEST_F(AnimationsFromSettingsLoaderTest, shouldLoadAnimationClipsWithResolvedTextureHandlesFromSettings)
 {
-    AnimationsFromSettingsLoader::loadAnimationsFromSettings(animations, animationsSettings);
+    EXPECT_CALL(rendererPool, getTextureHandle(projectPath + "dev/x1.txt")).WillOnce(Return(0));
+    EXPECT_CALL(rendererPool, getTextureHandle(projectPath + "dev/x2.txt")).WillOnce(Return(1));
+    EXPECT_CALL(rendererPool, getTextureHandle(projectPath + "dev/x3.txt")).WillOnce(Return(2));
+    EXPECT_CALL(rendererPool, getTextureHandle(projectPath + "elo/123.txt")).WillOnce(Return(3));
+    EXPECT_CALL(rendererPool, getTextureHandle(projectPath + "elo/124.txt")).WillOnce(Return(4));
+
+    const auto animationClips =
+        AnimationsFromSettingsLoader::loadAnimationClipsFromSettings(animationsSettings, rendererPool);
+
+    ASSERT_EQ(animationClips.size(), animationsSettings.size());
+    ASSERT_TRUE(animationClips.count(AnimationType::Jump) == 0);
+    const auto& idleClip = *animationClips.at(AnimationType::Idle);
+    ASSERT_EQ(idleClip.getNumberOfTextures(), 3u);
+    ASSERT_EQ(idleClip.getTexturePath(0), projectPath + "dev/x1.txt");
+    ASSERT_EQ(idleClip.getTextureHandle(0), 0u);
+    ASSERT_EQ(idleClip.getTextureHandle(2), 2u);
+    ASSERT_FLOAT_EQ(idleClip.getTimeBetweenTextures(), 0.4f);
+    const auto& walkClip = *animationClips.at(AnimationType::Walk);
+    ASSERT_EQ(walkClip.getNumberOfTextures(), 2u);
+    ASSERT_EQ(walkClip.getTexturePath(1), projectPath + "elo/124.txt");
+    ASSERT_EQ(walkClip.getTextureHandle(1), 4u);
+}
+
+TEST_F(AnimationsFromSettingsLoaderTest,
+       givenSpriteSheetSettings_shouldLoadClipWithSingleTextureHandleAndRowMajorTextureRects)
+{
+    EXPECT_CALL(rendererPool, getTextureHandle(projectPath + "dev/sheet.png")).WillOnce(Return(7));
+
+    const auto animationClips = AnimationsFromSettingsLoader::loadAnimationClipsFromSettings(
+        spriteSheetAnimationsSettings, rendererPool);
+
+    const auto& walkClip = *animationClips.at(AnimationType::Walk);
+    ASSERT_EQ(walkClip.getNumberOfTextures(), 5u);
+    ASSERT_TRUE(walkClip.hasTextureRects());
+    ASSERT_EQ(walkClip.getTexturePaths(), std::vector<std::string>{projectPath + "dev/sheet.png"});
+    ASSERT_EQ(walkClip.getTexturePath(4), projectPath + "dev/sheet.png");
+    ASSERT_EQ(walkClip.getTextureHandle(4), 7u);
+    ASSERT_EQ(walkClip.getTextureRect(0), (utils::IntRect{0, 0, 16, 24}));
+    ASSERT_EQ(walkClip.getTextureRect(2), (utils::IntRect{32, 0, 16, 24}));
+    ASSERT_EQ(walkClip.getTextureRect(4), (utils::IntRect{16, 24, 16, 24}));
+    ASSERT_FLOAT_EQ(walkClip.getTimeBetweenTextures(), 0.1f);
+}
+
+TEST_F(AnimationsFromSettingsLoaderTest,
+       givenSpriteSheetWithMoreFramesThanGridCells_shouldThrowInvalidAnimatorSettings)
+{
+    ASSERT_THROW(AnimationsFromSettingsLoader::loadAnimationClipsFromSettings(
+                     spriteSheetAnimationsSettingsWithTooManyFrames, rendererPool),
+                 exceptions::InvalidAnimatorSettings);
+}
+
+TEST_F(AnimationsFromSettingsLoaderTest,
+       givenNonPositiveTimeBetweenTextures_shouldThrowInvalidAnimatorSettings)
+{
+    ASSERT_THROW(AnimationsFromSettingsLoader::loadAnimationClipsFromSettings(
+                     animationsSettingsWithZeroTimeBetweenTextures, rendererPool),
+                 exceptions::InvalidAnimatorSettings);
+    ASSERT_THROW(AnimationsFromSettingsLoader::loadAnimationClipsFromSettings(
+                     spriteSheetAnimationsSettingsWithNegativeTimeBetweenTextures, rendererPool),
+                 exceptions::InvalidAnimatorSettings);
+}
+
+TEST_F(AnimationsFromSettingsLoaderTest, shouldLoadAnimationTransitionsFromSettings)
+{
+    const AnimationClips animationClips{{AnimationType::Idle, nullptr}, {AnimationType::Attack, nullptr}};
+    const AnimationTransitionsSettings animationTransitionsSettings{{"idle", "attack", false},
+                                                                    {"attack", "idle", true}};
+
+    const auto animationTransitions = AnimationsFromSettingsLoader::loadAnimationTransitionsFromSettings(
+        animationTransitionsSettings, animationClips);
 
-    ASSERT_EQ(animations.at(AnimationType::Idle).getCurrentTexturePath(), projectPath + "dev/x1.txt");
-    ASSERT_EQ(animations.at(AnimationType::Walk).getCurrentTexturePath(), projectPath + "elo/123.txt");
+    ASSERT_EQ(animationTransitions,
+              (AnimationTransitions{{AnimationType::Idle, AnimationType::Attack, false},
+                                    {AnimationType::Attack, AnimationType::Idle, true}}));
 }
 
 TEST_F(AnimationsFromSettingsLoaderTest,
-       givenNonEmptyAnimations_shouldClearAnimationsAndLoadAnimationsFromSettings)
+       givenTransitionToAnimationNotLoaded_shouldThrowInvalidAnimatorSettings)
 {
-    AnimationsFromSettingsLoader::loadAnimationsFromSettings(nonEmptyAnimations, animationsSettings);
+    const AnimationClips animationClips{{AnimationType::Idle, nullptr}};
+    const AnimationTransitionsSettings animationTransitionsSettings{{"idle", "attack", false}};
 
-    ASSERT_TRUE(nonEmptyAnimations.count(AnimationType::Jump) == 0);
-    ASSERT_EQ(nonEmptyAnimations.at(AnimationType::Idle).getCurrentTexturePath(), projectPath + "dev/x1.txt");
-    ASSERT_EQ(nonEmptyAnimations.at(AnimationType::Walk).getCurrentTexturePath(),
-              projectPath + "elo/123.txt");
+    ASSERT_THROW(AnimationsFromSettingsLoader::loadAnimationTransitionsFromSettings(
+                     animationTransitionsSettings, animationClips),
+                 exceptions::InvalidAnimatorSettings);
 }
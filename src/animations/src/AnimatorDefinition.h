@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "AnimationClip.h"
+#include "AnimationTransition.h"
+#include "AnimationType.h"
+
+namespace animations
+{
+using AnimationClips = std::unordered_map<AnimationType, std::shared_ptr<const AnimationClip>>;
+
+struct AnimatorDefinition
+{
+    std::string animatorName;
+    AnimationClips animationClips;
+    AnimationType initialAnimationType;
+    AnimationTransitions animationTransitions;
+    std::size_t revision{0};
+};
+}
@@ -13,6 +13,7 @@ public:
     MOCK_METHOD(void, setAnimation, (AnimationType), (override));
     MOCK_METHOD(void, setAnimation, (AnimationType, AnimationDirection), (override));
     MOCK_METHOD(void, setAnimationDirection, (AnimationDirection), (override));
+    MOCK_METHOD(void, setVisible, (bool), (override));
     MOCK_METHOD(AnimationType, getAnimationType, (), (const override));
     MOCK_METHOD(AnimationDirection, getAnimationDirection, (), (const override));
 };
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "AnimationSettings.h"
+#include "AnimationTransitionSettings.h"
 #include "StlOperators.h"
 
 namespace animations
@@ -13,12 +14,14 @@ struct AnimatorSettings
 {
     std::string animatorName;
     std::vector<AnimationSettings> animationsSettings;
+    AnimationTransitionsSettings animationTransitionsSettings;
 };
 
 inline bool operator==(const AnimatorSettings& lhs, const AnimatorSettings& rhs)
 {
     auto tieStruct = [](const AnimatorSettings& settings) {
-        return std::tie(settings.animatorName, settings.animationsSettings);
+        return std::tie(settings.animatorName, settings.animationsSettings,
+                        settings.animationTransitionsSettings);
     };
     return tieStruct(lhs) == tieStruct(rhs);
 }
@@ -26,7 +29,8 @@ inline bool operator==(const AnimatorSettings& lhs, const AnimatorSettings& rhs)
 inline std::ostream& operator<<(std::ostream& os, const AnimatorSettings& animatorSettings)
 {
     return os << "animatorName: " << animatorSettings.animatorName
-              << " animationsSettings: " << animatorSettings.animationsSettings;
+              << " animationsSettings: " << animatorSettings.animationsSettings
+              << " animationTransitionsSettings: " << animatorSettings.animationTransitionsSettings;
 }
 
 using AnimatorsSettings = std::vector<AnimatorSettings>;
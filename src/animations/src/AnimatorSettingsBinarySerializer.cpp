@@ -0,0 +1,179 @@
+#include "AnimatorSettingsBinarySerializer.h"
+
+#include "BinaryReader.h"
+#include "BinaryWriter.h"
+
+namespace animations
+{
+namespace
+{
+constexpr std::uint32_t magicNumber{0x53544e41};
+constexpr std::uint32_t formatVersion{2};
+
+boost::optional<SpriteSheetSettings> readSpriteSheetSettings(utils::BinaryReader& reader)
+{
+    const auto texturePath = reader.readString();
+    const auto rows = reader.read<std::int32_t>();
+    const auto columns = reader.read<std::int32_t>();
+    const auto frameWidth = reader.read<std::int32_t>();
+    const auto frameHeight = reader.read<std::int32_t>();
+    const auto numberOfFrames = reader.read<std::int32_t>();
+
+    if (not texturePath || not rows || not columns || not frameWidth || not frameHeight ||
+        not numberOfFrames)
+    {
+        return boost::none;
+    }
+    return SpriteSheetSettings{*texturePath, *rows, *columns, *frameWidth, *frameHeight, *numberOfFrames};
+}
+
+boost::optional<AnimationSettings> readAnimationSettings(utils::BinaryReader& reader)
+{
+    const auto animationType = reader.readString();
+    const auto firstTexturePath = reader.readString();
+    const auto numberOfTextures = reader.read<std::int32_t>();
+    const auto timeBetweenTexturesInSeconds = reader.read<float>();
+    const auto hasSpriteSheetSettings = reader.read<std::uint8_t>();
+
+    if (not animationType || not firstTexturePath || not numberOfTextures ||
+        not timeBetweenTexturesInSeconds || not hasSpriteSheetSettings)
+    {
+        return boost::none;
+    }
+
+    boost::optional<SpriteSheetSettings> spriteSheetSettings;
+    if (*hasSpriteSheetSettings != 0)
+    {
+        spriteSheetSettings = readSpriteSheetSettings(reader);
+        if (not spriteSheetSettings)
+        {
+            return boost::none;
+        }
+    }
+    return AnimationSettings{*animationType, *firstTexturePath, *numberOfTextures,
+                             *timeBetweenTexturesInSeconds, spriteSheetSettings};
+}
+
+boost::optional<AnimationTransitionSettings> readAnimationTransitionSettings(utils::BinaryReader& reader)
+{
+    const auto fromAnimationType = reader.readString();
+    const auto toAnimationType = reader.readString();
+    const auto onAnimationEnd = reader.read<std::uint8_t>();
+
+    if (not fromAnimationType || not toAnimationType || not onAnimationEnd)
+    {
+        return boost::none;
+    }
+    return AnimationTransitionSettings{*fromAnimationType, *toAnimationType, *onAnimationEnd != 0};
+}
+
+template <typename Settings, typename ReadSettings>
+boost::optional<std::vector<Settings>> readSettingsVector(utils::BinaryReader& reader,
+                                                          ReadSettings readSettings)
+{
+    const auto numberOfSettings = reader.read<std::uint32_t>();
+    if (not numberOfSettings || *numberOfSettings > reader.getNumberOfRemainingBytes())
+    {
+        return boost::none;
+    }
+
+    std::vector<Settings> settings;
+    settings.reserve(*numberOfSettings);
+    for (std::uint32_t settingsIndex = 0; settingsIndex < *numberOfSettings; settingsIndex++)
+    {
+        auto singleSettings = readSettings(reader);
+        if (not singleSettings)
+        {
+            return boost::none;
+        }
+        settings.push_back(std::move(*singleSettings));
+    }
+    return settings;
+}
+
+boost::optional<AnimatorSettings> readAnimatorSettings(utils::BinaryReader& reader)
+{
+    const auto animatorName = reader.readString();
+    if (not animatorName)
+    {
+        return boost::none;
+    }
+    const auto animationsSettings = readSettingsVector<AnimationSettings>(reader, readAnimationSettings);
+    if (not animationsSettings)
+    {
+        return boost::none;
+    }
+    const auto animationTransitionsSettings =
+        readSettingsVector<AnimationTransitionSettings>(reader, readAnimationTransitionSettings);
+    if (not animationTransitionsSettings)
+    {
+        return boost::none;
+    }
+    return AnimatorSettings{*animatorName, *animationsSettings, *animationTransitionsSettings};
+}
+}
+
+std::string AnimatorSettingsBinarySerializer::serialize(const AnimatorsSettings& animatorsSettings,
+                                                        std::uint64_t sourceHash)
+{
+    utils::BinaryWriter writer;
+    writer.write(magicNumber);
+    writer.write(formatVersion);
+    writer.write(sourceHash);
+
+    writer.write(static_cast<std::uint32_t>(animatorsSettings.size()));
+    for (const auto& animatorSettings : animatorsSettings)
+    {
+        writer.writeString(animatorSettings.animatorName);
+
+        writer.write(static_cast<std::uint32_t>(animatorSettings.animationsSettings.size()));
+        for (const auto& animationSettings : animatorSettings.animationsSettings)
+        {
+            writer.writeString(animationSettings.animationType);
+            writer.writeString(animationSettings.firstTexturePath);
+            writer.write(static_cast<std::int32_t>(animationSettings.numberOfTextures));
+            writer.write(animationSettings.timeBetweenTexturesInSeconds);
+            writer.write(static_cast<std::uint8_t>(animationSettings.spriteSheetSettings.has_value()));
+            if (const auto& spriteSheetSettings = animationSettings.spriteSheetSettings)
+            {
+                writer.writeString(spriteSheetSettings->texturePath);
+                writer.write(static_cast<std::int32_t>(spriteSheetSettings->rows));
+                writer.write(static_cast<std::int32_t>(spriteSheetSettings->columns));
+                writer.write(static_cast<std::int32_t>(spriteSheetSettings->frameWidth));
+                writer.write(static_cast<std::int32_t>(spriteSheetSettings->frameHeight));
+                writer.write(static_cast<std::int32_t>(spriteSheetSettings->numberOfFrames));
+            }
+        }
+
+        writer.write(static_cast<std::uint32_t>(animatorSettings.animationTransitionsSettings.size()));
+        for (const auto& transitionSettings : animatorSettings.animationTransitionsSettings)
+        {
+            writer.writeString(transitionSettings.fromAnimationType);
+            writer.writeString(transitionSettings.toAnimationType);
+            writer.write(static_cast<std::uint8_t>(transitionSettings.onAnimationEnd));
+        }
+    }
+
+    return writer.getBuffer();
+}
+
+boost::optional<AnimatorsSettings>
+AnimatorSettingsBinarySerializer::deserialize(const std::string& buffer, std::uint64_t expectedSourceHash)
+{
+    utils::BinaryReader reader{buffer};
+
+    if (reader.read<std::uint32_t>() != magicNumber || reader.read<std::uint32_t>() != formatVersion ||
+        reader.read<std::uint64_t>() != expectedSourceHash)
+    {
+        return boost::none;
+    }
+
+    auto animatorsSettings = readSettingsVector<AnimatorSettings>(reader, readAnimatorSettings);
+    if (not animatorsSettings || reader.getNumberOfRemainingBytes() != 0)
+    {
+        return boost::none;
+    }
+    return animatorsSettings;
+}
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <string>
+
+#include "AnimatorSettings.h"
+
+namespace animations
+{
+class AnimatorSettingsBinarySerializer
+{
+public:
+    static std::string serialize(const AnimatorsSettings&, std::uint64_t sourceHash);
+    static boost::optional<AnimatorsSettings> deserialize(const std::string& buffer,
+                                                          std::uint64_t expectedSourceHash);
+};
+}
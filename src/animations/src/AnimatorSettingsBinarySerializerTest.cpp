@@ -0,0 +1,69 @@
+#include "AnimatorSettingsBinarySerializer.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace animations;
+
+class AnimatorSettingsBinarySerializerTest : public Test
+{
+public:
+    const std::uint64_t sourceHash{0x1234567890abcdef};
+    const std::uint64_t differentSourceHash{0xfedcba0987654321};
+    const AnimationsSettings animationsSettings{
+        {"idle", "resources/Player/Idle/idle-with-weapon-1.png", 6, 0.2f},
+        {"attack", "resources/Player/Attack/attack-A1.png", 8, 0.1f},
+        {"walk", "", 0, 0.15f, SpriteSheetSettings{"resources/Player/walk-sheet.png", 2, 4, 32, 32, 7}}};
+    const AnimationTransitionsSettings transitionsSettings{{"idle", "attack", false},
+                                                           {"attack", "idle", true}};
+    const AnimatorsSettings animatorsSettings{{"player", animationsSettings, transitionsSettings},
+                                              {"enemy1", {animationsSettings[0]}, {}}};
+};
+
+TEST_F(AnimatorSettingsBinarySerializerTest,
+       givenSerializedSettingsWithSameSourceHash_shouldReturnSameSettings)
+{
+    const auto buffer = AnimatorSettingsBinarySerializer::serialize(animatorsSettings, sourceHash);
+
+    const auto actualAnimatorsSettings = AnimatorSettingsBinarySerializer::deserialize(buffer, sourceHash);
+
+    ASSERT_TRUE(actualAnimatorsSettings);
+    ASSERT_EQ(*actualAnimatorsSettings, animatorsSettings);
+}
+
+TEST_F(AnimatorSettingsBinarySerializerTest, givenEmptySettings_shouldReturnEmptySettings)
+{
+    const auto buffer = AnimatorSettingsBinarySerializer::serialize({}, sourceHash);
+
+    const auto actualAnimatorsSettings = AnimatorSettingsBinarySerializer::deserialize(buffer, sourceHash);
+
+    ASSERT_TRUE(actualAnimatorsSettings);
+    ASSERT_TRUE(actualAnimatorsSettings->empty());
+}
+
+TEST_F(AnimatorSettingsBinarySerializerTest, givenDifferentSourceHash_shouldReturnNone)
+{
+    const auto buffer = AnimatorSettingsBinarySerializer::serialize(animatorsSettings, sourceHash);
+
+    ASSERT_FALSE(AnimatorSettingsBinarySerializer::deserialize(buffer, differentSourceHash));
+}
+
+TEST_F(AnimatorSettingsBinarySerializerTest, givenTruncatedBuffer_shouldReturnNone)
+{
+    const auto buffer = AnimatorSettingsBinarySerializer::serialize(animatorsSettings, sourceHash);
+    const auto truncatedBuffer = buffer.substr(0, buffer.size() - 1);
+
+    ASSERT_FALSE(AnimatorSettingsBinarySerializer::deserialize(truncatedBuffer, sourceHash));
+}
+
+TEST_F(AnimatorSettingsBinarySerializerTest, givenBufferWithTrailingBytes_shouldReturnNone)
+{
+    const auto buffer = AnimatorSettingsBinarySerializer::serialize(animatorsSettings, sourceHash);
+
+    ASSERT_FALSE(AnimatorSettingsBinarySerializer::deserialize(buffer + "x", sourceHash));
+}
+
+TEST_F(AnimatorSettingsBinarySerializerTest, givenBufferWithoutMagicNumber_shouldReturnNone)
+{
+    ASSERT_FALSE(AnimatorSettingsBinarySerializer::deserialize("animators:", sourceHash));
+}
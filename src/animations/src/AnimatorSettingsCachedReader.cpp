@@ -0,0 +1,50 @@
+#include "AnimatorSettingsCachedReader.h"
+
+#include "AnimatorSettingsBinarySerializer.h"
+#include "BinaryFile.h"
+#include "ContentHash.h"
+
+namespace animations
+{
+namespace
+{
+const std::string cacheFileExtension{".cache"};
+}
+
+AnimatorSettingsCachedReader::AnimatorSettingsCachedReader(
+    std::unique_ptr<AnimatorSettingsReader> sourceReaderInit)
+    : sourceReader{std::move(sourceReaderInit)}
+{
+}
+
+AnimatorsSettings AnimatorSettingsCachedReader::readAnimatorsSettings(const utils::FilePath& filePath) const
+{
+    const auto sourceContent = utils::readBinaryFile(filePath);
+    if (not sourceContent)
+    {
+        return sourceReader->readAnimatorsSettings(filePath);
+    }
+
+    const auto sourceHash = utils::calculateContentHash(*sourceContent);
+    const auto cacheFilePath = getCacheFilePath(filePath);
+
+    if (const auto cacheContent = utils::readBinaryFile(cacheFilePath))
+    {
+        if (auto cachedSettings = AnimatorSettingsBinarySerializer::deserialize(*cacheContent, sourceHash))
+        {
+            return std::move(*cachedSettings);
+        }
+    }
+
+    auto animatorsSettings = sourceReader->readAnimatorsSettings(filePath);
+    utils::writeBinaryFile(cacheFilePath,
+                           AnimatorSettingsBinarySerializer::serialize(animatorsSettings, sourceHash));
+    return animatorsSettings;
+}
+
+utils::FilePath AnimatorSettingsCachedReader::getCacheFilePath(const utils::FilePath& filePath)
+{
+    return filePath + cacheFileExtension;
+}
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+
+#include "AnimatorSettingsReader.h"
+
+namespace animations
+{
+class AnimatorSettingsCachedReader : public AnimatorSettingsReader
+{
+public:
+    explicit AnimatorSettingsCachedReader(std::unique_ptr<AnimatorSettingsReader> sourceReader);
+
+    AnimatorsSettings readAnimatorsSettings(const utils::FilePath&) const override;
+
+    static utils::FilePath getCacheFilePath(const utils::FilePath&);
+
+private:
+    std::unique_ptr<AnimatorSettingsReader> sourceReader;
+};
+}
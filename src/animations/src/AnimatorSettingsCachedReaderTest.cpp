@@ -0,0 +1,111 @@
+#include "AnimatorSettingsCachedReader.h"
+
+#include <filesystem>
+
+#include "gtest/gtest.h"
+
+#include "AnimatorSettingsReaderMock.h"
+
+#include "BinaryFile.h"
+
+using namespace ::testing;
+using namespace animations;
+
+class AnimatorSettingsCachedReaderTest : public Test
+{
+public:
+    AnimatorSettingsCachedReaderTest()
+    {
+        utils::writeBinaryFile(sourceFilePath, sourceContent);
+    }
+
+    ~AnimatorSettingsCachedReaderTest()
+    {
+        std::filesystem::remove(sourceFilePath);
+        std::filesystem::remove(cacheFilePath);
+    }
+
+    std::unique_ptr<AnimatorSettingsCachedReader> createCachedReader()
+    {
+        auto sourceReaderInit = std::make_unique<StrictMock<AnimatorSettingsReaderMock>>();
+        sourceReader = sourceReaderInit.get();
+        return std::make_unique<AnimatorSettingsCachedReader>(std::move(sourceReaderInit));
+    }
+
+    const utils::FilePath sourceFilePath{
+        (std::filesystem::temp_directory_path() / "AnimatorSettingsCachedReaderTest.yaml").string()};
+    const utils::FilePath cacheFilePath{AnimatorSettingsCachedReader::getCacheFilePath(sourceFilePath)};
+    const utils::FilePath nonExistingFilePath{
+        (std::filesystem::temp_directory_path() / "nonExistingAnimatorsConfig.yaml").string()};
+    const std::string sourceContent{"animators:\n  - name: player\n"};
+    const std::string modifiedSourceContent{"animators:\n  - name: enemy\n"};
+    const AnimatorsSettings animatorsSettings{
+        {"player", {{"idle", "resources/Player/Idle/idle-with-weapon-1.png", 6, 0.2f}}, {}}};
+    const AnimatorsSettings modifiedAnimatorsSettings{
+        {"enemy", {{"idle", "resources/1 Enemy/Idle/idle-1.png", 4, 0.3f}}, {}}};
+    StrictMock<AnimatorSettingsReaderMock>* sourceReader;
+};
+
+TEST_F(AnimatorSettingsCachedReaderTest,
+       givenNoCacheFile_shouldReadSettingsFromSourceReaderAndCreateCacheFile)
+{
+    const auto cachedReader = createCachedReader();
+    EXPECT_CALL(*sourceReader, readAnimatorsSettings(sourceFilePath)).WillOnce(Return(animatorsSettings));
+
+    const auto actualAnimatorsSettings = cachedReader->readAnimatorsSettings(sourceFilePath);
+
+    ASSERT_EQ(actualAnimatorsSettings, animatorsSettings);
+    ASSERT_TRUE(std::filesystem::exists(cacheFilePath));
+}
+
+TEST_F(AnimatorSettingsCachedReaderTest, givenValidCacheFile_shouldReturnSettingsWithoutReadingSource)
+{
+    const auto firstCachedReader = createCachedReader();
+    EXPECT_CALL(*sourceReader, readAnimatorsSettings(sourceFilePath)).WillOnce(Return(animatorsSettings));
+    firstCachedReader->readAnimatorsSettings(sourceFilePath);
+    const auto secondCachedReader = createCachedReader();
+
+    const auto actualAnimatorsSettings = secondCachedReader->readAnimatorsSettings(sourceFilePath);
+
+    ASSERT_EQ(actualAnimatorsSettings, animatorsSettings);
+}
+
+TEST_F(AnimatorSettingsCachedReaderTest,
+       givenSourceFileChangedAfterCaching_shouldReadSettingsFromSourceReader)
+{
+    const auto firstCachedReader = createCachedReader();
+    EXPECT_CALL(*sourceReader, readAnimatorsSettings(sourceFilePath)).WillOnce(Return(animatorsSettings));
+    firstCachedReader->readAnimatorsSettings(sourceFilePath);
+    utils::writeBinaryFile(sourceFilePath, modifiedSourceContent);
+    const auto secondCachedReader = createCachedReader();
+    EXPECT_CALL(*sourceReader, readAnimatorsSettings(sourceFilePath))
+        .WillOnce(Return(modifiedAnimatorsSettings));
+
+    const auto actualAnimatorsSettings = secondCachedReader->readAnimatorsSettings(sourceFilePath);
+
+    ASSERT_EQ(actualAnimatorsSettings, modifiedAnimatorsSettings);
+}
+
+TEST_F(AnimatorSettingsCachedReaderTest, givenCorruptedCacheFile_shouldReadSettingsFromSourceReader)
+{
+    utils::writeBinaryFile(cacheFilePath, "corrupted");
+    const auto cachedReader = createCachedReader();
+    EXPECT_CALL(*sourceReader, readAnimatorsSettings(sourceFilePath)).WillOnce(Return(animatorsSettings));
+
+    const auto actualAnimatorsSettings = cachedReader->readAnimatorsSettings(sourceFilePath);
+
+    ASSERT_EQ(actualAnimatorsSettings, animatorsSettings);
+}
+
+TEST_F(AnimatorSettingsCachedReaderTest, givenNonExistingSourceFile_shouldDelegateToSourceReader)
+{
+    const auto cachedReader = createCachedReader();
+    EXPECT_CALL(*sourceReader, readAnimatorsSettings(nonExistingFilePath))
+        .WillOnce(Return(AnimatorsSettings{}));
+
+    const auto actualAnimatorsSettings = cachedReader->readAnimatorsSettings(nonExistingFilePath);
+
+    ASSERT_TRUE(actualAnimatorsSettings.empty());
+    ASSERT_FALSE(
+        std::filesystem::exists(AnimatorSettingsCachedReader::getCacheFilePath(nonExistingFilePath)));
+}
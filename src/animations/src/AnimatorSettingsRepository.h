@@ -12,5 +12,6 @@ public:
     virtual ~AnimatorSettingsRepository() = default;
 
     virtual boost::optional<AnimatorSettings> getAnimatorSettings(const std::string& animatorName) const = 0;
+    virtual void reloadAnimatorsSettings() = 0;
 };
 }
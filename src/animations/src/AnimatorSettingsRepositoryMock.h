@@ -11,5 +11,6 @@ class AnimatorSettingsRepositoryMock : public AnimatorSettingsRepository
 public:
     MOCK_METHOD(boost::optional<AnimatorSettings>, getAnimatorSettings, (const std::string& animatorName),
                 (const override));
+    MOCK_METHOD(void, reloadAnimatorsSettings, (), (override));
 };
 }
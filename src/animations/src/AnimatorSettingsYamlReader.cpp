@@ -4,6 +4,8 @@
 
 #include "yaml-cpp/yaml.h"
 
+#include "AllocationTracker.h"
+#include "FrameProfiler.h"
 #include "exceptions/AnimatorsConfigFileNotFound.h"
 #include "exceptions/InvalidAnimatorsConfigFile.h"
 
@@ -18,10 +20,23 @@ const auto animationTypeField{"type"};
 const auto firstTexturePathField{"firstTexturePath"};
 const auto numberOfTexturesField{"numberOfTextures"};
 const auto timeBetweenTexturesInSecondsField{"timeBetweenTexturesInSeconds"};
+const auto spriteSheetField{"spriteSheet"};
+const auto spriteSheetTexturePathField{"texturePath"};
+const auto spriteSheetRowsField{"rows"};
+const auto spriteSheetColumnsField{"columns"};
+const auto spriteSheetFrameWidthField{"frameWidth"};
+const auto spriteSheetFrameHeightField{"frameHeight"};
+const auto spriteSheetNumberOfFramesField{"numberOfFrames"};
+const auto transitionsField{"transitions"};
+const auto transitionFromField{"from"};
+const auto transitionToField{"to"};
+const auto transitionOnAnimationEndField{"onAnimationEnd"};
 }
 
 AnimatorsSettings AnimatorSettingsYamlReader::readAnimatorsSettings(const utils::FilePath& yamlFilePath) const
 {
+    PROFILE_ZONE("AnimatorSettingsYamlReader::readAnimatorsSettings");
+    ALLOCATION_TAG(Animations);
     try
     {
         const auto animatorsConfig = loadYamlFile(yamlFilePath);
@@ -70,7 +85,11 @@ AnimatorsSettings AnimatorSettingsYamlReader::readAnimatorsSettings(const YAML::
             throw exceptions::InvalidAnimatorsConfigFile{errorMessage};
         }
         const auto animationsSettings = readAnimationsSettings(animations);
-        animatorsSettings.push_back({animatorName.as<std::string>(), animationsSettings});
+        const auto transitions = animator[transitionsField];
+        const auto animationTransitionsSettings =
+            transitions ? readAnimationTransitionsSettings(transitions) : AnimationTransitionsSettings{};
+        animatorsSettings.push_back(
+            {animatorName.as<std::string>(), animationsSettings, animationTransitionsSettings});
     }
     return animatorsSettings;
 }
@@ -85,6 +104,15 @@ AnimationsSettings AnimatorSettingsYamlReader::readAnimationsSettings(const YAML
         const auto firstTexturePath = animation[firstTexturePathField];
         const auto numberOfTextures = animation[numberOfTexturesField];
         const auto timeBetweenTexturesInSeconds = animation[timeBetweenTexturesInSecondsField];
+        const auto spriteSheet = animation[spriteSheetField];
+
+        if (type && timeBetweenTexturesInSeconds && spriteSheet)
+        {
+            animationsSettings.push_back({type.as<std::string>(), "", 0,
+                                          timeBetweenTexturesInSeconds.as<float>(),
+                                          readSpriteSheetSettings(spriteSheet)});
+            continue;
+        }
 
         if (not type || not firstTexturePath || not numberOfTextures || not timeBetweenTexturesInSeconds)
         {
@@ -99,4 +127,47 @@ AnimationsSettings AnimatorSettingsYamlReader::readAnimationsSettings(const YAML
     return animationsSettings;
 }
 
+SpriteSheetSettings AnimatorSettingsYamlReader::readSpriteSheetSettings(const YAML::Node& spriteSheet) const
+{
+    const auto texturePath = spriteSheet[spriteSheetTexturePathField];
+    const auto rows = spriteSheet[spriteSheetRowsField];
+    const auto columns = spriteSheet[spriteSheetColumnsField];
+    const auto frameWidth = spriteSheet[spriteSheetFrameWidthField];
+    const auto frameHeight = spriteSheet[spriteSheetFrameHeightField];
+    const auto numberOfFrames = spriteSheet[spriteSheetNumberOfFramesField];
+
+    if (not texturePath || not rows || not columns || not frameWidth || not frameHeight || not numberOfFrames)
+    {
+        auto errorMessage = "Missing fields in sprite sheet";
+        std::cerr << errorMessage << "\n";
+        throw exceptions::InvalidAnimatorsConfigFile{errorMessage};
+    }
+    return {texturePath.as<std::string>(), rows.as<int>(), columns.as<int>(), frameWidth.as<int>(),
+            frameHeight.as<int>(), numberOfFrames.as<int>()};
+}
+
+AnimationTransitionsSettings
+AnimatorSettingsYamlReader::readAnimationTransitionsSettings(const YAML::Node& transitions) const
+{
+    AnimationTransitionsSettings animationTransitionsSettings;
+
+    for (const auto& transition : transitions)
+    {
+        const auto from = transition[transitionFromField];
+        const auto to = transition[transitionToField];
+        const auto onAnimationEnd = transition[transitionOnAnimationEndField];
+
+        if (not from || not to)
+        {
+            auto errorMessage = "Missing fields in transitions";
+            std::cerr << errorMessage << "\n";
+            throw exceptions::InvalidAnimatorsConfigFile{errorMessage};
+        }
+        animationTransitionsSettings.push_back(
+            {from.as<std::string>(), to.as<std::string>(), onAnimationEnd && onAnimationEnd.as<bool>()});
+    }
+
+    return animationTransitionsSettings;
+}
+
 }
\ No newline at end of file
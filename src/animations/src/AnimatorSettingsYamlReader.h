@@ -18,5 +18,7 @@ private:
     YAML::Node loadYamlFile(const utils::FilePath& yamlFilePath) const;
     AnimatorsSettings readAnimatorsSettings(const YAML::Node&) const;
     AnimationsSettings readAnimationsSettings(const YAML::Node&) const;
+    SpriteSheetSettings readSpriteSheetSettings(const YAML::Node&) const;
+    AnimationTransitionsSettings readAnimationTransitionsSettings(const YAML::Node&) const;
 };
 }
\ No newline at end of file
@@ -31,6 +31,13 @@ const std::string configWithEmptyAnimators{testDirectory + "configWithEmptyAnima
 const std::string configWithoutAnimatorsField{testDirectory + "configWithoutAnimatorsField.yaml"};
 const std::string validPathWithOneAnimator{testDirectory + "validConfigWithOneAnimator.yaml"};
 const std::string validPathWithTwoAnimators{testDirectory + "validConfigWithTwoAnimators.yaml"};
+const std::string validPathWithTransitions{testDirectory + "validConfigWithTransitions.yaml"};
+const std::string configWithTransitionWithoutTargetField{testDirectory +
+                                                         "configWithTransitionWithoutTargetField.yaml"};
+const std::string validPathWithSpriteSheetAnimation{testDirectory +
+                                                    "validConfigWithSpriteSheetAnimation.yaml"};
+const std::string configWithSpriteSheetWithoutFrameWidthField{
+    testDirectory + "configWithSpriteSheetWithoutFrameWidthField.yaml"};
 
 const AnimationSettings playerAnimationSettings1{"idle", "resources/Player/Idle/idle-with-weapon-1.png", 6,
                                                  0.3};
@@ -42,9 +49,18 @@ const AnimationSettings enemyAnimationSettings1{"idle", "resources/Enemy/Idle/id
 const AnimationSettings enemyAnimationSettings2{"walk", "resources/Enemy/Walk/walk-with-weapon-1.png", 2,
                                                 0.8};
 const AnimationsSettings enemyAnimationsSettings{enemyAnimationSettings1, enemyAnimationSettings2};
-const AnimatorsSettings animatorsSettings1{{"player", playerAnimationsSettings}};
-const AnimatorsSettings animatorsSettings2{{"player", playerAnimationsSettings},
-                                           {"enemy", enemyAnimationsSettings}};
+const AnimationSettings enemyAttackAnimationSettings{"attack", "resources/Enemy/Attack/attack-1.png", 4, 0.1};
+const AnimationTransitionsSettings enemyAnimationTransitionsSettings{{"idle", "attack", false},
+                                                                     {"attack", "idle", true}};
+const AnimatorsSettings animatorsSettings1{{"player", playerAnimationsSettings, {}}};
+const AnimatorsSettings animatorsSettings2{{"player", playerAnimationsSettings, {}},
+                                           {"enemy", enemyAnimationsSettings, {}}};
+const AnimatorsSettings animatorsSettingsWithTransitions{
+    {"enemy", {enemyAnimationSettings1, enemyAttackAnimationSettings}, enemyAnimationTransitionsSettings}};
+const AnimationSettings enemySpriteSheetAnimationSettings{
+    "walk", "", 0, 0.1, SpriteSheetSettings{"resources/Enemy/Walk/walk-sheet.png", 2, 4, 32, 48, 6}};
+const AnimatorsSettings animatorsSettingsWithSpriteSheetAnimation{
+    {"enemy", {enemyAnimationSettings1, enemySpriteSheetAnimationSettings}, {}}};
 }
 
 class AnimatorSettingsYamlReaderTest : public Test
@@ -140,3 +156,35 @@ TEST_F(AnimatorSettingsYamlReaderTest, givenValidConfigWithTwoAnimators_shouldRe
 
     ASSERT_EQ(actualAnimatorsSettings, animatorsSettings2);
 }
+
+TEST_F(AnimatorSettingsYamlReaderTest,
+       givenConfigFileWithTransitionWithoutTargetField_shouldThrowInvalidAnimatorsConfigFile)
+{
+    ASSERT_THROW(animatorsSettingsReader.readAnimatorsSettings(configWithTransitionWithoutTargetField),
+                 exceptions::InvalidAnimatorsConfigFile);
+}
+
+TEST_F(AnimatorSettingsYamlReaderTest,
+       givenValidConfigWithTransitions_shouldReturnAnimatorsSettingsWithTransitions)
+{
+    const auto actualAnimatorsSettings =
+        animatorsSettingsReader.readAnimatorsSettings(validPathWithTransitions);
+
+    ASSERT_EQ(actualAnimatorsSettings, animatorsSettingsWithTransitions);
+}
+
+TEST_F(AnimatorSettingsYamlReaderTest,
+       givenConfigFileWithSpriteSheetWithoutFrameWidthField_shouldThrowInvalidAnimatorsConfigFile)
+{
+    ASSERT_THROW(animatorsSettingsReader.readAnimatorsSettings(configWithSpriteSheetWithoutFrameWidthField),
+                 exceptions::InvalidAnimatorsConfigFile);
+}
+
+TEST_F(AnimatorSettingsYamlReaderTest,
+       givenValidConfigWithSpriteSheetAnimation_shouldReturnAnimatorsSettingsWithSpriteSheetSettings)
+{
+    const auto actualAnimatorsSettings =
+        animatorsSettingsReader.readAnimatorsSettings(validPathWithSpriteSheetAnimation);
+
+    ASSERT_EQ(actualAnimatorsSettings, animatorsSettingsWithSpriteSheetAnimation);
+}
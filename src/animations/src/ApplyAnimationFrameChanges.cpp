@@ -0,0 +1,23 @@
+#include "ApplyAnimationFrameChanges.h"
+
+namespace animations
+{
+
+void applyAnimationFrameChanges(graphics::RendererPool& rendererPool,
+                                const std::vector<AnimationFrameChange>& frameChanges)
+{
+    for (const auto& frameChange : frameChanges)
+    {
+        if (frameChange.textureRect)
+        {
+            rendererPool.setTexture(frameChange.graphicsId, frameChange.textureHandle,
+                                    *frameChange.textureRect, frameChange.scale);
+        }
+        else
+        {
+            rendererPool.setTexture(frameChange.graphicsId, frameChange.textureHandle, frameChange.scale);
+        }
+    }
+}
+
+}
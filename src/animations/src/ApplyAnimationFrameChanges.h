@@ -0,0 +1,11 @@
+#pragma once
+
+#include <vector>
+
+#include "AnimationFrameChange.h"
+#include "RendererPool.h"
+
+namespace animations
+{
+void applyAnimationFrameChanges(graphics::RendererPool&, const std::vector<AnimationFrameChange>&);
+}
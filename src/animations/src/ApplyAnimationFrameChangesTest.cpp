@@ -0,0 +1,37 @@
+#include "ApplyAnimationFrameChanges.h"
+
+#include "gtest/gtest.h"
+
+#include "RendererPoolMock.h"
+
+#include "GraphicsIdGenerator.h"
+
+using namespace ::testing;
+using namespace animations;
+
+class ApplyAnimationFrameChangesTest : public Test
+{
+public:
+    const graphics::GraphicsId graphicsId1{graphics::GraphicsIdGenerator::generateId()};
+    const graphics::GraphicsId graphicsId2{graphics::GraphicsIdGenerator::generateId()};
+    const graphics::TextureHandle textureHandle1{3};
+    const graphics::TextureHandle textureHandle2{8};
+    const utils::IntRect textureRect{16, 0, 16, 16};
+    const utils::Vector2f scaleLeftDirection{-1, 1};
+    StrictMock<graphics::RendererPoolMock> rendererPool;
+};
+
+TEST_F(ApplyAnimationFrameChangesTest, givenNoFrameChanges_shouldNotSetAnyTexture)
+{
+    applyAnimationFrameChanges(rendererPool, {});
+}
+
+TEST_F(ApplyAnimationFrameChangesTest, shouldSetTextureOfEachChangedFrame)
+{
+    EXPECT_CALL(rendererPool, setTexture(graphicsId1, textureHandle1, utils::Vector2f{1, 1}));
+    EXPECT_CALL(rendererPool, setTexture(graphicsId2, textureHandle2, textureRect, scaleLeftDirection));
+
+    applyAnimationFrameChanges(
+        rendererPool,
+        {{graphicsId1, textureHandle1}, {graphicsId2, textureHandle2, textureRect, scaleLeftDirection}});
+}
@@ -0,0 +1,172 @@
+#include "DefaultAnimator.h"
+
+#include <algorithm>
+
+#include "AllocationTracker.h"
+#include "exceptions/AnimationTypeNotSupported.h"
+
+namespace animations
+{
+namespace
+{
+utils::Vector2f getScale(AnimationDirection animationDirection)
+{
+    return animationDirection == AnimationDirection::Left ? utils::Vector2f{-1, 1} : utils::Vector2f{1, 1};
+}
+}
+
+DefaultAnimator::DefaultAnimator(const graphics::GraphicsId& graphicsId,
+                                 std::shared_ptr<AnimationSystem> animationSystemInit,
+                                 std::shared_ptr<const AnimatorDefinition> animatorDefinitionInit,
+                                 AnimationDirection animationDirectionInit)
+    : animationSystem{std::move(animationSystemInit)},
+      animatorDefinition{std::move(animatorDefinitionInit)},
+      animatorDefinitionRevision{animatorDefinition->revision},
+      currentAnimationType{animatorDefinition->initialAnimationType},
+      currentAnimationDirection{animationDirectionInit},
+      animationId{animationSystem->add(graphicsId, getAnimationClip(currentAnimationType))},
+      newAnimationTypeIsSet{false},
+      newAnimationDirectionIsSet{false}
+{
+    animationSystem->setScale(animationId, getScale(currentAnimationDirection));
+}
+
+DefaultAnimator::~DefaultAnimator()
+{
+    animationSystem->remove(animationId);
+}
+
+AnimationChanged DefaultAnimator::update(const utils::DeltaTime& deltaTime)
+{
+    ALLOCATION_TAG(Animations);
+    if (animatorDefinitionRevision != animatorDefinition->revision)
+    {
+        reloadAnimatorDefinition();
+    }
+
+    if (const auto nextAnimationType = getTransitionOnAnimationEnd(currentAnimationType))
+    {
+        if (animationSystem->willReachClipEnd(animationId, deltaTime))
+        {
+            changeAnimationOnAnimationEnd(*nextAnimationType);
+        }
+    }
+
+    const auto animationChanged = newAnimationTypeIsSet || newAnimationDirectionIsSet;
+    newAnimationTypeIsSet = false;
+    newAnimationDirectionIsSet = false;
+    return animationChanged;
+}
+
+void DefaultAnimator::setAnimation(AnimationType animationType)
+{
+    setAnimation(animationType, currentAnimationDirection);
+}
+
+void DefaultAnimator::setAnimation(AnimationType animationType, AnimationDirection animationDirection)
+{
+    auto animationClip = getAnimationClip(animationType);
+
+    if (currentAnimationType != animationType && isTransitionAllowed(currentAnimationType, animationType))
+    {
+        changeAnimation(animationType, std::move(animationClip));
+    }
+
+    setAnimationDirection(animationDirection);
+}
+
+void DefaultAnimator::setAnimationDirection(AnimationDirection animationDirection)
+{
+    if (currentAnimationDirection != animationDirection)
+    {
+        currentAnimationDirection = animationDirection;
+        animationSystem->setScale(animationId, getScale(animationDirection));
+        animationSystem->reset(animationId);
+        newAnimationDirectionIsSet = true;
+    }
+}
+
+void DefaultAnimator::setVisible(bool visible)
+{
+    animationSystem->setVisible(animationId, visible);
+}
+
+AnimationType DefaultAnimator::getAnimationType() const
+{
+    return currentAnimationType;
+}
+
+AnimationDirection DefaultAnimator::getAnimationDirection() const
+{
+    return currentAnimationDirection;
+}
+
+std::shared_ptr<const AnimationClip> DefaultAnimator::getAnimationClip(AnimationType animationType) const
+{
+    const auto animationClipIter = animatorDefinition->animationClips.find(animationType);
+    if (animationClipIter == animatorDefinition->animationClips.cend())
+    {
+        throw exceptions::AnimationTypeNotSupported{"Animation of type: " + toString(animationType) +
+                                                    " is not supported in " +
+                                                    animatorDefinition->animatorName};
+    }
+    return animationClipIter->second;
+}
+
+bool DefaultAnimator::isTransitionAllowed(AnimationType fromAnimationType,
+                                          AnimationType toAnimationType) const
+{
+    const auto& animationTransitions = animatorDefinition->animationTransitions;
+    if (animationTransitions.empty())
+    {
+        return true;
+    }
+
+    return std::any_of(animationTransitions.cbegin(), animationTransitions.cend(),
+                       [&](const AnimationTransition& transition) {
+                           return not transition.onAnimationEnd &&
+                                  transition.fromAnimationType == fromAnimationType &&
+                                  transition.toAnimationType == toAnimationType;
+                       });
+}
+
+boost::optional<AnimationType>
+DefaultAnimator::getTransitionOnAnimationEnd(AnimationType fromAnimationType) const
+{
+    for (const auto& transition : animatorDefinition->animationTransitions)
+    {
+        if (transition.onAnimationEnd && transition.fromAnimationType == fromAnimationType)
+        {
+            return transition.toAnimationType;
+        }
+    }
+    return boost::none;
+}
+
+void DefaultAnimator::changeAnimation(AnimationType animationType,
+                                      std::shared_ptr<const AnimationClip> animationClip)
+{
+    currentAnimationType = animationType;
+    animationSystem->setClip(animationId, std::move(animationClip));
+    newAnimationTypeIsSet = true;
+}
+
+void DefaultAnimator::changeAnimationOnAnimationEnd(AnimationType animationType)
+{
+    currentAnimationType = animationType;
+    animationSystem->chainClip(animationId, getAnimationClip(animationType));
+    newAnimationTypeIsSet = true;
+}
+
+void DefaultAnimator::reloadAnimatorDefinition()
+{
+    animatorDefinitionRevision = animatorDefinition->revision;
+
+    if (not animatorDefinition->animationClips.count(currentAnimationType))
+    {
+        currentAnimationType = animatorDefinition->initialAnimationType;
+    }
+    changeAnimation(currentAnimationType, getAnimationClip(currentAnimationType));
+}
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <memory>
+
+#include "AnimationDirection.h"
+#include "AnimationSystem.h"
+#include "AnimationType.h"
+#include "Animator.h"
+#include "AnimatorDefinition.h"
+#include "GraphicsId.h"
+
+namespace animations
+{
+class DefaultAnimator : public Animator
+{
+public:
+    DefaultAnimator(const graphics::GraphicsId&, std::shared_ptr<AnimationSystem>,
+                    std::shared_ptr<const AnimatorDefinition>,
+                    AnimationDirection = AnimationDirection::Right);
+    ~DefaultAnimator();
+    DefaultAnimator(const DefaultAnimator&) = delete;
+    DefaultAnimator& operator=(const DefaultAnimator&) = delete;
+
+    AnimationChanged update(const utils::DeltaTime&) override;
+    void setAnimation(AnimationType) override;
+    void setAnimation(AnimationType, AnimationDirection) override;
+    void setAnimationDirection(AnimationDirection) override;
+    void setVisible(bool visible) override;
+    AnimationType getAnimationType() const override;
+    AnimationDirection getAnimationDirection() const override;
+
+private:
+    std::shared_ptr<const AnimationClip> getAnimationClip(AnimationType) const;
+    bool isTransitionAllowed(AnimationType fromAnimationType, AnimationType toAnimationType) const;
+    boost::optional<AnimationType> getTransitionOnAnimationEnd(AnimationType fromAnimationType) const;
+    void changeAnimation(AnimationType, std::shared_ptr<const AnimationClip>);
+    void changeAnimationOnAnimationEnd(AnimationType);
+    void reloadAnimatorDefinition();
+
+    std::shared_ptr<AnimationSystem> animationSystem;
+    std::shared_ptr<const AnimatorDefinition> animatorDefinition;
+    std::size_t animatorDefinitionRevision;
+    AnimationType currentAnimationType;
+    AnimationDirection currentAnimationDirection;
+    AnimationId animationId;
+    bool newAnimationTypeIsSet;
+    bool newAnimationDirectionIsSet;
+};
+}
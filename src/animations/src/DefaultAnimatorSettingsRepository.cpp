@@ -5,21 +5,14 @@
 namespace animations
 {
 
-const std::string DefaultAnimatorSettingsRepository::animatorSettingsFilePath{
+const utils::FilePath DefaultAnimatorSettingsRepository::animatorSettingsFilePath{
     utils::getProjectPath("chimarrao-platformer") + "config/animators.yaml"};
 
 DefaultAnimatorSettingsRepository::DefaultAnimatorSettingsRepository(
     std::unique_ptr<AnimatorSettingsReader> reader)
     : animatorSettingsReader{std::move(reader)}
 {
-    const auto animatorsSettingsAsVector =
-        animatorSettingsReader->readAnimatorsSettings(animatorSettingsFilePath);
-    settings.reserve(animatorsSettingsAsVector.size());
-
-    for (const auto& animatorSettings : animatorsSettingsAsVector)
-    {
-        settings[animatorSettings.animatorName] = animatorSettings;
-    }
+    reloadAnimatorsSettings();
 }
 
 boost::optional<AnimatorSettings>
@@ -33,4 +26,23 @@ DefaultAnimatorSettingsRepository::getAnimatorSettings(const std::string& animat
     return boost::none;
 }
 
+void DefaultAnimatorSettingsRepository::reloadAnimatorsSettings()
+{
+    const auto animatorsSettingsAsVector =
+        animatorSettingsReader->readAnimatorsSettings(animatorSettingsFilePath);
+
+    std::unordered_map<std::string, AnimatorSettings> reloadedSettings;
+    reloadedSettings.reserve(animatorsSettingsAsVector.size());
+    for (const auto& animatorSettings : animatorsSettingsAsVector)
+    {
+        reloadedSettings[animatorSettings.animatorName] = animatorSettings;
+    }
+    settings = std::move(reloadedSettings);
+}
+
+const utils::FilePath& DefaultAnimatorSettingsRepository::getAnimatorSettingsFilePath()
+{
+    return animatorSettingsFilePath;
+}
+
 }
\ No newline at end of file
@@ -14,11 +14,14 @@ public:
     explicit DefaultAnimatorSettingsRepository(std::unique_ptr<AnimatorSettingsReader>);
 
     boost::optional<AnimatorSettings> getAnimatorSettings(const std::string& animatorName) const override;
+    void reloadAnimatorsSettings() override;
+
+    static const utils::FilePath& getAnimatorSettingsFilePath();
 
 private:
     std::unique_ptr<AnimatorSettingsReader> animatorSettingsReader;
     std::unordered_map<std::string, AnimatorSettings> settings;
 
-    static const std::string animatorSettingsFilePath;
+    static const utils::FilePath animatorSettingsFilePath;
 };
 }
@@ -17,7 +17,7 @@ public:
     const std::string existingAnimatorName{"existingAnimatorName"};
     const std::string nonExistingAnimatorName{"nonExistingAnimatorName"};
     const AnimatorsSettings emptyAnimatorsSettings{};
-    const AnimatorSettings animatorSettings{existingAnimatorName, {}};
+    const AnimatorSettings animatorSettings{existingAnimatorName, {}, {}};
     const AnimatorsSettings animatorsSettings{{animatorSettings}};
     std::unique_ptr<StrictMock<AnimatorSettingsReaderMock>> settingsReaderInit =
         std::make_unique<StrictMock<AnimatorSettingsReaderMock>>();
@@ -50,4 +50,16 @@ TEST_F(DefaultAnimatorSettingsRepositoryTest, givenExistingAnimatorName_shouldRe
     const auto actualAnimatorSettings = settingsRepository.getAnimatorSettings(nonExistingAnimatorName);
 
     ASSERT_EQ(actualAnimatorSettings, boost::none);
-}
\ No newline at end of file
+}
+TEST_F(DefaultAnimatorSettingsRepositoryTest,
+       reloadAnimatorsSettings_shouldReplaceSettingsWithSettingsReadAgain)
+{
+    EXPECT_CALL(*settingsReader, readAnimatorsSettings(settingsPath))
+        .WillOnce(Return(animatorsSettings))
+        .WillOnce(Return(emptyAnimatorsSettings));
+    DefaultAnimatorSettingsRepository settingsRepository{std::move(settingsReaderInit)};
+
+    settingsRepository.reloadAnimatorsSettings();
+
+    ASSERT_EQ(settingsRepository.getAnimatorSettings(existingAnimatorName), boost::none);
+}
@@ -0,0 +1,346 @@
+#include "DefaultAnimator.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "GraphicsIdGenerator.h"
+#include "exceptions/AnimationTypeNotSupported.h"
+
+using namespace graphics;
+using namespace animations;
+using namespace ::testing;
+
+class DefaultAnimatorTest_Base : public Test
+{
+public:
+    const GraphicsId graphicsId1{GraphicsIdGenerator::generateId()};
+    const GraphicsId graphicsId2{GraphicsIdGenerator::generateId()};
+    const utils::DeltaTime timeNotExceedingTimeBetweenTextures{1.0};
+    const utils::DeltaTime timeExceedingOneTimeBetweenTextures{1.5};
+    const utils::DeltaTime timeExceedingTimeBetweenTextures{2.5};
+    const utils::Vector2f scaleRightDirection{1.0, 1.0};
+    const utils::Vector2f scaleLeftDirection{-1.0, 1.0};
+    const TexturePath firstIdleTexturePath{"idle/x1.txt"};
+    const TexturePath secondIdleTexturePath{"idle/x2.txt"};
+    const TexturePath thirdIdleTexturePath{"idle/x3.txt"};
+    const TexturePath firstWalkTexturePath{"walk/123.txt"};
+    const TexturePath secondWalkTexturePath{"walk/124.txt"};
+    const TextureHandle firstIdleTextureHandle{0};
+    const TextureHandle secondIdleTextureHandle{1};
+    const TextureHandle thirdIdleTextureHandle{2};
+    const TextureHandle firstWalkTextureHandle{3};
+    const TextureHandle secondWalkTextureHandle{4};
+    const TextureHandle firstAttackTextureHandle{5};
+    const TextureHandle secondAttackTextureHandle{6};
+    const AnimationClips animationClips{
+        {AnimationType::Idle, std::make_shared<const AnimationClip>(
+                                  std::vector<TexturePath>{firstIdleTexturePath, secondIdleTexturePath,
+                                                           thirdIdleTexturePath},
+                                  std::vector<TextureHandle>{firstIdleTextureHandle, secondIdleTextureHandle,
+                                                             thirdIdleTextureHandle},
+                                  1.2f)},
+        {AnimationType::Walk, std::make_shared<const AnimationClip>(
+                                  std::vector<TexturePath>{firstWalkTexturePath, secondWalkTexturePath},
+                                  std::vector<TextureHandle>{firstWalkTextureHandle, secondWalkTextureHandle},
+                                  2.0f)},
+        {AnimationType::Attack,
+         std::make_shared<const AnimationClip>(
+             std::vector<TexturePath>{"attack/1.txt", "attack/2.txt"},
+             std::vector<TextureHandle>{firstAttackTextureHandle, secondAttackTextureHandle}, 2.0f)}};
+    const AnimationTransitions animationTransitions{{AnimationType::Idle, AnimationType::Walk, false},
+                                                    {AnimationType::Walk, AnimationType::Idle, false},
+                                                    {AnimationType::Idle, AnimationType::Attack, false},
+                                                    {AnimationType::Attack, AnimationType::Idle, true}};
+    const std::shared_ptr<const AnimatorDefinition> animatorDefinition{
+        std::make_shared<const AnimatorDefinition>(
+            AnimatorDefinition{"player", animationClips, AnimationType::Idle, {}})};
+    const std::shared_ptr<const AnimatorDefinition> animatorDefinitionWithTransitions{
+        std::make_shared<const AnimatorDefinition>(
+            AnimatorDefinition{"enemy", animationClips, AnimationType::Idle, animationTransitions})};
+    const std::shared_ptr<const AnimatorDefinition> animatorDefinitionWithNotSupportedInitialAnimation{
+        std::make_shared<const AnimatorDefinition>(
+            AnimatorDefinition{"player", animationClips, AnimationType::Jump, {}})};
+    const AnimationType notSupportedAnimationType{AnimationType::Jump};
+    const AnimationType supportedAnimationType{AnimationType::Walk};
+    const std::shared_ptr<AnimationSystem> animationSystem{std::make_shared<AnimationSystem>()};
+};
+
+class DefaultAnimatorTest : public DefaultAnimatorTest_Base
+{
+public:
+    DefaultAnimatorTest()
+    {
+        animationSystem->update(utils::DeltaTime{0});
+    }
+
+    DefaultAnimator animator{graphicsId1, animationSystem, animatorDefinition};
+    DefaultAnimator animatorWithLeftInitialDirection{graphicsId2, animationSystem, animatorDefinition,
+                                                     AnimationDirection::Left};
+};
+
+TEST_F(DefaultAnimatorTest,
+       givenInitialAnimationTypeNotSupportedByAnimatorDefinition_shouldThrowAnimationTypeNotSupported)
+{
+    ASSERT_THROW(
+        DefaultAnimator(graphicsId1, animationSystem, animatorDefinitionWithNotSupportedInitialAnimation),
+                 animations::exceptions::AnimationTypeNotSupported);
+}
+
+TEST_F(DefaultAnimatorTest, getInitialAnimationType_shouldReturnIdle)
+{
+    ASSERT_EQ(animator.getAnimationType(), AnimationType::Idle);
+}
+
+TEST_F(DefaultAnimatorTest, getInitialDefaultAnimationDirection_shouldReturnAnimationDirectionRight)
+{
+    ASSERT_EQ(animator.getAnimationDirection(), AnimationDirection::Right);
+}
+
+TEST_F(DefaultAnimatorTest, shouldSetAnimationType)
+{
+    animator.setAnimation(AnimationType::Walk);
+
+    ASSERT_EQ(animator.getAnimationType(), AnimationType::Walk);
+}
+
+TEST_F(DefaultAnimatorTest, shouldSetAnimationDirection)
+{
+    animator.setAnimationDirection(AnimationDirection::Left);
+
+    ASSERT_EQ(animator.getAnimationDirection(), AnimationDirection::Left);
+}
+
+TEST_F(DefaultAnimatorTest, createdAnimators_shouldReportFirstTextureWithScaleOfTheirDirections)
+{
+    DefaultAnimator newAnimator{graphicsId1, animationSystem, animatorDefinition, AnimationDirection::Left};
+
+    const auto& frameChanges = animationSystem->update(timeNotExceedingTimeBetweenTextures);
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{
+                                {graphicsId1, firstIdleTextureHandle, boost::none, scaleLeftDirection}}));
+}
+
+TEST_F(DefaultAnimatorTest, destroyedAnimator_shouldRemoveItsAnimationFromAnimationSystem)
+{
+    {
+        DefaultAnimator newAnimator{graphicsId1, animationSystem, animatorDefinition};
+        ASSERT_EQ(animationSystem->getNumberOfAnimations(), 3u);
+    }
+
+    ASSERT_EQ(animationSystem->getNumberOfAnimations(), 2u);
+}
+
+TEST_F(DefaultAnimatorTest, givenTimeNotExceedingTimeBetweenTextures_shouldNotUpdateAnimation)
+{
+    const auto animationChanged = animator.update(timeNotExceedingTimeBetweenTextures);
+    const auto& frameChanges = animationSystem->update(timeNotExceedingTimeBetweenTextures);
+
+    ASSERT_FALSE(animationChanged);
+    ASSERT_TRUE(frameChanges.empty());
+}
+
+TEST_F(DefaultAnimatorTest, givenTimeExceedingTimeBetweenTextures_shouldReportNextTextureWithDirectionScale)
+{
+    const auto animationChanged = animator.update(timeExceedingOneTimeBetweenTextures);
+    const auto& frameChanges = animationSystem->update(timeExceedingOneTimeBetweenTextures);
+
+    ASSERT_FALSE(animationChanged);
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{
+                                {graphicsId1, secondIdleTextureHandle, boost::none, scaleRightDirection},
+                                {graphicsId2, secondIdleTextureHandle, boost::none, scaleLeftDirection}}));
+}
+
+TEST_F(DefaultAnimatorTest, givenTimeExceedingSeveralTimesBetweenTextures_shouldAdvanceSeveralTexturesAtOnce)
+{
+    animatorWithLeftInitialDirection.setVisible(false);
+
+    animator.update(timeExceedingTimeBetweenTextures);
+    const auto& frameChanges = animationSystem->update(timeExceedingTimeBetweenTextures);
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{
+                                {graphicsId1, thirdIdleTextureHandle, boost::none, scaleRightDirection}}));
+}
+
+TEST_F(DefaultAnimatorTest,
+       givenTimeNotExceedingTimeBetweenTextures_andGivenAnimationTypeSet_shouldUpdateAnimation)
+{
+    animator.setAnimation(AnimationType::Walk);
+
+    const auto animationChanged = animator.update(timeNotExceedingTimeBetweenTextures);
+    const auto& frameChanges = animationSystem->update(timeNotExceedingTimeBetweenTextures);
+
+    ASSERT_TRUE(animationChanged);
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{
+                                {graphicsId1, firstWalkTextureHandle, boost::none, scaleRightDirection}}));
+}
+
+TEST_F(DefaultAnimatorTest,
+       givenTimeNotExceedingTimeBetweenTextures_andGivenAnimationDirectionSet_shouldUpdateAnimation)
+{
+    animationSystem->update(timeExceedingTimeBetweenTextures);
+    animator.setAnimationDirection(AnimationDirection::Left);
+
+    const auto animationChanged = animator.update(timeNotExceedingTimeBetweenTextures);
+    const auto& frameChanges = animationSystem->update(timeNotExceedingTimeBetweenTextures);
+
+    ASSERT_TRUE(animationChanged);
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{
+                                {graphicsId1, firstIdleTextureHandle, boost::none, scaleLeftDirection}}));
+}
+
+TEST_F(DefaultAnimatorTest, invisibleAnimator_shouldNotReportFrameChanges)
+{
+    animator.setVisible(false);
+
+    const auto& frameChanges = animationSystem->update(timeExceedingTimeBetweenTextures);
+
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{
+                                {graphicsId2, thirdIdleTextureHandle, boost::none, scaleLeftDirection}}));
+}
+
+TEST_F(DefaultAnimatorTest, givenNotSupportedAnimationType_shouldThrowAnimationNotSupported)
+{
+    ASSERT_THROW(animator.setAnimation(notSupportedAnimationType),
+                 animations::exceptions::AnimationTypeNotSupported);
+}
+
+TEST_F(DefaultAnimatorTest, givenSupportedAnimationType_shouldNotThrowAndChangeAnimationType)
+{
+    ASSERT_NO_THROW(animator.setAnimation(supportedAnimationType));
+    ASSERT_EQ(animator.getAnimationType(), supportedAnimationType);
+}
+
+TEST_F(DefaultAnimatorTest, givenNotSupportedAnimationTypeAndDirection_shouldThrowAnimationNotSupported)
+{
+    ASSERT_THROW(animator.setAnimation(notSupportedAnimationType, AnimationDirection::Right),
+                 animations::exceptions::AnimationTypeNotSupported);
+}
+
+TEST_F(DefaultAnimatorTest,
+       givenSupportedAnimationTypeAndDirection_shouldNotThrowAndChangeAnimationTypeAndDirection)
+{
+    ASSERT_NO_THROW(animator.setAnimation(supportedAnimationType, AnimationDirection::Right));
+
+    ASSERT_EQ(animator.getAnimationType(), supportedAnimationType);
+    ASSERT_EQ(animator.getAnimationDirection(), AnimationDirection::Right);
+}
+
+TEST_F(DefaultAnimatorTest, givenReloadedAnimatorDefinition_shouldRestartCurrentAnimationWithReloadedClip)
+{
+    const GraphicsId graphicsId3{GraphicsIdGenerator::generateId()};
+    const auto reloadableAnimatorDefinition = std::make_shared<AnimatorDefinition>(*animatorDefinition);
+    DefaultAnimator reloadableAnimator{graphicsId3, animationSystem, reloadableAnimatorDefinition};
+    animationSystem->update(timeNotExceedingTimeBetweenTextures);
+    reloadableAnimatorDefinition->animationClips[AnimationType::Idle] =
+        animationClips.at(AnimationType::Walk);
+    reloadableAnimatorDefinition->revision++;
+
+    const auto animationChanged = reloadableAnimator.update(timeNotExceedingTimeBetweenTextures);
+    const auto& frameChanges = animationSystem->update(timeNotExceedingTimeBetweenTextures);
+
+    ASSERT_TRUE(animationChanged);
+    ASSERT_EQ(reloadableAnimator.getAnimationType(), AnimationType::Idle);
+    ASSERT_THAT(frameChanges, Contains(AnimationFrameChange{graphicsId3, firstWalkTextureHandle, boost::none,
+                                                            scaleRightDirection}));
+}
+
+TEST_F(DefaultAnimatorTest,
+       givenReloadedAnimatorDefinitionWithoutCurrentAnimation_shouldChangeToInitialAnimation)
+{
+    const GraphicsId graphicsId3{GraphicsIdGenerator::generateId()};
+    const auto reloadableAnimatorDefinition = std::make_shared<AnimatorDefinition>(*animatorDefinition);
+    DefaultAnimator reloadableAnimator{graphicsId3, animationSystem, reloadableAnimatorDefinition};
+    reloadableAnimator.setAnimation(AnimationType::Walk);
+    reloadableAnimatorDefinition->animationClips.erase(AnimationType::Walk);
+    reloadableAnimatorDefinition->revision++;
+
+    reloadableAnimator.update(timeNotExceedingTimeBetweenTextures);
+    const auto& frameChanges = animationSystem->update(timeNotExceedingTimeBetweenTextures);
+
+    ASSERT_EQ(reloadableAnimator.getAnimationType(), AnimationType::Idle);
+    ASSERT_THAT(frameChanges, Contains(AnimationFrameChange{graphicsId3, firstIdleTextureHandle, boost::none,
+                                                            scaleRightDirection}));
+}
+
+TEST_F(DefaultAnimatorTest, givenClipWithTextureRects_shouldSetTextureWithTextureRectOfCurrentFrame)
+{
+    const GraphicsId graphicsId3{GraphicsIdGenerator::generateId()};
+    const TextureHandle spriteSheetTextureHandle{7};
+    const utils::IntRect firstFrameRect{0, 0, 16, 16};
+    const utils::IntRect secondFrameRect{16, 0, 16, 16};
+    const auto spriteSheetClip = std::make_shared<const AnimationClip>(
+        "sheet.png", spriteSheetTextureHandle, std::vector<utils::IntRect>{firstFrameRect, secondFrameRect},
+        1.2f);
+    const auto spriteSheetAnimatorDefinition = std::make_shared<const AnimatorDefinition>(
+        AnimatorDefinition{"sheet", {{AnimationType::Idle, spriteSheetClip}}, AnimationType::Idle, {}});
+    DefaultAnimator spriteSheetAnimator{graphicsId3, animationSystem, spriteSheetAnimatorDefinition};
+    animator.setVisible(false);
+    animatorWithLeftInitialDirection.setVisible(false);
+    const auto firstFrameChanges = animationSystem->update(utils::DeltaTime{0});
+
+    const auto& secondFrameChanges = animationSystem->update(utils::DeltaTime{1.5f});
+
+    ASSERT_EQ(firstFrameChanges,
+              (std::vector<AnimationFrameChange>{
+                  {graphicsId3, spriteSheetTextureHandle, firstFrameRect, scaleRightDirection}}));
+    ASSERT_EQ(secondFrameChanges,
+              (std::vector<AnimationFrameChange>{
+                  {graphicsId3, spriteSheetTextureHandle, secondFrameRect, scaleRightDirection}}));
+}
+
+class DefaultAnimatorWithTransitionsTest : public DefaultAnimatorTest
+{
+public:
+    DefaultAnimatorWithTransitionsTest()
+    {
+        animatorWithTransitions = std::make_unique<DefaultAnimator>(graphicsId3, animationSystem,
+                                                                    animatorDefinitionWithTransitions);
+        animator.setVisible(false);
+        animatorWithLeftInitialDirection.setVisible(false);
+        animationSystem->update(utils::DeltaTime{0});
+    }
+
+    const GraphicsId graphicsId3{GraphicsIdGenerator::generateId()};
+    std::unique_ptr<DefaultAnimator> animatorWithTransitions;
+};
+
+TEST_F(DefaultAnimatorWithTransitionsTest, givenTransitionDefinedInSettings_shouldChangeAnimation)
+{
+    animatorWithTransitions->setAnimation(AnimationType::Attack);
+
+    ASSERT_EQ(animatorWithTransitions->getAnimationType(), AnimationType::Attack);
+}
+
+TEST_F(DefaultAnimatorWithTransitionsTest, givenTransitionNotDefinedInSettings_shouldKeepCurrentAnimation)
+{
+    animatorWithTransitions->setAnimation(AnimationType::Walk);
+
+    animatorWithTransitions->setAnimation(AnimationType::Attack);
+
+    ASSERT_EQ(animatorWithTransitions->getAnimationType(), AnimationType::Walk);
+}
+
+TEST_F(DefaultAnimatorWithTransitionsTest,
+       givenTransitionAllowedOnlyOnAnimationEnd_shouldNotChangeAnimationOnRequest)
+{
+    animatorWithTransitions->setAnimation(AnimationType::Attack);
+
+    animatorWithTransitions->setAnimation(AnimationType::Idle);
+
+    ASSERT_EQ(animatorWithTransitions->getAnimationType(), AnimationType::Attack);
+}
+
+TEST_F(DefaultAnimatorWithTransitionsTest, givenAnimationEnded_shouldChangeToAnimationFromEndTransition)
+{
+    animatorWithTransitions->setAnimation(AnimationType::Attack);
+    animatorWithTransitions->update(timeExceedingTimeBetweenTextures);
+    animationSystem->update(timeExceedingTimeBetweenTextures);
+
+    const auto animationChanged = animatorWithTransitions->update(timeExceedingTimeBetweenTextures);
+    const auto& frameChanges = animationSystem->update(timeExceedingTimeBetweenTextures);
+
+    ASSERT_TRUE(animationChanged);
+    ASSERT_EQ(animatorWithTransitions->getAnimationType(), AnimationType::Idle);
+    ASSERT_EQ(frameChanges, (std::vector<AnimationFrameChange>{
+                                {graphicsId3, firstIdleTextureHandle, boost::none, scaleRightDirection}}));
+}
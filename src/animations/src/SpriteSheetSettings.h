@@ -0,0 +1,37 @@
+#pragma once
+
+#include <ostream>
+#include <tuple>
+
+#include "TexturePath.h"
+
+namespace animations
+{
+struct SpriteSheetSettings
+{
+    graphics::TexturePath texturePath;
+    int rows;
+    int columns;
+    int frameWidth;
+    int frameHeight;
+    int numberOfFrames;
+};
+
+inline bool operator==(const SpriteSheetSettings& lhs, const SpriteSheetSettings& rhs)
+{
+    auto tieStruct = [](const SpriteSheetSettings& settings) {
+        return std::tie(settings.texturePath, settings.rows, settings.columns, settings.frameWidth,
+                        settings.frameHeight, settings.numberOfFrames);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const SpriteSheetSettings& spriteSheetSettings)
+{
+    return os << "texturePath: " << spriteSheetSettings.texturePath << " rows: " << spriteSheetSettings.rows
+              << " columns: " << spriteSheetSettings.columns
+              << " frameWidth: " << spriteSheetSettings.frameWidth
+              << " frameHeight: " << spriteSheetSettings.frameHeight
+              << " numberOfFrames: " << spriteSheetSettings.numberOfFrames;
+}
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdexcept>
+
+namespace animations::exceptions
+{
+struct AnimationNotFound : std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
+}
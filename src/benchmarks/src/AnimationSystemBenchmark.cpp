@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include "AnimationSystem.h"
+#include "GraphicsIdGenerator.h"
+
+namespace
+{
+const auto numberOfClips{16};
+const utils::DeltaTime frameTime{1.f / 60.f};
+
+std::vector<std::shared_ptr<const animations::AnimationClip>> createClips()
+{
+    std::vector<std::shared_ptr<const animations::AnimationClip>> clips;
+    for (auto clipIndex = 0; clipIndex < numberOfClips; clipIndex++)
+    {
+        const auto numberOfTextures = static_cast<std::size_t>(2 + clipIndex % 10);
+        std::vector<graphics::TextureHandle> textureHandles(numberOfTextures);
+        for (std::size_t textureIndex = 0; textureIndex < numberOfTextures; textureIndex++)
+        {
+            textureHandles[textureIndex] =
+                static_cast<graphics::TextureHandle>(clipIndex) * 16u + textureIndex;
+        }
+        clips.push_back(std::make_shared<const animations::AnimationClip>(
+            std::vector<graphics::TexturePath>(numberOfTextures), std::move(textureHandles),
+            0.05f + 0.03f * static_cast<float>(clipIndex)));
+    }
+    return clips;
+}
+}
+
+static void BM_AnimationSystemUpdate(benchmark::State& state)
+{
+    const auto clips = createClips();
+    const auto visibleAnimationsDivisor = state.range(1);
+    animations::AnimationSystem animationSystem;
+    for (auto animationIndex = 0; animationIndex < state.range(0); animationIndex++)
+    {
+        const auto animationId = animationSystem.add(graphics::GraphicsIdGenerator::generateId(),
+                                                     clips[animationIndex % numberOfClips]);
+        animationSystem.setVisible(animationId, animationIndex % visibleAnimationsDivisor == 0);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(animationSystem.update(frameTime).size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AnimationSystemUpdate)
+    ->ArgNames({"animations", "visibleDivisor"})
+    ->ArgsProduct({{10, 100, 1000, 10000, 50000, 100000}, {1, 10}});
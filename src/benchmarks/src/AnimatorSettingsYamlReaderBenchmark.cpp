@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+
+#include "AnimatorSettingsYamlReader.h"
+
+namespace
+{
+const std::vector<std::string> animationTypes{"idle", "walk", "jump", "attack"};
+
+utils::FilePath writeAnimatorsConfigFile(std::size_t numberOfAnimators)
+{
+    const auto filePath = (std::filesystem::temp_directory_path() /
+                           ("chimarrao-benchmark-animators-" + std::to_string(numberOfAnimators) + ".yaml"))
+                              .string();
+    std::ofstream file{filePath};
+    file << "animators:\n";
+    for (std::size_t animatorIndex = 0; animatorIndex < numberOfAnimators; animatorIndex++)
+    {
+        file << "  - name: animator" << animatorIndex << "\n    animations:\n";
+        for (const auto& animationType : animationTypes)
+        {
+            file << "      - type: " << animationType << "\n"
+                 << "        firstTexturePath: resources/Player/" << animationType << "-1.png\n"
+                 << "        numberOfTextures: 6\n"
+                 << "        timeBetweenTexturesInSeconds: 0.1\n";
+        }
+        file << "    transitions:\n";
+        for (std::size_t typeIndex = 1; typeIndex < animationTypes.size(); typeIndex++)
+        {
+            file << "      - from: " << animationTypes[0] << "\n"
+                 << "        to: " << animationTypes[typeIndex] << "\n";
+        }
+    }
+    return filePath;
+}
+}
+
+static void BM_AnimatorSettingsYamlReaderRead(benchmark::State& state)
+{
+    const auto filePath = writeAnimatorsConfigFile(static_cast<std::size_t>(state.range(0)));
+    const animations::AnimatorSettingsYamlReader reader;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(reader.readAnimatorsSettings(filePath));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::filesystem::remove(filePath);
+}
+BENCHMARK(BM_AnimatorSettingsYamlReaderRead)->RangeMultiplier(10)->Range(1, 1000);
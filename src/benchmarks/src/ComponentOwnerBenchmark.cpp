@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include "AnimationClipLibrary.h"
+#include "AnimatorSettingsYamlReader.h"
+#include "ApplyAnimationFrameChanges.h"
+#include "DefaultAnimator.h"
+#include "DefaultAnimatorSettingsRepository.h"
+#include "DefaultInputObservationHandler.h"
+#include "GraphicsFactory.h"
+#include "ReplayInputManager.h"
+#include "core/AnimationComponent.h"
+#include "core/ComponentOwner.h"
+#include "core/GraphicsComponent.h"
+#include "core/KeyboardMovementComponent.h"
+
+namespace
+{
+const utils::Vector2u renderingRegionSize{800, 600};
+const utils::Vector2u logicalRegionSize{80, 60};
+const utils::DeltaTime frameTime{1.f / 60.f};
+}
+
+static void BM_ComponentOwnerUpdate(benchmark::State& state)
+{
+    const std::shared_ptr<graphics::RendererPool> rendererPool =
+        graphics::GraphicsFactory::createHeadlessGraphicsFactory()->createRendererPool(
+            nullptr, renderingRegionSize, logicalRegionSize);
+    const auto inputManager = std::make_shared<input::ReplayInputManager>(
+        std::make_unique<input::DefaultInputObservationHandler>(),
+        input::InputRecording{{{input::toKeyMask(input::InputKey::Right), {0, 0}, "", frameTime.count()}}});
+    animations::AnimationClipLibrary animationClipLibrary{
+        rendererPool, std::make_shared<animations::DefaultAnimatorSettingsRepository>(
+                          std::make_unique<animations::AnimatorSettingsYamlReader>())};
+    const auto playerAnimatorDefinition = animationClipLibrary.getAnimatorDefinition("player");
+    const auto animationSystem = std::make_shared<animations::AnimationSystem>();
+
+    std::vector<std::unique_ptr<components::core::ComponentOwner>> componentOwners;
+    for (auto componentOwnerIndex = 0; componentOwnerIndex < state.range(0); componentOwnerIndex++)
+    {
+        auto componentOwner = std::make_unique<components::core::ComponentOwner>(
+            utils::Vector2f{static_cast<float>(componentOwnerIndex % logicalRegionSize.x), 10});
+        const auto graphicsComponent = componentOwner->addComponent<components::core::GraphicsComponent>(
+            rendererPool, utils::Vector2f{5, 5}, componentOwner->transform->getPosition(),
+            graphics::Color::Red);
+        componentOwner->addComponent<components::core::KeyboardMovementComponent>(inputManager);
+        componentOwner->addComponent<components::core::AnimationComponent>(
+            std::make_shared<animations::DefaultAnimator>(graphicsComponent->getGraphicsId(), animationSystem,
+                                                          playerAnimatorDefinition),
+            rendererPool->getCamera());
+        componentOwner->loadDependentComponents();
+        componentOwner->start();
+        componentOwners.push_back(std::move(componentOwner));
+    }
+    inputManager->readInput();
+
+    for (auto _ : state)
+    {
+        for (const auto& componentOwner : componentOwners)
+        {
+            componentOwner->update(frameTime);
+        }
+        for (const auto& componentOwner : componentOwners)
+        {
+            componentOwner->lateUpdate(frameTime);
+        }
+        animations::applyAnimationFrameChanges(*rendererPool, animationSystem->update(frameTime));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ComponentOwnerUpdate)->RangeMultiplier(10)->Range(10, 10000);
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <functional>
+
+#include "AllocationTracker.h"
+#include "DefaultInputObservationHandler.h"
+#include "DurationHistogram.h"
+#include "EditorState.h"
+#include "GameState.h"
+#include "GraphicsFactory.h"
+#include "PerformanceOverlay.h"
+#include "ReplayInputManager.h"
+#include "WindowFactory.h"
+
+namespace
+{
+const auto numberOfFrames{3000};
+const utils::Vector2u windowSize{800, 600};
+const utils::Vector2u mapSize{80, 60};
+const utils::DeltaTime frameTime{1.f / 60.f};
+
+using StateCreator = std::function<std::unique_ptr<game::State>(
+    const std::shared_ptr<window::Window>&, const std::shared_ptr<input::InputManager>&,
+    const std::shared_ptr<graphics::RendererPool>&, std::stack<std::unique_ptr<game::State>>&)>;
+
+void appendOverlayToggle(input::InputRecording& recording)
+{
+    recording.snapshots.push_back({input::toKeyMask(input::InputKey::F3), {0, 0}, "", frameTime.count()});
+    recording.snapshots.push_back({0, {0, 0}, "", frameTime.count()});
+}
+
+input::InputRecording createGameStateRecording()
+{
+    const std::vector<input::InputKeysMask> movementCycle{
+        input::toKeyMask(input::InputKey::Right),
+        input::toKeysMask({input::InputKey::Right, input::InputKey::Space}), 0,
+        input::toKeyMask(input::InputKey::Left)};
+
+    input::InputRecording recording;
+    appendOverlayToggle(recording);
+    for (auto frame = 0; frame < numberOfFrames; frame++)
+    {
+        const auto pressedKeys = movementCycle[(frame / 30) % movementCycle.size()];
+        recording.snapshots.push_back({pressedKeys, {0, 0}, "", frameTime.count()});
+    }
+    return recording;
+}
+
+input::InputRecording createEditorStateRecording()
+{
+    input::InputRecording recording;
+    appendOverlayToggle(recording);
+    for (auto frame = 0; frame < numberOfFrames; frame++)
+    {
+        const utils::Vector2f mousePosition{static_cast<float>(frame % windowSize.x),
+                                            static_cast<float>((frame * 7) % windowSize.y)};
+        const auto pressedKeys = frame % 2 == 0 ? input::toKeyMask(input::InputKey::MouseLeft) : 0;
+        recording.snapshots.push_back({pressedKeys, mousePosition, "", frameTime.count()});
+    }
+    return recording;
+}
+
+void runStateFrames(benchmark::State& state, const StateCreator& createState,
+                    input::InputRecording recording)
+{
+    const std::shared_ptr<window::Window> window =
+        window::WindowFactory::createHeadlessWindowFactory()->createWindow(windowSize, "benchmark");
+    const std::shared_ptr<graphics::RendererPool> rendererPool =
+        graphics::GraphicsFactory::createHeadlessGraphicsFactory()->createRendererPool(window, windowSize,
+                                                                                       mapSize);
+    const auto inputManager = std::make_shared<input::ReplayInputManager>(
+        std::make_unique<input::DefaultInputObservationHandler>(), std::move(recording));
+    game::PerformanceOverlay performanceOverlay{inputManager, rendererPool};
+    std::stack<std::unique_ptr<game::State>> states;
+    states.push(createState(window, inputManager, rendererPool, states));
+
+    utils::DurationHistogram frameTimes;
+    std::chrono::steady_clock::duration overlayTime{0};
+    utils::AllocationTracker::resetFrameStatistics();
+    for (auto _ : state)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        inputManager->readInput();
+        states.top()->update(frameTime);
+        states.top()->lateUpdate(frameTime);
+        const auto overlayStart = std::chrono::steady_clock::now();
+        performanceOverlay.update({frameTime, utils::DeltaTime{0}, utils::DeltaTime{0}});
+        overlayTime += std::chrono::steady_clock::now() - overlayStart;
+        states.top()->render();
+        window->display();
+        frameTimes.record(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+        utils::AllocationTracker::frameFinished();
+    }
+
+    state.counters["p99Us"] = static_cast<double>(frameTimes.getValueAtPercentile(99).count());
+    state.counters["maxUs"] = static_cast<double>(frameTimes.getMax().count());
+    state.counters["overlayUs"] = benchmark::Counter(
+        std::chrono::duration<double, std::micro>(overlayTime).count(), benchmark::Counter::kAvgIterations);
+    if (utils::AllocationTracker::isEnabled())
+    {
+        const auto frameAllocationStatistics = utils::AllocationTracker::getFrameStatistics();
+        state.counters["framesWithAllocations"] =
+            static_cast<double>(frameAllocationStatistics.numberOfFramesWithAllocations);
+        state.counters["maxFrameAllocations"] =
+            static_cast<double>(frameAllocationStatistics.maxFrameAllocations);
+    }
+}
+}
+
+static void BM_GameStateFrame(benchmark::State& state)
+{
+    runStateFrames(
+        state,
+        [](const auto& window, const auto& inputManager, const auto& rendererPool, auto& states) {
+            return std::make_unique<game::GameState>(window, inputManager, rendererPool, states);
+        },
+        createGameStateRecording());
+}
+BENCHMARK(BM_GameStateFrame)->Iterations(numberOfFrames)->Unit(benchmark::kMicrosecond);
+
+static void BM_EditorStateFrame(benchmark::State& state)
+{
+    runStateFrames(
+        state,
+        [](const auto& window, const auto& inputManager, const auto& rendererPool, auto& states) {
+            return std::make_unique<game::EditorState>(window, inputManager, rendererPool, states);
+        },
+        createEditorStateRecording());
+}
+BENCHMARK(BM_EditorStateFrame)->Iterations(numberOfFrames)->Unit(benchmark::kMicrosecond);
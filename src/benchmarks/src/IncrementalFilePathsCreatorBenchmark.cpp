@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include "AllocationTracker.h"
+#include "IncrementalFilePathsCreator.h"
+
+namespace
+{
+const utils::FilePath fullPathToFirstFile{
+    "/home/user/chimarrao-platformer/resources/Player/Attack/attack-with-weapon-1.png"};
+
+void setAllocationsPerIterationCounter(benchmark::State& state, std::uint64_t numberOfAllocationsBefore)
+{
+    if (utils::AllocationTracker::isEnabled())
+    {
+        state.counters["allocations"] = benchmark::Counter(
+            static_cast<double>(utils::AllocationTracker::getTotalNumberOfAllocations() -
+                                numberOfAllocationsBefore),
+            benchmark::Counter::kAvgIterations);
+    }
+}
+}
+
+static void BM_IncrementalFilePathsCreatorCreateFilePaths(benchmark::State& state)
+{
+    const auto numberOfIncrementalFiles = static_cast<unsigned>(state.range(0));
+
+    const auto numberOfAllocationsBefore = utils::AllocationTracker::getTotalNumberOfAllocations();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(utils::IncrementalFilePathsCreator::createFilePaths(
+            fullPathToFirstFile, numberOfIncrementalFiles));
+    }
+    setAllocationsPerIterationCounter(state, numberOfAllocationsBefore);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IncrementalFilePathsCreatorCreateFilePaths)->RangeMultiplier(4)->Range(1, 64);
+
+static void BM_IncrementalFilePathsCreatorCreateFilePathsIntoReusedPaths(benchmark::State& state)
+{
+    const auto numberOfIncrementalFiles = static_cast<unsigned>(state.range(0));
+    utils::IncrementalFilePaths filePaths;
+    utils::IncrementalFilePathsCreator::createFilePaths(fullPathToFirstFile, numberOfIncrementalFiles,
+                                                        filePaths);
+
+    const auto numberOfAllocationsBefore = utils::AllocationTracker::getTotalNumberOfAllocations();
+    for (auto _ : state)
+    {
+        utils::IncrementalFilePathsCreator::createFilePaths(fullPathToFirstFile, numberOfIncrementalFiles,
+                                                            filePaths);
+        benchmark::DoNotOptimize(filePaths.size());
+    }
+    setAllocationsPerIterationCounter(state, numberOfAllocationsBefore);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IncrementalFilePathsCreatorCreateFilePathsIntoReusedPaths)->RangeMultiplier(4)->Range(1, 64);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include "DefaultInputObservationHandler.h"
+#include "InputObserver.h"
+#include "ReplayInputManager.h"
+
+namespace
+{
+const auto numberOfRecordedFrames{600};
+const std::vector<input::InputKey> queriedKeys{input::InputKey::Left, input::InputKey::Right,
+                                               input::InputKey::Up, input::InputKey::Space,
+                                               input::InputKey::MouseLeft};
+
+class QueryingInputObserver : public input::InputObserver
+{
+public:
+    void handleInputStatus(const input::InputStatus& inputStatus) override
+    {
+        for (const auto key : queriedKeys)
+        {
+            numberOfPressedKeys += inputStatus.isKeyPressed(key);
+            numberOfReleasedKeys += inputStatus.isKeyReleased(key);
+        }
+        benchmark::DoNotOptimize(numberOfPressedKeys);
+        benchmark::DoNotOptimize(numberOfReleasedKeys);
+    }
+
+private:
+    std::size_t numberOfPressedKeys{0};
+    std::size_t numberOfReleasedKeys{0};
+};
+
+input::InputRecording createRecording()
+{
+    input::InputRecording recording;
+    for (auto frame = 0; frame < numberOfRecordedFrames; frame++)
+    {
+        const auto pressedKey = queriedKeys[static_cast<std::size_t>(frame / 10) % queriedKeys.size()];
+        recording.snapshots.push_back({input::toKeyMask(pressedKey), {0, 0}, "", 1.f / 60.f});
+    }
+    return recording;
+}
+}
+
+static void BM_InputStatusProcessing(benchmark::State& state)
+{
+    const auto recording = createRecording();
+    std::vector<QueryingInputObserver> observers(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        input::ReplayInputManager inputManager{std::make_unique<input::DefaultInputObservationHandler>(),
+                                               recording};
+        for (auto& observer : observers)
+        {
+            inputManager.registerObserver(&observer);
+        }
+        state.ResumeTiming();
+
+        while (not inputManager.isFinished())
+        {
+            inputManager.readInput();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * numberOfRecordedFrames);
+}
+BENCHMARK(BM_InputStatusProcessing)->RangeMultiplier(10)->Range(1, 1000);
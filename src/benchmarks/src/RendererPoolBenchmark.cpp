@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include "GraphicsFactory.h"
+
+namespace
+{
+const utils::Vector2u renderingRegionSize{800, 600};
+const utils::Vector2u logicalRegionSize{80, 60};
+const utils::Vector2f shapeSize{2, 2};
+
+std::unique_ptr<graphics::RendererPool> createRendererPool()
+{
+    return graphics::GraphicsFactory::createHeadlessGraphicsFactory()->createRendererPool(
+        nullptr, renderingRegionSize, logicalRegionSize);
+}
+
+utils::Vector2f getShapePosition(std::size_t shapeIndex)
+{
+    return {static_cast<float>(shapeIndex % logicalRegionSize.x),
+            static_cast<float>(shapeIndex / logicalRegionSize.x % logicalRegionSize.y)};
+}
+
+std::vector<graphics::GraphicsId> acquireShapes(graphics::RendererPool& rendererPool,
+                                                std::size_t numberOfShapes)
+{
+    std::vector<graphics::GraphicsId> graphicsIds;
+    graphicsIds.reserve(numberOfShapes);
+    for (std::size_t shapeIndex = 0; shapeIndex < numberOfShapes; shapeIndex++)
+    {
+        graphicsIds.push_back(
+            rendererPool.acquire(shapeSize, getShapePosition(shapeIndex), graphics::Color::Red));
+    }
+    return graphicsIds;
+}
+}
+
+static void BM_RendererPoolAcquireAndRelease(benchmark::State& state)
+{
+    const auto rendererPool = createRendererPool();
+    const auto numberOfShapes = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        for (const auto& graphicsId : acquireShapes(*rendererPool, numberOfShapes))
+        {
+            rendererPool->release(graphicsId);
+        }
+        rendererPool->renderAll();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RendererPoolAcquireAndRelease)->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_RendererPoolSetPosition(benchmark::State& state)
+{
+    const auto rendererPool = createRendererPool();
+    const auto graphicsIds = acquireShapes(*rendererPool, static_cast<std::size_t>(state.range(0)));
+    float offset{0};
+
+    for (auto _ : state)
+    {
+        offset += 0.1f;
+        for (std::size_t shapeIndex = 0; shapeIndex < graphicsIds.size(); shapeIndex++)
+        {
+            rendererPool->setPosition(graphicsIds[shapeIndex],
+                                      getShapePosition(shapeIndex) + utils::Vector2f{offset, offset});
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RendererPoolSetPosition)->RangeMultiplier(10)->Range(10, 10000);
+
+static void BM_RendererPoolRenderAll(benchmark::State& state)
+{
+    const auto rendererPool = createRendererPool();
+    acquireShapes(*rendererPool, static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        rendererPool->renderAll();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RendererPoolRenderAll)->RangeMultiplier(10)->Range(10, 10000);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include "TileMap.h"
+
+namespace
+{
+const utils::Vector2f tileSize{1, 1};
+const auto numberOfRaycasts{1000};
+const auto maxRayDistance{200.f};
+const auto floodFillTile{2};
+
+game::TileMap createTileMap(int mapSideLength)
+{
+    game::TileMap tileMap{{mapSideLength, mapSideLength}, tileSize};
+    for (auto y = 0; y < mapSideLength; y++)
+    {
+        for (auto x = (y * 7) % 20; x < mapSideLength; x += 20)
+        {
+            tileMap.setTile({x, y}, 1);
+        }
+    }
+    return tileMap;
+}
+}
+
+static void BM_TileMapGetTile(benchmark::State& state)
+{
+    const auto mapSideLength = static_cast<int>(state.range(0));
+    const auto tileMap = createTileMap(mapSideLength);
+
+    for (auto _ : state)
+    {
+        auto numberOfSolidTiles{0};
+        for (auto y = 0; y < mapSideLength; y++)
+        {
+            for (auto x = 0; x < mapSideLength; x++)
+            {
+                numberOfSolidTiles += tileMap.isSolid({x, y});
+            }
+        }
+        benchmark::DoNotOptimize(numberOfSolidTiles);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_TileMapGetTile)->RangeMultiplier(10)->Range(10, 1000);
+
+static void BM_TileMapSweep(benchmark::State& state)
+{
+    const auto mapSideLength = static_cast<int>(state.range(0));
+    const auto tileMap = createTileMap(mapSideLength);
+    const auto mapCenter = static_cast<float>(mapSideLength) / 2;
+    const utils::FloatRect box{mapCenter, mapCenter, 0.8f, 1.6f};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tileMap.sweep(box, {mapCenter - 1, 0.5f}));
+        benchmark::DoNotOptimize(tileMap.sweep(box, {0.5f, -mapCenter + 1}));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_TileMapSweep)->RangeMultiplier(10)->Range(10, 1000);
+
+static void BM_TileMapRaycast(benchmark::State& state)
+{
+    const auto mapSideLength = static_cast<int>(state.range(0));
+    const auto tileMap = createTileMap(mapSideLength);
+    std::mt19937 randomEngine{42};
+    std::uniform_real_distribution<float> positionDistribution{0, static_cast<float>(mapSideLength)};
+    std::uniform_real_distribution<float> directionDistribution{-1, 1};
+    std::vector<std::pair<utils::Vector2f, utils::Vector2f>> rays;
+    rays.reserve(numberOfRaycasts);
+    for (auto rayIndex = 0; rayIndex < numberOfRaycasts; rayIndex++)
+    {
+        const utils::Vector2f origin{positionDistribution(randomEngine), positionDistribution(randomEngine)};
+        const utils::Vector2f direction{directionDistribution(randomEngine),
+                                        directionDistribution(randomEngine)};
+        rays.emplace_back(origin, direction);
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& [origin, direction] : rays)
+        {
+            benchmark::DoNotOptimize(tileMap.raycast(origin, direction, maxRayDistance));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numberOfRaycasts);
+}
+BENCHMARK(BM_TileMapRaycast)->RangeMultiplier(10)->Range(10, 1000);
+
+static void BM_TileMapFloodFill(benchmark::State& state)
+{
+    const auto mapSideLength = static_cast<int>(state.range(0));
+    const auto initialTileMap = createTileMap(mapSideLength);
+    auto tileMap = initialTileMap;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        tileMap = initialTileMap;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(tileMap.floodFill({1, 0}, floodFillTile));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_TileMapFloodFill)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMicrosecond);
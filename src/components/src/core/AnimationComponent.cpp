@@ -1,11 +1,20 @@
 #include "AnimationComponent.h"
 
+#include "ComponentOwner.h"
+#include "GraphicsComponent.h"
+
 namespace components::core
 {
 AnimationComponent::AnimationComponent(ComponentOwner* ownerInit,
-                                       std::shared_ptr<animations::Animator> animatorInit)
-    : Component(ownerInit), animator{std::move(animatorInit)}
+                                       std::shared_ptr<animations::Animator> animatorInit,
+                                       std::shared_ptr<const graphics::Camera> cameraInit)
+    : Component(ownerInit), animator{std::move(animatorInit)}, camera{std::move(cameraInit)}, visible{true}
+{
+}
+
+void AnimationComponent::loadDependentComponents()
 {
+    graphics = owner->getComponent<GraphicsComponent>();
 }
 
 void AnimationComponent::update(utils::DeltaTime deltaTime)
@@ -13,6 +22,16 @@ void AnimationComponent::update(utils::DeltaTime deltaTime)
     animator->update(deltaTime);
 }
 
+void AnimationComponent::lateUpdate(utils::DeltaTime)
+{
+    const auto visibleNow = isVisible();
+    if (visible != visibleNow)
+    {
+        animator->setVisible(visibleNow);
+        visible = visibleNow;
+    }
+}
+
 void AnimationComponent::setAnimation(animations::AnimationType animationType)
 {
     animator->setAnimation(animationType);
@@ -39,4 +58,21 @@ animations::AnimationDirection AnimationComponent::getAnimationDirection() const
     return animator->getAnimationDirection();
 }
 
+bool AnimationComponent::isVisible() const
+{
+    if (graphics && not graphics->isVisible())
+    {
+        return false;
+    }
+
+    if (not graphics || not camera)
+    {
+        return true;
+    }
+
+    const auto& position = owner->transform->getPosition();
+    const auto& size = graphics->getSize();
+    return camera->isVisible(utils::FloatRect{position.x, position.y, size.x, size.y});
+}
+
 }
\ No newline at end of file
@@ -1,16 +1,22 @@
 #pragma once
 
 #include "Animator.h"
+#include "Camera.h"
 #include "Component.h"
 
 namespace components::core
 {
+class GraphicsComponent;
+
 class AnimationComponent : public Component
 {
 public:
-    AnimationComponent(ComponentOwner*, std::shared_ptr<animations::Animator>);
+    AnimationComponent(ComponentOwner*, std::shared_ptr<animations::Animator>,
+                       std::shared_ptr<const graphics::Camera> = nullptr);
 
+    void loadDependentComponents() override;
     void update(utils::DeltaTime) override;
+    void lateUpdate(utils::DeltaTime) override;
     void setAnimation(animations::AnimationType);
     void setAnimation(animations::AnimationType, animations::AnimationDirection);
     void setAnimationDirection(animations::AnimationDirection);
@@ -18,6 +24,11 @@ public:
     animations::AnimationDirection getAnimationDirection() const;
 
 private:
+    bool isVisible() const;
+
     std::shared_ptr<animations::Animator> animator;
+    std::shared_ptr<const graphics::Camera> camera;
+    std::shared_ptr<GraphicsComponent> graphics;
+    bool visible;
 };
-}
+}
\ No newline at end of file
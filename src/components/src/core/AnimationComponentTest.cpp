@@ -3,9 +3,12 @@
 #include "gtest/gtest.h"
 
 #include "AnimatorMock.h"
+#include "RendererPoolMock.h"
 
 #include "ComponentOwner.h"
 #include "DeltaTime.h"
+#include "GraphicsComponent.h"
+#include "GraphicsIdGenerator.h"
 
 using namespace ::testing;
 using namespace components::core;
@@ -24,6 +27,31 @@ public:
     AnimationComponent animationComponent{&componentOwner, animator};
 };
 
+class AnimationComponentVisibilityTest : public AnimationComponentTest
+{
+public:
+    AnimationComponentVisibilityTest()
+    {
+        EXPECT_CALL(*rendererPool,
+                    acquire(size, position, graphics::Color::Red, graphics::VisibilityLayer::First))
+            .WillOnce(Return(graphicsId));
+        EXPECT_CALL(*rendererPool, release(graphicsId));
+        graphicsComponent = componentOwnerWithGraphics.addComponent<GraphicsComponent>(
+            rendererPool, size, position, graphics::Color::Red);
+        componentOwnerWithGraphics.loadDependentComponents();
+    }
+
+    const utils::Vector2f size{5, 5};
+    const graphics::GraphicsId graphicsId{graphics::GraphicsIdGenerator::generateId()};
+    std::shared_ptr<StrictMock<graphics::RendererPoolMock>> rendererPool =
+        std::make_shared<StrictMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<graphics::Camera> camera = std::make_shared<graphics::Camera>(utils::Vector2f{20, 20});
+    ComponentOwner componentOwnerWithGraphics{position};
+    std::shared_ptr<GraphicsComponent> graphicsComponent;
+    std::shared_ptr<AnimationComponent> culledAnimationComponent =
+        componentOwnerWithGraphics.addComponent<AnimationComponent>(animator, camera);
+};
+
 TEST_F(AnimationComponentTest, update)
 {
     EXPECT_CALL(*animator, update(deltaTime));
@@ -68,4 +96,37 @@ TEST_F(AnimationComponentTest, getAnimationDirection)
     const auto actualAnimationDirection = animationComponent.getAnimationDirection();
 
     ASSERT_EQ(actualAnimationDirection, animationDirection);
+}
+
+TEST_F(AnimationComponentTest, lateUpdateWithoutGraphicsComponent_shouldKeepAnimationVisible)
+{
+    animationComponent.loadDependentComponents();
+
+    animationComponent.lateUpdate(deltaTime);
+}
+
+TEST_F(AnimationComponentVisibilityTest, givenGraphicsInCameraView_shouldKeepAnimationVisible)
+{
+    culledAnimationComponent->lateUpdate(deltaTime);
+}
+
+TEST_F(AnimationComponentVisibilityTest, givenGraphicsOnInvisibleLayer_shouldHideAnimation)
+{
+    EXPECT_CALL(*rendererPool, setVisibility(graphicsId, graphics::VisibilityLayer::Invisible));
+    graphicsComponent->setVisibility(graphics::VisibilityLayer::Invisible);
+    EXPECT_CALL(*animator, setVisible(false));
+
+    culledAnimationComponent->lateUpdate(deltaTime);
+}
+
+TEST_F(AnimationComponentVisibilityTest, givenGraphicsOutsideOfCameraView_shouldHideAnimationUntilItIsInView)
+{
+    camera->setCenter({100, 100});
+    EXPECT_CALL(*animator, setVisible(false));
+    culledAnimationComponent->lateUpdate(deltaTime);
+    culledAnimationComponent->lateUpdate(deltaTime);
+
+    camera->setCenter({10, 10});
+    EXPECT_CALL(*animator, setVisible(true));
+    culledAnimationComponent->lateUpdate(deltaTime);
 }
\ No newline at end of file
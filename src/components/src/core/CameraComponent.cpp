@@ -0,0 +1,33 @@
+#include "CameraComponent.h"
+
+#include "ComponentOwner.h"
+
+namespace components::core
+{
+
+CameraComponent::CameraComponent(ComponentOwner* ownerInit, std::shared_ptr<graphics::Camera> cameraInit,
+                                 const boost::optional<utils::FloatRect>& bounds,
+                                 const utils::Vector2f& offsetInit)
+    : Component{ownerInit}, camera{std::move(cameraInit)}, offset{offsetInit}
+{
+    if (bounds)
+    {
+        camera->setBounds(*bounds);
+    }
+    camera->setCenter(owner->transform->getPosition() + offset);
+}
+
+CameraComponent::~CameraComponent()
+{
+    camera->reset();
+}
+
+void CameraComponent::lateUpdate(utils::DeltaTime)
+{
+    if (enabled)
+    {
+        camera->setCenter(owner->transform->getPosition() + offset);
+    }
+}
+
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <memory>
+
+#include "Camera.h"
+#include "Component.h"
+#include "Rect.h"
+#include "Vector.h"
+
+namespace components::core
+{
+class CameraComponent : public Component
+{
+public:
+    CameraComponent(ComponentOwner*, std::shared_ptr<graphics::Camera>,
+                    const boost::optional<utils::FloatRect>& bounds = boost::none,
+                    const utils::Vector2f& offset = {0, 0});
+    ~CameraComponent();
+
+    void lateUpdate(utils::DeltaTime) override;
+
+private:
+    std::shared_ptr<graphics::Camera> camera;
+    const utils::Vector2f offset;
+};
+}
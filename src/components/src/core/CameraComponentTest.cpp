@@ -0,0 +1,74 @@
+#include "CameraComponent.h"
+
+#include "gtest/gtest.h"
+
+#include "ComponentOwner.h"
+#include "DeltaTime.h"
+
+using namespace ::testing;
+using namespace graphics;
+using namespace components::core;
+
+namespace
+{
+const utils::Vector2f viewSize{80, 60};
+const utils::Vector2f ownerPosition{100, 50};
+const utils::Vector2f newOwnerPosition{190, 90};
+const utils::Vector2f offset{5, -10};
+const utils::FloatRect bounds{0, 0, 200, 100};
+}
+
+class CameraComponentTest : public Test
+{
+public:
+    std::shared_ptr<Camera> camera = std::make_shared<Camera>(viewSize);
+    ComponentOwner componentOwner{ownerPosition};
+    utils::DeltaTime deltaTime{1};
+};
+
+TEST_F(CameraComponentTest, createCameraComponent_shouldCenterCameraOnOwner)
+{
+    CameraComponent cameraComponent{&componentOwner, camera, boost::none, offset};
+
+    ASSERT_EQ(camera->getCenter(), ownerPosition + offset);
+}
+
+TEST_F(CameraComponentTest, lateUpdate_shouldFollowOwnerPosition)
+{
+    CameraComponent cameraComponent{&componentOwner, camera};
+    componentOwner.transform->setPosition(newOwnerPosition);
+
+    cameraComponent.lateUpdate(deltaTime);
+
+    ASSERT_EQ(camera->getCenter(), newOwnerPosition);
+}
+
+TEST_F(CameraComponentTest, lateUpdate_withBounds_shouldKeepCameraInsideBounds)
+{
+    CameraComponent cameraComponent{&componentOwner, camera, bounds};
+    componentOwner.transform->setPosition(newOwnerPosition);
+
+    cameraComponent.lateUpdate(deltaTime);
+
+    ASSERT_EQ(camera->getCenter(), (utils::Vector2f{160, 70}));
+}
+
+TEST_F(CameraComponentTest, lateUpdate_whenDisabled_shouldNotMoveCamera)
+{
+    CameraComponent cameraComponent{&componentOwner, camera};
+    cameraComponent.disable();
+    componentOwner.transform->setPosition(newOwnerPosition);
+
+    cameraComponent.lateUpdate(deltaTime);
+
+    ASSERT_EQ(camera->getCenter(), ownerPosition);
+}
+
+TEST_F(CameraComponentTest, destroyCameraComponent_shouldResetCamera)
+{
+    {
+        CameraComponent cameraComponent{&componentOwner, camera, bounds};
+    }
+
+    ASSERT_EQ(camera->getCenter(), viewSize / 2.f);
+}
@@ -11,7 +11,15 @@ class ComponentOwner;
 class Component
 {
 public:
-    Component(ComponentOwner* ownerInit) : owner{ownerInit} {}
+    Component(ComponentOwner* ownerInit) : owner{ownerInit}
+    {
+        numberOfComponents++;
+    }
+
+    virtual ~Component()
+    {
+        numberOfComponents--;
+    }
 
     virtual void loadDependentComponents() {}
     virtual void start() {}
@@ -30,8 +38,16 @@ public:
         return enabled;
     }
 
+    static std::size_t getNumberOfComponents()
+    {
+        return numberOfComponents;
+    }
+
 protected:
     ComponentOwner* owner;
     bool enabled{true};
+
+private:
+    inline static std::size_t numberOfComponents{0};
 };
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "ComponentOwner.h"
 
+#include "AllocationTracker.h"
+#include "FrameProfiler.h"
+
 namespace components::core
 {
 ComponentOwner::ComponentOwner(const utils::Vector2f& position)
@@ -9,6 +12,7 @@ ComponentOwner::ComponentOwner(const utils::Vector2f& position)
 
 void ComponentOwner::loadDependentComponents()
 {
+    ALLOCATION_TAG(Components);
     for (int i = components.size() - 1; i >= 0; i--)
     {
         components[i]->loadDependentComponents();
@@ -17,6 +21,7 @@ void ComponentOwner::loadDependentComponents()
 
 void ComponentOwner::start()
 {
+    ALLOCATION_TAG(Components);
     for (int i = components.size() - 1; i >= 0; i--)
     {
         components[i]->start();
@@ -25,6 +30,8 @@ void ComponentOwner::start()
 
 void ComponentOwner::update(utils::DeltaTime deltaTime)
 {
+    PROFILE_ZONE("ComponentOwner::update");
+    ALLOCATION_TAG(Components);
     for (int i = components.size() - 1; i >= 0; i--)
     {
         components[i]->update(deltaTime);
@@ -33,6 +40,7 @@ void ComponentOwner::update(utils::DeltaTime deltaTime)
 
 void ComponentOwner::lateUpdate(utils::DeltaTime deltaTime)
 {
+    ALLOCATION_TAG(Components);
     for (int i = components.size() - 1; i >= 0; i--)
     {
         components[i]->lateUpdate(deltaTime);
@@ -41,6 +49,7 @@ void ComponentOwner::lateUpdate(utils::DeltaTime deltaTime)
 
 void ComponentOwner::enable()
 {
+    ALLOCATION_TAG(Components);
     for (int i = components.size() - 1; i >= 0; i--)
     {
         components[i]->enable();
@@ -49,6 +58,7 @@ void ComponentOwner::enable()
 
 void ComponentOwner::disable()
 {
+    ALLOCATION_TAG(Components);
     for (int i = components.size() - 1; i >= 0; i--)
     {
         components[i]->disable();
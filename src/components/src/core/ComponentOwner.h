@@ -1,10 +1,13 @@
 #pragma once
 
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "AllocationTracker.h"
 #include "Component.h"
 #include "DeltaTime.h"
+#include "TaggedAllocator.h"
 #include "TransformComponent.h"
 
 namespace components::core
@@ -22,7 +25,7 @@ public:
     void disable();
 
     template <typename T, typename... Args>
-    std::shared_ptr<T> addComponent(Args... args)
+    std::shared_ptr<T> addComponent(Args&&... args)
     {
         static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
 
@@ -34,7 +37,8 @@ public:
             }
         }
 
-        std::shared_ptr<T> newComponent = std::make_shared<T>(this, args...);
+        std::shared_ptr<T> newComponent = std::allocate_shared<T>(
+            utils::TaggedAllocator<T, utils::AllocationTag::Components>{}, this, std::forward<Args>(args)...);
         components.push_back(newComponent);
 
         return newComponent;
@@ -35,3 +35,15 @@ TEST_F(ComponentTest, enableComponent)
 
     ASSERT_TRUE(component.isEnabled());
 }
+
+TEST_F(ComponentTest, numberOfComponents_shouldFollowComponentsLifetime)
+{
+    const auto numberOfComponents = Component::getNumberOfComponents();
+
+    {
+        Component otherComponent{&componentOwner};
+        ASSERT_EQ(Component::getNumberOfComponents(), numberOfComponents + 1);
+    }
+
+    ASSERT_EQ(Component::getNumberOfComponents(), numberOfComponents);
+}
@@ -7,19 +7,22 @@ namespace components::core
 
 GraphicsComponent::GraphicsComponent(ComponentOwner* ownerInit,
                                      std::shared_ptr<graphics::RendererPool> rendererPoolInit,
-                                     const utils::Vector2f& size, const utils::Vector2f& position,
+                                     const utils::Vector2f& sizeInit, const utils::Vector2f& position,
                                      const graphics::Color& color, graphics::VisibilityLayer layer)
-    : Component{ownerInit}, rendererPool{std::move(rendererPoolInit)}, visibilityLayer{layer}
+    : Component{ownerInit},
+      rendererPool{std::move(rendererPoolInit)},
+      size{sizeInit},
+      visibilityLayer{layer}
 {
     id = rendererPool->acquire(size, position, color, layer);
 }
 
 GraphicsComponent::GraphicsComponent(ComponentOwner* owner,
                                      std::shared_ptr<graphics::RendererPool> rendererPoolInit,
-                                     const utils::Vector2f& size, const utils::Vector2f& position,
+                                     const utils::Vector2f& sizeInit, const utils::Vector2f& position,
                                      const graphics::TexturePath& texturePath,
                                      graphics::VisibilityLayer layer)
-    : Component{owner}, rendererPool{std::move(rendererPoolInit)}, visibilityLayer{layer}
+    : Component{owner}, rendererPool{std::move(rendererPoolInit)}, size{sizeInit}, visibilityLayer{layer}
 {
     id = rendererPool->acquire(size, position, texturePath, layer);
 }
@@ -53,6 +56,16 @@ void GraphicsComponent::setVisibility(graphics::VisibilityLayer layer)
     visibilityLayer = layer;
 }
 
+bool GraphicsComponent::isVisible() const
+{
+    return enabled && visibilityLayer != graphics::VisibilityLayer::Invisible;
+}
+
+const utils::Vector2f& GraphicsComponent::getSize() const
+{
+    return size;
+}
+
 void GraphicsComponent::enable()
 {
     Component::enable();
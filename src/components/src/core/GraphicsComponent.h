@@ -26,6 +26,8 @@ public:
     const graphics::GraphicsId& getGraphicsId();
     void setColor(const graphics::Color&);
     void setVisibility(graphics::VisibilityLayer);
+    bool isVisible() const;
+    const utils::Vector2f& getSize() const;
     void setOutline(float thickness, const sf::Color& color);
     void setTexture(const std::string& texturePath);
     void enable() override;
@@ -34,6 +36,7 @@ public:
 private:
     std::shared_ptr<graphics::RendererPool> rendererPool;
     graphics::GraphicsId id;
+    utils::Vector2f size;
     graphics::VisibilityLayer visibilityLayer;
 };
 }
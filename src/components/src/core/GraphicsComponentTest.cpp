@@ -131,6 +131,32 @@ TEST_F(GraphicsComponentTest, shouldSetVisibility)
     expectReleaseGraphicsId();
 }
 
+TEST_F(GraphicsComponentTest, getSize_shouldReturnSizeGivenWithConstruction)
+{
+    expectCreateGraphicsComponent();
+    const auto graphicsComponent = createGraphicsComponent();
+
+    ASSERT_EQ(graphicsComponent->getSize(), size);
+    expectReleaseGraphicsId();
+}
+
+TEST_F(GraphicsComponentTest, givenInvisibleLayerOrDisabledComponent_shouldNotBeVisible)
+{
+    expectCreateGraphicsComponent();
+    const auto graphicsComponent = createGraphicsComponent();
+    ASSERT_TRUE(graphicsComponent->isVisible());
+    EXPECT_CALL(*rendererPool, setVisibility(graphicsId, invisible)).Times(2);
+    EXPECT_CALL(*rendererPool, setVisibility(graphicsId, visibility));
+
+    graphicsComponent->setVisibility(invisible);
+    ASSERT_FALSE(graphicsComponent->isVisible());
+    graphicsComponent->setVisibility(visibility);
+    graphicsComponent->disable();
+    ASSERT_FALSE(graphicsComponent->isVisible());
+
+    expectReleaseGraphicsId();
+}
+
 TEST_F(GraphicsComponentTest, disableComponent_shouldSetInvisibleAndSetDisabled)
 {
     expectCreateGraphicsComponent();
@@ -0,0 +1,65 @@
+#include "AssetsHotReloader.h"
+
+#include <iostream>
+
+namespace game
+{
+
+AssetsHotReloader::AssetsHotReloader(
+    std::unique_ptr<utils::FileWatcher> fileWatcherInit,
+    std::shared_ptr<graphics::RendererPool> rendererPoolInit,
+    std::shared_ptr<animations::AnimationClipLibrary> animationClipLibraryInit,
+    utils::FilePath animatorSettingsFilePathInit)
+    : fileWatcher{std::move(fileWatcherInit)},
+      rendererPool{std::move(rendererPoolInit)},
+      animationClipLibrary{std::move(animationClipLibraryInit)},
+      animatorSettingsFilePath{std::move(animatorSettingsFilePathInit)},
+      numberOfAnimatorsWithWatchedTextures{0}
+{
+    fileWatcher->watchFile(animatorSettingsFilePath);
+    watchLoadedTextures();
+}
+
+void AssetsHotReloader::reloadChangedAssets()
+{
+    for (const auto& changedFilePath : fileWatcher->pollChangedFiles())
+    {
+        if (changedFilePath == animatorSettingsFilePath)
+        {
+            reloadAnimatorDefinitions();
+        }
+        else
+        {
+            rendererPool->reloadTexture(changedFilePath);
+        }
+    }
+
+    if (animationClipLibrary->getNumberOfLoadedAnimators() != numberOfAnimatorsWithWatchedTextures)
+    {
+        watchLoadedTextures();
+    }
+}
+
+void AssetsHotReloader::reloadAnimatorDefinitions()
+{
+    try
+    {
+        animationClipLibrary->reloadAnimatorDefinitions();
+        watchLoadedTextures();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Animator settings not reloaded: " << e.what() << "\n";
+    }
+}
+
+void AssetsHotReloader::watchLoadedTextures()
+{
+    for (const auto& texturePath : animationClipLibrary->getLoadedTexturePaths())
+    {
+        fileWatcher->watchFile(texturePath);
+    }
+    numberOfAnimatorsWithWatchedTextures = animationClipLibrary->getNumberOfLoadedAnimators();
+}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+
+#include "AnimationClipLibrary.h"
+#include "FileWatcher.h"
+#include "RendererPool.h"
+
+namespace game
+{
+class AssetsHotReloader
+{
+public:
+    AssetsHotReloader(std::unique_ptr<utils::FileWatcher>, std::shared_ptr<graphics::RendererPool>,
+                      std::shared_ptr<animations::AnimationClipLibrary>,
+                      utils::FilePath animatorSettingsFilePath);
+
+    void reloadChangedAssets();
+
+private:
+    void reloadAnimatorDefinitions();
+    void watchLoadedTextures();
+
+    std::unique_ptr<utils::FileWatcher> fileWatcher;
+    std::shared_ptr<graphics::RendererPool> rendererPool;
+    std::shared_ptr<animations::AnimationClipLibrary> animationClipLibrary;
+    const utils::FilePath animatorSettingsFilePath;
+    std::size_t numberOfAnimatorsWithWatchedTextures;
+};
+}
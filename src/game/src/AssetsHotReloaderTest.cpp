@@ -0,0 +1,115 @@
+#include "AssetsHotReloader.h"
+
+#include "gtest/gtest.h"
+
+#include "AnimatorSettingsRepositoryMock.h"
+#include "FileWatcherMock.h"
+#include "RendererPoolMock.h"
+
+#include "GetProjectPath.h"
+
+using namespace ::testing;
+using namespace game;
+
+class AssetsHotReloaderTest_Base : public Test
+{
+public:
+    AssetsHotReloaderTest_Base()
+    {
+        EXPECT_CALL(*fileWatcher, watchFile(animatorSettingsFilePath));
+    }
+
+    const utils::FilePath animatorSettingsFilePath{"config/animators.yaml"};
+    const std::string projectPath{utils::getProjectPath("chimarrao-platformer")};
+    const graphics::TexturePath firstIdleTexturePath{projectPath + "idle/x1.txt"};
+    const graphics::TexturePath secondIdleTexturePath{projectPath + "idle/x2.txt"};
+    const std::string animatorName{"player"};
+    const animations::AnimatorSettings animatorSettings{animatorName, {{"idle", "idle/x1.txt", 2, 0.5}}, {}};
+    const animations::AnimatorSettings invalidAnimatorSettings{animatorName, {}, {}};
+    std::unique_ptr<StrictMock<utils::FileWatcherMock>> fileWatcherInit =
+        std::make_unique<StrictMock<utils::FileWatcherMock>>();
+    StrictMock<utils::FileWatcherMock>* fileWatcher = fileWatcherInit.get();
+    std::shared_ptr<NiceMock<graphics::RendererPoolMock>> rendererPool =
+        std::make_shared<NiceMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<StrictMock<animations::AnimatorSettingsRepositoryMock>> animatorSettingsRepository =
+        std::make_shared<StrictMock<animations::AnimatorSettingsRepositoryMock>>();
+    std::shared_ptr<animations::AnimationClipLibrary> animationClipLibrary =
+        std::make_shared<animations::AnimationClipLibrary>(rendererPool, animatorSettingsRepository);
+};
+
+class AssetsHotReloaderTest : public AssetsHotReloaderTest_Base
+{
+public:
+    void loadAnimatorWatchedByHotReloader()
+    {
+        EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(animatorName))
+            .WillOnce(Return(animatorSettings));
+        animationClipLibrary->getAnimatorDefinition(animatorName);
+        EXPECT_CALL(*fileWatcher, pollChangedFiles()).WillOnce(Return(std::vector<utils::FilePath>{}));
+        expectTexturesWatched();
+        assetsHotReloader.reloadChangedAssets();
+    }
+
+    void expectTexturesWatched()
+    {
+        EXPECT_CALL(*fileWatcher, watchFile(firstIdleTexturePath));
+        EXPECT_CALL(*fileWatcher, watchFile(secondIdleTexturePath));
+    }
+
+    AssetsHotReloader assetsHotReloader{std::move(fileWatcherInit), rendererPool, animationClipLibrary,
+                                        animatorSettingsFilePath};
+};
+
+TEST_F(AssetsHotReloaderTest, givenNoChangedFiles_shouldNotReloadAnything)
+{
+    EXPECT_CALL(*fileWatcher, pollChangedFiles()).WillOnce(Return(std::vector<utils::FilePath>{}));
+    EXPECT_CALL(*rendererPool, reloadTexture(_)).Times(0);
+
+    assetsHotReloader.reloadChangedAssets();
+}
+
+TEST_F(AssetsHotReloaderTest, givenNewlyLoadedAnimator_shouldWatchItsTextures)
+{
+    loadAnimatorWatchedByHotReloader();
+}
+
+TEST_F(AssetsHotReloaderTest, givenChangedTexture_shouldReloadTextureInRendererPool)
+{
+    loadAnimatorWatchedByHotReloader();
+    EXPECT_CALL(*fileWatcher, pollChangedFiles())
+        .WillOnce(Return(std::vector<utils::FilePath>{secondIdleTexturePath}));
+    EXPECT_CALL(*rendererPool, reloadTexture(secondIdleTexturePath)).WillOnce(Return(true));
+
+    assetsHotReloader.reloadChangedAssets();
+}
+
+TEST_F(AssetsHotReloaderTest, givenChangedAnimatorSettings_shouldReloadAnimatorDefinitions)
+{
+    loadAnimatorWatchedByHotReloader();
+    const auto animatorDefinition = animationClipLibrary->getAnimatorDefinition(animatorName);
+    EXPECT_CALL(*fileWatcher, pollChangedFiles())
+        .WillOnce(Return(std::vector<utils::FilePath>{animatorSettingsFilePath}));
+    EXPECT_CALL(*animatorSettingsRepository, reloadAnimatorsSettings());
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(animatorName))
+        .WillOnce(Return(animatorSettings));
+    expectTexturesWatched();
+
+    assetsHotReloader.reloadChangedAssets();
+
+    ASSERT_EQ(animatorDefinition->revision, 1u);
+}
+
+TEST_F(AssetsHotReloaderTest, givenInvalidChangedAnimatorSettings_shouldKeepPreviousAnimatorDefinitions)
+{
+    loadAnimatorWatchedByHotReloader();
+    const auto animatorDefinition = animationClipLibrary->getAnimatorDefinition(animatorName);
+    EXPECT_CALL(*fileWatcher, pollChangedFiles())
+        .WillOnce(Return(std::vector<utils::FilePath>{animatorSettingsFilePath}));
+    EXPECT_CALL(*animatorSettingsRepository, reloadAnimatorsSettings());
+    EXPECT_CALL(*animatorSettingsRepository, getAnimatorSettings(animatorName))
+        .WillOnce(Return(invalidAnimatorSettings));
+
+    ASSERT_NO_THROW(assetsHotReloader.reloadChangedAssets());
+
+    ASSERT_EQ(animatorDefinition->revision, 0u);
+}
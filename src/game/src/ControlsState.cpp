@@ -88,6 +88,8 @@ void ControlsState::initialize()
 
 void ControlsState::update(const utils::DeltaTime& deltaTime)
 {
+    freezeClickableButtonsTimer.update(deltaTime);
+
     if (buttonsActionsFrozen &&
         freezeClickableButtonsTimer.getElapsedSeconds() > timeAfterButtonsCanBeClicked)
     {
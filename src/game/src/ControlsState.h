@@ -1,8 +1,8 @@
 #pragma once
 
 #include "InputObserver.h"
+#include "SimulationTimer.h"
 #include "State.h"
-#include "Timer.h"
 #include "core/ComponentOwner.h"
 
 namespace game
@@ -47,7 +47,7 @@ private:
     std::vector<std::unique_ptr<components::core::ComponentOwner>> texts;
     std::vector<std::unique_ptr<components::core::ComponentOwner>> buttons;
     bool buttonsActionsFrozen = true;
-    utils::Timer freezeClickableButtonsTimer;
+    utils::SimulationTimer freezeClickableButtonsTimer;
     const float timeAfterButtonsCanBeClicked;
 };
 }
\ No newline at end of file
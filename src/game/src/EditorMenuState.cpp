@@ -57,11 +57,14 @@ void EditorMenuState::initialize()
         button->getComponent<components::core::ClickableComponent>()->disable();
     }
 
-    possibleLeaveFromStateTimer.start();
+    possibleLeaveFromStateTimer.restart();
 }
 
 void EditorMenuState::update(const utils::DeltaTime& deltaTime)
 {
+    freezeClickableButtonsTimer.update(deltaTime);
+    possibleLeaveFromStateTimer.update(deltaTime);
+
     if (buttonsActionsFrozen &&
         freezeClickableButtonsTimer.getElapsedSeconds() > timeAfterButtonsCanBeClicked)
     {
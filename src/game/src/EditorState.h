@@ -3,10 +3,11 @@
 #include <vector>
 
 #include "InputObserver.h"
+#include "SimulationTimer.h"
 #include "State.h"
 #include "TileMap.h"
-#include "Timer.h"
-#include "core/ClickableComponent.h"
+#include "TileMapEditorComponent.h"
+#include "core/ComponentOwner.h"
 
 namespace game
 {
@@ -32,15 +33,13 @@ private:
 
     const input::InputStatus* inputStatus;
     bool paused;
-    utils::Timer pauseTimer;
+    utils::SimulationTimer pauseTimer;
     const float timeAfterStateCouldBePaused;
-    int currentTileId;
-    std::string currentTilePath;
     std::unique_ptr<components::core::ComponentOwner> background;
-    std::vector<std::shared_ptr<components::core::ComponentOwner>> clickableTileMap;
-    std::unique_ptr<TileMap> tileMap;
+    std::shared_ptr<TileMap> tileMap;
+    std::unique_ptr<components::core::ComponentOwner> tileMapEditor;
     bool buttonsActionsFrozen = true;
-    utils::Timer freezeClickableButtonsTimer;
+    utils::SimulationTimer freezeClickableButtonsTimer;
     const float timeAfterButtonsCanBeClicked;
 };
 }
\ No newline at end of file
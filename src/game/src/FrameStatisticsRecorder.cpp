@@ -0,0 +1,63 @@
+#include "FrameStatisticsRecorder.h"
+
+#include <fstream>
+#include <iostream>
+
+namespace game
+{
+namespace
+{
+const auto writeReportKey{input::InputKey::F4};
+const utils::DeltaTime hitchThreshold{1.f / 30.f};
+const auto updatePhaseIndex{0u};
+const auto renderPhaseIndex{1u};
+const auto presentPhaseIndex{2u};
+}
+
+FrameStatisticsRecorder::FrameStatisticsRecorder(std::shared_ptr<input::InputManager> inputManagerInit,
+                                                 std::string reportFilePathInit)
+    : inputManager{std::move(inputManagerInit)},
+      reportFilePath{std::move(reportFilePathInit)},
+      frameStatistics{{"update", "render", "present"}, hitchThreshold}
+{
+    inputManager->registerObserver(this);
+}
+
+FrameStatisticsRecorder::~FrameStatisticsRecorder()
+{
+    inputManager->removeObserver(this);
+}
+
+void FrameStatisticsRecorder::recordFrame(const FrameTimings& frameTimings)
+{
+    frameStatistics.recordFrame(getFrameTime(frameTimings));
+    frameStatistics.recordPhase(updatePhaseIndex, frameTimings.update);
+    frameStatistics.recordPhase(renderPhaseIndex, frameTimings.render);
+    frameStatistics.recordPhase(presentPhaseIndex, frameTimings.present);
+}
+
+void FrameStatisticsRecorder::handleInputStatus(const input::InputStatus& inputStatus)
+{
+    if (inputStatus.isKeyReleased(writeReportKey))
+    {
+        writeReport();
+    }
+}
+
+void FrameStatisticsRecorder::writeReport() const
+{
+    std::ofstream reportFile{reportFilePath};
+    if (not reportFile)
+    {
+        std::cerr << "Cannot write frame statistics to: " << reportFilePath << "\n";
+        return;
+    }
+    frameStatistics.writeReport(reportFile);
+}
+
+const utils::FrameStatistics& FrameStatisticsRecorder::getFrameStatistics() const
+{
+    return frameStatistics;
+}
+
+}
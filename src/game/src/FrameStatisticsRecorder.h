@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "FrameStatistics.h"
+#include "FrameTimings.h"
+#include "InputManager.h"
+#include "InputObserver.h"
+
+namespace game
+{
+class FrameStatisticsRecorder : public input::InputObserver
+{
+public:
+    FrameStatisticsRecorder(std::shared_ptr<input::InputManager>, std::string reportFilePath);
+    ~FrameStatisticsRecorder();
+
+    void recordFrame(const FrameTimings&);
+    void handleInputStatus(const input::InputStatus&) override;
+    void writeReport() const;
+    const utils::FrameStatistics& getFrameStatistics() const;
+
+private:
+    std::shared_ptr<input::InputManager> inputManager;
+    const std::string reportFilePath;
+    utils::FrameStatistics frameStatistics;
+};
+}
@@ -0,0 +1,85 @@
+#include "FrameStatisticsRecorder.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "InputManagerMock.h"
+
+using namespace ::testing;
+using namespace game;
+
+namespace
+{
+const std::string reportFilePath{
+    (std::filesystem::temp_directory_path() / "FrameStatisticsRecorderTest.csv").string()};
+const FrameTimings frameTimings{utils::DeltaTime{0.004f}, utils::DeltaTime{0.003f}, utils::DeltaTime{0.009f}};
+const FrameTimings hitchFrameTimings{utils::DeltaTime{0.04f}, utils::DeltaTime{0.003f},
+                                     utils::DeltaTime{0.009f}};
+}
+
+class FrameStatisticsRecorderTest_Base : public Test
+{
+public:
+    FrameStatisticsRecorderTest_Base()
+    {
+        EXPECT_CALL(*inputManager, registerObserver(_));
+        EXPECT_CALL(*inputManager, removeObserver(_));
+        releasedWriteReportKeyStatus.setKeyPressed(input::InputKey::F4);
+        releasedWriteReportKeyStatus.setReleasedKeys();
+        releasedWriteReportKeyStatus.clearPressedKeys();
+        releasedWriteReportKeyStatus.setReleasedKeys();
+    }
+
+    ~FrameStatisticsRecorderTest_Base()
+    {
+        std::filesystem::remove(reportFilePath);
+    }
+
+    input::InputStatus releasedWriteReportKeyStatus;
+    std::shared_ptr<StrictMock<input::InputManagerMock>> inputManager =
+        std::make_shared<StrictMock<input::InputManagerMock>>();
+};
+
+class FrameStatisticsRecorderTest : public FrameStatisticsRecorderTest_Base
+{
+public:
+    FrameStatisticsRecorder recorder{inputManager, reportFilePath};
+};
+
+TEST_F(FrameStatisticsRecorderTest, recordFrame_shouldRecordFrameTimeAndEachPhase)
+{
+    recorder.recordFrame(frameTimings);
+    recorder.recordFrame(hitchFrameTimings);
+
+    const auto& frameStatistics = recorder.getFrameStatistics();
+    ASSERT_EQ(frameStatistics.getFrameStatistics().count, 2u);
+    ASSERT_EQ(frameStatistics.getFrameStatistics().hitches, 1u);
+    ASSERT_EQ(frameStatistics.getPhaseStatistics(0).name, "update");
+    ASSERT_EQ(frameStatistics.getPhaseStatistics(0).hitches, 1u);
+    ASSERT_EQ(frameStatistics.getPhaseStatistics(2).name, "present");
+    ASSERT_EQ(frameStatistics.getPhaseStatistics(2).count, 2u);
+}
+
+TEST_F(FrameStatisticsRecorderTest, releasedWriteReportKey_shouldWriteReportFile)
+{
+    recorder.recordFrame(frameTimings);
+
+    recorder.handleInputStatus(releasedWriteReportKeyStatus);
+
+    std::ifstream reportFile{reportFilePath};
+    std::string header;
+    std::string frameRow;
+    std::getline(reportFile, header);
+    std::getline(reportFile, frameRow);
+    ASSERT_EQ(header, "name,count,p50Milliseconds,p95Milliseconds,p99Milliseconds,maxMilliseconds,hitches");
+    ASSERT_EQ(frameRow.rfind("frame,1,", 0), 0u);
+}
+
+TEST_F(FrameStatisticsRecorderTest, givenNoReleasedKey_shouldNotWriteReportFile)
+{
+    recorder.handleInputStatus(input::InputStatus{});
+
+    ASSERT_FALSE(std::filesystem::exists(reportFilePath));
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <ostream>
+#include <tuple>
+
+#include "DeltaTime.h"
+
+namespace game
+{
+struct FrameTimings
+{
+    utils::DeltaTime update;
+    utils::DeltaTime render;
+    utils::DeltaTime present;
+};
+
+inline utils::DeltaTime getFrameTime(const FrameTimings& frameTimings)
+{
+    return frameTimings.update + frameTimings.render + frameTimings.present;
+}
+
+inline bool operator==(const FrameTimings& lhs, const FrameTimings& rhs)
+{
+    auto tieStruct = [](const FrameTimings& frameTimings) {
+        return std::tie(frameTimings.update, frameTimings.render, frameTimings.present);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const FrameTimings& frameTimings)
+{
+    return os << "update: " << frameTimings.update.count() << " render: " << frameTimings.render.count()
+              << " present: " << frameTimings.present.count();
+}
+}
@@ -1,21 +1,42 @@
 #include "Game.h"
 
 #include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
 #include <thread>
 
+#include "AllocationTracker.h"
+#include "BinaryFile.h"
 #include "DefaultInputManager.h"
 #include "DefaultInputObservationHandler.h"
 #include "EditorState.h"
+#include "FrameProfiler.h"
 #include "GameState.h"
 #include "GraphicsFactory.h"
+#include "InputRecordingBinarySerializer.h"
 #include "MenuState.h"
 #include "Vector.h"
 #include "WindowFactory.h"
 
 namespace game
 {
-Game::Game() : dt{0}
+namespace
 {
+const auto allocationReportFileEnvironmentVariable{"CHIMARRAO_ALLOCATION_REPORT_FILE"};
+const auto frameStatisticsFileEnvironmentVariable{"CHIMARRAO_FRAME_STATISTICS_FILE"};
+const auto defaultFrameStatisticsFilePath{"frameStatistics.csv"};
+const auto inputLatencyFileEnvironmentVariable{"CHIMARRAO_INPUT_LATENCY_FILE"};
+const auto profilerTraceFileEnvironmentVariable{"CHIMARRAO_PROFILER_TRACE_FILE"};
+const auto recordInputFileEnvironmentVariable{"CHIMARRAO_RECORD_INPUT_FILE"};
+const auto replayInputFileEnvironmentVariable{"CHIMARRAO_REPLAY_INPUT_FILE"};
+}
+
+Game::Game()
+    : dt{0}, inputLatencyRecordingEnabled{std::getenv(inputLatencyFileEnvironmentVariable) != nullptr}
+{
+    utils::FrameProfiler::setEnabled(std::getenv(profilerTraceFileEnvironmentVariable) != nullptr);
+
     auto graphicsFactory = graphics::GraphicsFactory::createGraphicsFactory();
     auto windowFactory = window::WindowFactory::createWindowFactory();
 
@@ -25,32 +46,84 @@ Game::Game() : dt{0}
     const utils::Vector2u mapSize{80, 60};
 
     rendererPool = graphicsFactory->createRendererPool(window, windowSize, mapSize);
-    inputManager = std::make_unique<input::DefaultInputManager>(
-        std::make_unique<input::DefaultInputObservationHandler>(), window);
-    timer.start();
+    createInputManager();
+    initializeFrameInstrumentation();
     initStates();
 }
 
+Game::Game(std::shared_ptr<window::Window> windowInit,
+           std::shared_ptr<graphics::RendererPool> rendererPoolInit,
+           std::shared_ptr<input::ReplayInputManager> replayInputManagerInit,
+           const StateCreator& createInitialState, bool inputLatencyRecordingEnabledInit)
+    : dt{0},
+      window{std::move(windowInit)},
+      rendererPool{std::move(rendererPoolInit)},
+      inputManager{replayInputManagerInit},
+      replayInputManager{std::move(replayInputManagerInit)},
+      inputLatencyRecordingEnabled{inputLatencyRecordingEnabledInit}
+{
+    initializeFrameInstrumentation();
+    ALLOCATION_TAG(GameStates);
+    states.push(createInitialState(window, inputManager, rendererPool, states));
+}
+
+Game::~Game()
+{
+    exportInputLatency();
+    exportProfilerTrace();
+    exportFrameStatistics();
+    exportAllocationReport();
+}
+
 void Game::run()
 {
     while (window->isOpen())
     {
         std::this_thread::sleep_for(std::chrono::duration<double, std::nano>(1));
-        processInput();
-        update();
-        lateUpdate();
-        render();
+        runFrame();
     }
 }
 
+void Game::runFrame()
+{
+    PROFILE_ZONE("Game::frame");
+    const auto frameStart = std::chrono::steady_clock::now();
+    processInput();
+    dt = getDeltaTime();
+    update();
+    lateUpdate();
+    frameTimings.update = std::chrono::steady_clock::now() - frameStart;
+    render();
+    utils::AllocationTracker::frameFinished();
+}
+
+void Game::initializeFrameInstrumentation()
+{
+    performanceOverlay = std::make_unique<PerformanceOverlay>(inputManager, rendererPool);
+    const auto frameStatisticsFilePath = std::getenv(frameStatisticsFileEnvironmentVariable);
+    frameStatisticsRecorder = std::make_unique<FrameStatisticsRecorder>(
+        inputManager, frameStatisticsFilePath ? frameStatisticsFilePath : defaultFrameStatisticsFilePath);
+    timer.start();
+}
+
 void Game::processInput()
 {
+    PROFILE_ZONE("Game::processInput");
+    if (replayInputManager)
+    {
+        if (replayInputManager->isFinished())
+        {
+            window->close();
+        }
+        window->update();
+    }
     inputManager->readInput();
 }
 
 void Game::update()
 {
-    dt = timer.getDurationFromLastUpdate();
+    PROFILE_ZONE("Game::update");
+    ALLOCATION_TAG(GameStates);
 
     if (states.empty())
     {
@@ -65,7 +138,8 @@ void Game::update()
 
 void Game::lateUpdate()
 {
-    dt = timer.getDurationFromLastUpdate();
+    PROFILE_ZONE("Game::lateUpdate");
+    ALLOCATION_TAG(GameStates);
 
     if (states.empty())
     {
@@ -79,19 +153,143 @@ void Game::lateUpdate()
 
 void Game::render()
 {
+    PROFILE_ZONE("Game::render");
+    performanceOverlay->update(frameTimings);
+
+    const auto renderStart = std::chrono::steady_clock::now();
     if (not states.empty())
     {
+        ALLOCATION_TAG(GameStates);
         states.top()->render();
     }
 
-    window->update();
+    const auto presentStart = std::chrono::steady_clock::now();
     window->display();
+    frameTimings.render = presentStart - renderStart;
+    frameTimings.present = std::chrono::steady_clock::now() - presentStart;
+    frameStatisticsRecorder->recordFrame(frameTimings);
+    if (inputLatencyRecordingEnabled)
+    {
+        inputLatencyRecorder.framePresented(inputManager->getInputEvents(), input::InputEventClock::now());
+    }
 }
 
 void Game::initStates()
 {
+    ALLOCATION_TAG(GameStates);
     states.push(std::make_unique<MenuState>(window, inputManager, rendererPool, states));
     //    states.push(std::make_unique<EditorState>(window, inputManager, rendererPool, states));
 }
 
+void Game::createInputManager()
+{
+    if (const auto replayInputFilePath = std::getenv(replayInputFileEnvironmentVariable))
+    {
+        const auto buffer = utils::readBinaryFile(replayInputFilePath);
+        auto recording =
+            buffer ? input::InputRecordingBinarySerializer::deserialize(*buffer) : boost::none;
+        if (recording)
+        {
+            replayInputManager = std::make_shared<input::ReplayInputManager>(
+                std::make_unique<input::DefaultInputObservationHandler>(), std::move(*recording));
+            inputManager = replayInputManager;
+            return;
+        }
+        std::cerr << "Cannot load input recording from: " << replayInputFilePath << "\n";
+    }
+
+    auto defaultInputManager = std::make_unique<input::DefaultInputManager>(
+        std::make_unique<input::DefaultInputObservationHandler>(), window);
+
+    if (const auto recordInputFilePath = std::getenv(recordInputFileEnvironmentVariable))
+    {
+        recordingInputManager = std::make_shared<input::RecordingInputManager>(
+            std::move(defaultInputManager), std::make_unique<input::DefaultInputObservationHandler>(),
+            recordInputFilePath);
+        inputManager = recordingInputManager;
+        return;
+    }
+
+    inputManager = std::move(defaultInputManager);
+}
+
+utils::DeltaTime Game::getDeltaTime()
+{
+    const auto measuredDeltaTime = timer.getDurationFromLastUpdate();
+    if (replayInputManager)
+    {
+        return replayInputManager->getDeltaTime();
+    }
+    if (recordingInputManager)
+    {
+        recordingInputManager->recordDeltaTime(measuredDeltaTime);
+    }
+    return measuredDeltaTime;
+}
+
+void Game::exportInputLatency() const
+{
+    if (not inputLatencyRecordingEnabled)
+    {
+        return;
+    }
+    const auto inputLatencyFilePath = std::getenv(inputLatencyFileEnvironmentVariable);
+
+    std::ofstream inputLatencyFile{inputLatencyFilePath};
+    if (not inputLatencyFile)
+    {
+        std::cerr << "Cannot write input latency to: " << inputLatencyFilePath << "\n";
+        return;
+    }
+    inputLatencyRecorder.exportToCsv(inputLatencyFile);
+}
+
+void Game::exportProfilerTrace() const
+{
+    const auto profilerTraceFilePath = std::getenv(profilerTraceFileEnvironmentVariable);
+    if (not profilerTraceFilePath)
+    {
+        return;
+    }
+
+    std::ofstream profilerTraceFile{profilerTraceFilePath};
+    if (not profilerTraceFile)
+    {
+        std::cerr << "Cannot write profiler trace to: " << profilerTraceFilePath << "\n";
+        return;
+    }
+    utils::FrameProfiler::exportChromeTrace(profilerTraceFile);
+}
+
+void Game::exportFrameStatistics() const
+{
+    if (std::getenv(frameStatisticsFileEnvironmentVariable))
+    {
+        frameStatisticsRecorder->writeReport();
+    }
+}
+
+void Game::exportAllocationReport() const
+{
+    const auto allocationReportFilePath = std::getenv(allocationReportFileEnvironmentVariable);
+    if (not allocationReportFilePath)
+    {
+        return;
+    }
+
+    if (not utils::AllocationTracker::isEnabled())
+    {
+        std::cerr << "Cannot report allocations, allocation tracker is disabled in this build\n";
+        return;
+    }
+
+    std::ofstream allocationReportFile{allocationReportFilePath};
+    if (not allocationReportFile)
+    {
+        std::cerr << "Cannot write allocation report to: " << allocationReportFilePath << "\n";
+        return;
+    }
+    utils::AllocationTracker::writeReport(allocationReportFile);
+}
+
 }
\ No newline at end of file
@@ -1,36 +1,66 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <stack>
 
+#include "InputLatencyRecorder.h"
+#include "FrameStatisticsRecorder.h"
+#include "FrameTimings.h"
 #include "InputManager.h"
+#include "PerformanceOverlay.h"
+#include "RecordingInputManager.h"
 #include "RendererPool.h"
+#include "ReplayInputManager.h"
 #include "State.h"
 #include "Timer.h"
 #include "Window.h"
 
 namespace game
 {
+using StateCreator = std::function<std::unique_ptr<State>(
+    const std::shared_ptr<window::Window>&, const std::shared_ptr<input::InputManager>&,
+    const std::shared_ptr<graphics::RendererPool>&, std::stack<std::unique_ptr<State>>&)>;
+
 class Game
 {
 public:
     explicit Game();
+    Game(std::shared_ptr<window::Window>, std::shared_ptr<graphics::RendererPool>,
+         std::shared_ptr<input::ReplayInputManager>, const StateCreator& createInitialState,
+         bool inputLatencyRecordingEnabled);
+    ~Game();
 
     void run();
+    void runFrame();
 
 private:
+    void initializeFrameInstrumentation();
     void processInput();
     void update();
     void lateUpdate();
     void render();
     void initStates();
+    void createInputManager();
+    utils::DeltaTime getDeltaTime();
+    void exportInputLatency() const;
+    void exportProfilerTrace() const;
+    void exportFrameStatistics() const;
+    void exportAllocationReport() const;
 
     utils::Timer timer;
     utils::DeltaTime dt;
     std::shared_ptr<window::Window> window;
     std::shared_ptr<graphics::RendererPool> rendererPool;
     std::shared_ptr<input::InputManager> inputManager;
+    std::shared_ptr<input::ReplayInputManager> replayInputManager;
+    std::shared_ptr<input::RecordingInputManager> recordingInputManager;
+    const bool inputLatencyRecordingEnabled;
+    input::InputLatencyRecorder inputLatencyRecorder;
+    FrameTimings frameTimings;
+    std::unique_ptr<PerformanceOverlay> performanceOverlay;
+    std::unique_ptr<FrameStatisticsRecorder> frameStatisticsRecorder;
     std::stack<std::unique_ptr<State>> states;
 };
 }
\ No newline at end of file
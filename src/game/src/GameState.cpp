@@ -1,17 +1,25 @@
 #include "GameState.h"
 
+#include "AnimatorSettingsCachedReader.h"
+#include "ApplyAnimationFrameChanges.h"
 #include "AnimatorSettingsYamlReader.h"
+#include "DefaultAnimator.h"
 #include "DefaultAnimatorSettingsRepository.h"
 #include "GetProjectPath.h"
+#include "InotifyFileWatcher.h"
 #include "PauseState.h"
-#include "PlayerAnimator.h"
 #include "core/AnimationComponent.h"
+#include "core/CameraComponent.h"
 #include "core/GraphicsComponent.h"
 #include "core/KeyboardMovementComponent.h"
 #include "core/TextComponent.h"
 
 namespace game
 {
+namespace
+{
+const utils::FloatRect levelBounds{0, 0, 80, 60};
+}
 
 GameState::GameState(const std::shared_ptr<window::Window>& windowInit,
                      const std::shared_ptr<input::InputManager>& inputManagerInit,
@@ -20,33 +28,39 @@ GameState::GameState(const std::shared_ptr<window::Window>& windowInit,
     : State{windowInit, inputManagerInit, rendererPoolInit, statesInit},
       inputStatus{nullptr},
       paused{false},
-      timeAfterStateCouldBePaused{0.5f}
+      timeAfterStateCouldBePaused{0.5f},
+      animationClipLibrary{std::make_shared<animations::AnimationClipLibrary>(
+          rendererPool, std::make_shared<animations::DefaultAnimatorSettingsRepository>(
+                            std::make_unique<animations::AnimatorSettingsCachedReader>(
+                                std::make_unique<animations::AnimatorSettingsYamlReader>())))},
+      animationSystem{std::make_shared<animations::AnimationSystem>()}
 {
     inputManager->registerObserver(this);
 
-    animations::DefaultAnimatorSettingsRepository settingsRepository{
-        std::make_unique<animations::AnimatorSettingsYamlReader>()};
-
     player = std::make_shared<components::core::ComponentOwner>(utils::Vector2f{10, 10});
     auto graphicsComponent = player->addComponent<components::core::GraphicsComponent>(
         rendererPool, utils::Vector2f{7, 7}, utils::Vector2f{10, 10}, graphics::Color::Red,
         graphics::VisibilityLayer::Second);
     auto graphicsId = graphicsComponent->getGraphicsId();
     player->addComponent<components::core::KeyboardMovementComponent>(inputManager);
-    auto playerAnimatorSettings = settingsRepository.getAnimatorSettings("player");
-    auto playerAnimator =
-        std::make_shared<animations::PlayerAnimator>(graphicsId, rendererPool, *playerAnimatorSettings);
-    player->addComponent<components::core::AnimationComponent>(playerAnimator);
+    auto playerAnimator = std::make_shared<animations::DefaultAnimator>(
+        graphicsId, animationSystem, animationClipLibrary->getAnimatorDefinition("player"));
+    player->addComponent<components::core::AnimationComponent>(playerAnimator, rendererPool->getCamera());
     player->addComponent<components::core::TextComponent>(
         rendererPool, utils::Vector2f{10, 10}, "hello",
         utils::getProjectPath("chimarrao-platformer") + "resources/fonts/VeraMono.ttf", 13,
         graphics::Color::Black, utils::Vector2f{1.5, -1.5});
+    player->addComponent<components::core::CameraComponent>(rendererPool->getCamera(), levelBounds);
 
     background = std::make_shared<components::core::ComponentOwner>(utils::Vector2f{0, 0});
     background->addComponent<components::core::GraphicsComponent>(
-        rendererPool, utils::Vector2f{80, 60}, utils::Vector2f{0, 0},
+        rendererPool, utils::Vector2f{levelBounds.width, levelBounds.height}, utils::Vector2f{0, 0},
         utils::getProjectPath("chimarrao-platformer") + "resources/BG/background_glacial_mountains.png",
         graphics::VisibilityLayer::Background);
+
+    assetsHotReloader = std::make_unique<AssetsHotReloader>(
+        std::make_unique<utils::InotifyFileWatcher>(), rendererPool, animationClipLibrary,
+        animations::DefaultAnimatorSettingsRepository::getAnimatorSettingsFilePath());
     initialize();
 }
 
@@ -59,11 +73,15 @@ void GameState::initialize()
 {
     player->loadDependentComponents();
     player->start();
-    timer.start();
+    timer.restart();
 }
 
 void GameState::update(const utils::DeltaTime& deltaTime)
 {
+    timer.update(deltaTime);
+
+    assetsHotReloader->reloadChangedAssets();
+
     if (timer.getElapsedSeconds() > timeAfterStateCouldBePaused &&
         inputStatus->isKeyPressed(input::InputKey::Escape))
     {
@@ -81,6 +99,7 @@ void GameState::lateUpdate(const utils::DeltaTime& deltaTime)
     if (not paused)
     {
         player->lateUpdate(deltaTime);
+        animations::applyAnimationFrameChanges(*rendererPool, animationSystem->update(deltaTime));
     }
 }
 
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "AnimationClipLibrary.h"
+#include "AnimationSystem.h"
+#include "AssetsHotReloader.h"
 #include "InputObserver.h"
+#include "SimulationTimer.h"
 #include "State.h"
-#include "Timer.h"
 #include "core/ComponentOwner.h"
 
 namespace game
@@ -27,9 +30,12 @@ public:
 private:
     const input::InputStatus* inputStatus;
     bool paused;
-    utils::Timer timer;
+    utils::SimulationTimer timer;
     const float timeAfterStateCouldBePaused;
+    std::shared_ptr<animations::AnimationClipLibrary> animationClipLibrary;
+    std::shared_ptr<animations::AnimationSystem> animationSystem;
     std::shared_ptr<components::core::ComponentOwner> player;
     std::shared_ptr<components::core::ComponentOwner> background;
+    std::unique_ptr<AssetsHotReloader> assetsHotReloader;
 };
 }
\ No newline at end of file
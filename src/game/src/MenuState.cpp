@@ -77,6 +77,9 @@ void MenuState::initialize()
 
 void MenuState::update(const utils::DeltaTime& deltaTime)
 {
+    freezeClickableButtonsTimer.update(deltaTime);
+    switchButtonTimer.update(deltaTime);
+
     if (buttonsActionsFrozen &&
         freezeClickableButtonsTimer.getElapsedSeconds() > timeAfterButtonsCanBeClicked)
     {
@@ -1,8 +1,8 @@
 #pragma once
 
 #include "InputObserver.h"
+#include "SimulationTimer.h"
 #include "State.h"
-#include "Timer.h"
 #include "Window.h"
 #include "core/ComponentOwner.h"
 
@@ -49,10 +49,10 @@ private:
     std::vector<std::unique_ptr<components::core::ComponentOwner>> buttons;
     std::vector<std::unique_ptr<components::core::ComponentOwner>> icons;
     unsigned int currentButtonIndex;
-    utils::Timer switchButtonTimer;
+    utils::SimulationTimer switchButtonTimer;
     const float timeAfterButtonCanBeSwitched;
     bool buttonsActionsFrozen = true;
-    utils::Timer freezeClickableButtonsTimer;
+    utils::SimulationTimer freezeClickableButtonsTimer;
     const float timeAfterButtonsCanBeClicked;
 };
 }
\ No newline at end of file
@@ -53,11 +53,14 @@ void PauseState::initialize()
         button->getComponent<components::core::ClickableComponent>()->disable();
     }
 
-    timer.start();
+    timer.restart();
 }
 
 void PauseState::update(const utils::DeltaTime& deltaTime)
 {
+    freezeClickableButtonsTimer.update(deltaTime);
+    timer.update(deltaTime);
+
     if (buttonsActionsFrozen &&
         freezeClickableButtonsTimer.getElapsedSeconds() > timeAfterButtonsCanBeClicked)
     {
@@ -1,8 +1,8 @@
 #pragma once
 
 #include "InputObserver.h"
+#include "SimulationTimer.h"
 #include "State.h"
-#include "Timer.h"
 #include "core/ComponentOwner.h"
 
 namespace game
@@ -35,7 +35,7 @@ private:
                    const utils::Vector2f& textOffset, std::function<void(void)> clickAction);
 
     const input::InputStatus* inputStatus;
-    utils::Timer timer;
+    utils::SimulationTimer timer;
     const float timeAfterLeaveStateIsPossible;
     bool shouldBackToGame;
     bool shouldBackToMenu;
@@ -43,7 +43,7 @@ private:
     std::unique_ptr<components::core::ComponentOwner> background;
     std::vector<std::unique_ptr<components::core::ComponentOwner>> buttons;
     bool buttonsActionsFrozen = true;
-    utils::Timer freezeClickableButtonsTimer;
+    utils::SimulationTimer freezeClickableButtonsTimer;
     const float timeAfterButtonsCanBeClicked;
 };
 }
\ No newline at end of file
@@ -0,0 +1,249 @@
+#include "PerformanceOverlay.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "GetProjectPath.h"
+#include "core/Component.h"
+
+namespace game
+{
+namespace
+{
+const auto toggleKey{input::InputKey::F3};
+const auto numberOfGraphSamples{30u};
+const auto numberOfTextLines{4u};
+const auto maximumTextLineLength{64u};
+const utils::DeltaTime textsRefreshInterval{0.1f};
+const utils::Vector2f overlayMargin{1, 1};
+const utils::Vector2f overlaySize{32, 14};
+const auto graphBarWidth{0.9f};
+const auto graphBarSpacing{1.f};
+const auto graphHeight{8.f};
+const auto graphMillisecondsRange{1000.f / 30.f};
+const utils::Vector2f graphOffset{1, 13};
+const utils::Vector2f textOffset{1, 0.5f};
+const auto textLineHeight{1.2f};
+const auto characterSize{10u};
+const graphics::Color backgroundColor{0, 0, 0, 170};
+const graphics::Color textColor{graphics::Color::White};
+const std::array<graphics::Color, 3> graphBarColors{graphics::Color::Green, graphics::Color::Cyan,
+                                                    graphics::Color::Yellow};
+const auto fontPath{utils::getProjectPath("chimarrao-platformer") + "resources/fonts/VeraMono.ttf"};
+
+float toMilliseconds(utils::DeltaTime duration)
+{
+    return duration.count() * 1000.f;
+}
+}
+
+PerformanceOverlay::PerformanceOverlay(std::shared_ptr<input::InputManager> inputManagerInit,
+                                       std::shared_ptr<graphics::RendererPool> rendererPoolInit)
+    : inputManager{std::move(inputManagerInit)},
+      rendererPool{std::move(rendererPoolInit)},
+      visible{false},
+      frameTimingsHistory(numberOfGraphSamples, FrameTimings{}),
+      nextFrameTimingsIndex{0},
+      timeSinceTextsRefresh{0},
+      textLines(numberOfTextLines)
+{
+    for (auto& textLine : textLines)
+    {
+        textLine.reserve(maximumTextLineLength);
+    }
+    inputManager->registerObserver(this);
+}
+
+PerformanceOverlay::~PerformanceOverlay()
+{
+    inputManager->removeObserver(this);
+    hide();
+}
+
+void PerformanceOverlay::update(const FrameTimings& frameTimings)
+{
+    const auto sampleIndex = nextFrameTimingsIndex;
+    frameTimingsHistory[sampleIndex] = frameTimings;
+    nextFrameTimingsIndex = (nextFrameTimingsIndex + 1) % frameTimingsHistory.size();
+
+    if (not visible)
+    {
+        return;
+    }
+
+    const auto visibleArea = rendererPool->getCamera()->getVisibleArea();
+    const auto origin = utils::Vector2f{visibleArea.left, visibleArea.top} + overlayMargin;
+    if (origin != currentOrigin)
+    {
+        moveTo(origin);
+    }
+    else
+    {
+        refreshGraph(origin, sampleIndex);
+    }
+
+    timeSinceTextsRefresh += getFrameTime(frameTimings);
+    if (timeSinceTextsRefresh >= textsRefreshInterval)
+    {
+        refreshTexts();
+    }
+}
+
+void PerformanceOverlay::handleInputStatus(const input::InputStatus& inputStatus)
+{
+    if (not inputStatus.isKeyReleased(toggleKey))
+    {
+        return;
+    }
+
+    if (visible)
+    {
+        hide();
+    }
+    else
+    {
+        show();
+    }
+}
+
+bool PerformanceOverlay::isVisible() const
+{
+    return visible;
+}
+
+void PerformanceOverlay::show()
+{
+    backgroundId = rendererPool->acquire(overlaySize, {0, 0}, backgroundColor);
+    for (auto sampleIndex = 0u; sampleIndex < numberOfGraphSamples; sampleIndex++)
+    {
+        std::array<graphics::GraphicsId, 3> barIds;
+        for (std::size_t phaseIndex = 0; phaseIndex < barIds.size(); phaseIndex++)
+        {
+            barIds[phaseIndex] =
+                rendererPool->acquire({graphBarWidth, 0}, {0, 0}, graphBarColors[phaseIndex]);
+        }
+        graphBarIds.push_back(barIds);
+    }
+    for (auto lineIndex = 0u; lineIndex < numberOfTextLines; lineIndex++)
+    {
+        textIds.push_back(rendererPool->acquireText({0, 0}, "", fontPath, characterSize,
+                                                    graphics::VisibilityLayer::First, textColor));
+    }
+    visible = true;
+    currentOrigin = boost::none;
+    timeSinceTextsRefresh = textsRefreshInterval;
+}
+
+void PerformanceOverlay::hide()
+{
+    if (not visible)
+    {
+        return;
+    }
+
+    rendererPool->release(backgroundId);
+    for (const auto& barIds : graphBarIds)
+    {
+        for (const auto& barId : barIds)
+        {
+            rendererPool->release(barId);
+        }
+    }
+    for (const auto& textId : textIds)
+    {
+        rendererPool->release(textId);
+    }
+    graphBarIds.clear();
+    textIds.clear();
+    visible = false;
+}
+
+void PerformanceOverlay::moveTo(const utils::Vector2f& origin)
+{
+    rendererPool->setPosition(backgroundId, origin);
+    refreshGraph(origin, boost::none);
+    for (std::size_t lineIndex = 0; lineIndex < textIds.size(); lineIndex++)
+    {
+        rendererPool->setPosition(textIds[lineIndex],
+                                  origin + textOffset +
+                                      utils::Vector2f{0, static_cast<float>(lineIndex) * textLineHeight});
+    }
+    currentOrigin = origin;
+}
+
+void PerformanceOverlay::refreshGraph(const utils::Vector2f& origin,
+                                      boost::optional<std::size_t> resizedSampleIndex)
+{
+    for (std::size_t sampleIndex = 0; sampleIndex < graphBarIds.size(); sampleIndex++)
+    {
+        refreshGraphColumn(sampleIndex, origin, not resizedSampleIndex || sampleIndex == *resizedSampleIndex);
+    }
+}
+
+void PerformanceOverlay::refreshGraphColumn(std::size_t sampleIndex, const utils::Vector2f& origin,
+                                            bool resizeBars)
+{
+    const auto& frameTimings = frameTimingsHistory[sampleIndex];
+    const std::array<utils::DeltaTime, 3> phaseTimes{frameTimings.update, frameTimings.render,
+                                                     frameTimings.present};
+    const auto numberOfSamples = frameTimingsHistory.size();
+    const auto columnIndex = (sampleIndex + numberOfSamples - nextFrameTimingsIndex) % numberOfSamples;
+    const auto graphBottom = origin.y + graphOffset.y;
+    const auto barX = origin.x + graphOffset.x + static_cast<float>(columnIndex) * graphBarSpacing;
+    auto barBottom = graphBottom;
+    for (std::size_t phaseIndex = 0; phaseIndex < phaseTimes.size(); phaseIndex++)
+    {
+        const auto barHeight =
+            std::min(toMilliseconds(phaseTimes[phaseIndex]) / graphMillisecondsRange * graphHeight,
+                     barBottom - (graphBottom - graphHeight));
+        barBottom -= barHeight;
+        if (resizeBars)
+        {
+            rendererPool->setSize(graphBarIds[sampleIndex][phaseIndex], {graphBarWidth, barHeight});
+        }
+        rendererPool->setPosition(graphBarIds[sampleIndex][phaseIndex], {barX, barBottom});
+    }
+}
+
+void PerformanceOverlay::refreshTexts()
+{
+    FrameTimings averageFrameTimings{};
+    utils::DeltaTime maximumFrameTime{0};
+    for (const auto& frameTimings : frameTimingsHistory)
+    {
+        averageFrameTimings.update += frameTimings.update;
+        averageFrameTimings.render += frameTimings.render;
+        averageFrameTimings.present += frameTimings.present;
+        maximumFrameTime = std::max(maximumFrameTime, getFrameTime(frameTimings));
+    }
+    const auto numberOfSamples = static_cast<float>(frameTimingsHistory.size());
+    averageFrameTimings.update /= numberOfSamples;
+    averageFrameTimings.render /= numberOfSamples;
+    averageFrameTimings.present /= numberOfSamples;
+
+    const auto statistics = rendererPool->getStatistics();
+    setTextLine(0, "frame %.1f ms, max %.1f ms", toMilliseconds(getFrameTime(averageFrameTimings)),
+                toMilliseconds(maximumFrameTime));
+    setTextLine(1, "update %.1f render %.1f present %.1f", toMilliseconds(averageFrameTimings.update),
+                toMilliseconds(averageFrameTimings.render), toMilliseconds(averageFrameTimings.present));
+    setTextLine(2, "draw calls %zu batches %zu objects %zu", statistics.drawCalls, statistics.batches,
+                statistics.shapes + statistics.texts + statistics.tileLayers);
+    setTextLine(3, "textures %zu KB components %zu", statistics.textureMemoryInBytes / 1024,
+                components::core::Component::getNumberOfComponents());
+
+    for (std::size_t lineIndex = 0; lineIndex < textIds.size(); lineIndex++)
+    {
+        rendererPool->setText(textIds[lineIndex], textLines[lineIndex]);
+    }
+    timeSinceTextsRefresh = utils::DeltaTime{0};
+}
+
+template <typename... Args>
+void PerformanceOverlay::setTextLine(std::size_t lineIndex, const char* format, Args... args)
+{
+    std::array<char, maximumTextLineLength> buffer;
+    const auto length = std::snprintf(buffer.data(), buffer.size(), format, args...);
+    textLines[lineIndex].assign(buffer.data(), std::min<std::size_t>(std::max(length, 0), buffer.size() - 1));
+}
+
+}
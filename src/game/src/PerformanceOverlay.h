@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <boost/optional.hpp>
+#include <memory>
+#include <vector>
+
+#include "FrameTimings.h"
+#include "InputManager.h"
+#include "InputObserver.h"
+#include "RendererPool.h"
+
+namespace game
+{
+class PerformanceOverlay : public input::InputObserver
+{
+public:
+    PerformanceOverlay(std::shared_ptr<input::InputManager>, std::shared_ptr<graphics::RendererPool>);
+    ~PerformanceOverlay();
+
+    void update(const FrameTimings&);
+    void handleInputStatus(const input::InputStatus&) override;
+    bool isVisible() const;
+
+private:
+    void show();
+    void hide();
+    void moveTo(const utils::Vector2f& origin);
+    void refreshGraph(const utils::Vector2f& origin, boost::optional<std::size_t> resizedSampleIndex);
+    void refreshGraphColumn(std::size_t sampleIndex, const utils::Vector2f& origin, bool resizeBars);
+    void refreshTexts();
+    template <typename... Args>
+    void setTextLine(std::size_t lineIndex, const char* format, Args...);
+
+    std::shared_ptr<input::InputManager> inputManager;
+    std::shared_ptr<graphics::RendererPool> rendererPool;
+    bool visible;
+    std::vector<FrameTimings> frameTimingsHistory;
+    std::size_t nextFrameTimingsIndex;
+    utils::DeltaTime timeSinceTextsRefresh;
+    std::vector<std::string> textLines;
+    boost::optional<utils::Vector2f> currentOrigin;
+    graphics::GraphicsId backgroundId;
+    std::vector<graphics::GraphicsId> textIds;
+    std::vector<std::array<graphics::GraphicsId, 3>> graphBarIds;
+};
+}
@@ -0,0 +1,155 @@
+#include "PerformanceOverlay.h"
+
+#include <algorithm>
+#include <map>
+
+#include "gtest/gtest.h"
+
+#include "GraphicsIdGenerator.h"
+#include "InputManagerMock.h"
+#include "RendererPoolMock.h"
+
+using namespace ::testing;
+using namespace game;
+
+namespace
+{
+const auto numberOfGraphSamples{30u};
+const auto numberOfShapes{1u + numberOfGraphSamples * 3u};
+const auto numberOfTexts{4u};
+const utils::Vector2f cameraViewSize{80, 60};
+const FrameTimings frameTimings{utils::DeltaTime{0.004f}, utils::DeltaTime{0.003f}, utils::DeltaTime{0.009f}};
+}
+
+class PerformanceOverlayTest_Base : public Test
+{
+public:
+    PerformanceOverlayTest_Base()
+    {
+        EXPECT_CALL(*inputManager, registerObserver(_));
+        EXPECT_CALL(*inputManager, removeObserver(_));
+        releasedToggleKeyStatus.setKeyPressed(input::InputKey::F3);
+        releasedToggleKeyStatus.setReleasedKeys();
+        releasedToggleKeyStatus.clearPressedKeys();
+        releasedToggleKeyStatus.setReleasedKeys();
+    }
+
+    input::InputStatus releasedToggleKeyStatus;
+    std::shared_ptr<StrictMock<input::InputManagerMock>> inputManager =
+        std::make_shared<StrictMock<input::InputManagerMock>>();
+    std::shared_ptr<StrictMock<graphics::RendererPoolMock>> rendererPool =
+        std::make_shared<StrictMock<graphics::RendererPoolMock>>();
+    std::shared_ptr<graphics::Camera> camera = std::make_shared<graphics::Camera>(cameraViewSize);
+};
+
+class PerformanceOverlayTest : public PerformanceOverlayTest_Base
+{
+public:
+    void expectShow()
+    {
+        EXPECT_CALL(*rendererPool,
+                    acquire(_, _, An<const graphics::Color&>(), graphics::VisibilityLayer::First))
+            .Times(numberOfShapes)
+            .WillRepeatedly(InvokeWithoutArgs(graphics::GraphicsIdGenerator::generateId));
+        EXPECT_CALL(*rendererPool, acquireText(_, _, _, _, graphics::VisibilityLayer::First, _))
+            .Times(numberOfTexts);
+    }
+
+    void expectRefresh()
+    {
+        EXPECT_CALL(*rendererPool, getCamera()).WillOnce(Return(camera));
+        EXPECT_CALL(*rendererPool, getStatistics()).WillOnce(Return(graphics::RendererPoolStatistics{}));
+        EXPECT_CALL(*rendererPool, setPosition(_, _)).Times(numberOfShapes + numberOfTexts);
+        EXPECT_CALL(*rendererPool, setSize(_, _)).Times(numberOfShapes - 1);
+        EXPECT_CALL(*rendererPool, setText(_, _)).Times(numberOfTexts);
+    }
+
+    PerformanceOverlay performanceOverlay{inputManager, rendererPool};
+};
+
+TEST_F(PerformanceOverlayTest, hiddenOverlay_shouldNotTouchRendererPool)
+{
+    performanceOverlay.update(frameTimings);
+
+    ASSERT_FALSE(performanceOverlay.isVisible());
+}
+
+TEST_F(PerformanceOverlayTest, releasedToggleKey_shouldShowOverlay)
+{
+    expectShow();
+
+    performanceOverlay.handleInputStatus(releasedToggleKeyStatus);
+
+    ASSERT_TRUE(performanceOverlay.isVisible());
+    EXPECT_CALL(*rendererPool, release(_)).Times(numberOfShapes + numberOfTexts);
+}
+
+TEST_F(PerformanceOverlayTest, givenVisibleOverlay_firstUpdateShouldRefreshAllGraphics)
+{
+    expectShow();
+    performanceOverlay.handleInputStatus(releasedToggleKeyStatus);
+    expectRefresh();
+
+    performanceOverlay.update(frameTimings);
+
+    EXPECT_CALL(*rendererPool, release(_)).Times(numberOfShapes + numberOfTexts);
+}
+
+TEST_F(PerformanceOverlayTest, givenUnchangedCamera_shouldShiftGraphAndResizeOnlyNewestColumn)
+{
+    expectShow();
+    performanceOverlay.handleInputStatus(releasedToggleKeyStatus);
+    expectRefresh();
+    performanceOverlay.update(frameTimings);
+    EXPECT_CALL(*rendererPool, getCamera()).WillOnce(Return(camera));
+    EXPECT_CALL(*rendererPool, setSize(_, _)).Times(3);
+    EXPECT_CALL(*rendererPool, setPosition(_, _)).Times(numberOfShapes - 1);
+
+    performanceOverlay.update(frameTimings);
+
+    EXPECT_CALL(*rendererPool, release(_)).Times(numberOfShapes + numberOfTexts);
+}
+
+TEST_F(PerformanceOverlayTest, newestSample_shouldBeDrawnInRightmostGraphColumn)
+{
+    expectShow();
+    performanceOverlay.handleInputStatus(releasedToggleKeyStatus);
+    expectRefresh();
+    performanceOverlay.update(frameTimings);
+    std::vector<graphics::GraphicsId> resizedBarIds;
+    std::map<graphics::GraphicsId, float> barPositionsX;
+    EXPECT_CALL(*rendererPool, getCamera()).WillOnce(Return(camera));
+    EXPECT_CALL(*rendererPool, setSize(_, _))
+        .Times(3)
+        .WillRepeatedly(
+            Invoke([&](const graphics::GraphicsId& id, const auto&) { resizedBarIds.push_back(id); }));
+    EXPECT_CALL(*rendererPool, setPosition(_, _))
+        .Times(numberOfShapes - 1)
+        .WillRepeatedly(Invoke([&](const graphics::GraphicsId& id, const utils::Vector2f& position) {
+            barPositionsX[id] = position.x;
+        }));
+
+    performanceOverlay.update(frameTimings);
+
+    const auto rightmostBarX =
+        std::max_element(barPositionsX.begin(), barPositionsX.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; })
+            ->second;
+    ASSERT_EQ(resizedBarIds.size(), 3u);
+    for (const auto& resizedBarId : resizedBarIds)
+    {
+        ASSERT_FLOAT_EQ(barPositionsX.at(resizedBarId), rightmostBarX);
+    }
+    EXPECT_CALL(*rendererPool, release(_)).Times(numberOfShapes + numberOfTexts);
+}
+
+TEST_F(PerformanceOverlayTest, releasedToggleKeyTwice_shouldHideOverlayAndReleaseGraphics)
+{
+    expectShow();
+    performanceOverlay.handleInputStatus(releasedToggleKeyStatus);
+    EXPECT_CALL(*rendererPool, release(_)).Times(numberOfShapes + numberOfTexts);
+
+    performanceOverlay.handleInputStatus(releasedToggleKeyStatus);
+
+    ASSERT_FALSE(performanceOverlay.isVisible());
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Vector.h"
+
+namespace game
+{
+struct RaycastHit
+{
+    utils::Vector2i tilePosition;
+    utils::Vector2f point;
+    utils::Vector2f normal;
+    float distance;
+};
+}
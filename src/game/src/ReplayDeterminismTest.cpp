@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+
+#include "DefaultInputObservationHandler.h"
+#include "GraphicsFactory.h"
+#include "MenuState.h"
+#include "ReplayInputManager.h"
+#include "WindowFactory.h"
+
+using namespace ::testing;
+using namespace game;
+
+namespace
+{
+const utils::Vector2u windowSize{800, 600};
+const utils::Vector2u mapSize{80, 60};
+const utils::DeltaTime frameTime{1.f / 60.f};
+const utils::Vector2f playButtonPosition{51, 8};
+const auto numberOfFramesInMenu{30};
+const auto numberOfFramesBeforeIgnoredPause{10};
+const auto numberOfFramesBeforePause{50};
+const auto numberOfFramesInPause{10};
+
+input::InputRecording createPlayAndPauseRecording()
+{
+    input::InputRecording recording;
+    const auto addFrames = [&](int numberOfFrames, input::InputKeysMask pressedKeys) {
+        for (auto frame = 0; frame < numberOfFrames; frame++)
+        {
+            recording.snapshots.push_back({pressedKeys, playButtonPosition, "", frameTime.count()});
+        }
+    };
+
+    addFrames(numberOfFramesInMenu, 0);
+    addFrames(1, input::toKeyMask(input::InputKey::MouseLeft));
+    addFrames(numberOfFramesBeforeIgnoredPause, input::toKeyMask(input::InputKey::Right));
+    addFrames(1, input::toKeyMask(input::InputKey::Escape));
+    addFrames(numberOfFramesBeforePause, input::toKeyMask(input::InputKey::Right));
+    addFrames(1, input::toKeyMask(input::InputKey::Escape));
+    addFrames(numberOfFramesInPause, 0);
+    return recording;
+}
+
+std::vector<std::string> replayStateNames(input::InputRecording recording)
+{
+    const std::shared_ptr<window::Window> window =
+        window::WindowFactory::createHeadlessWindowFactory()->createWindow(windowSize, "replay");
+    const std::shared_ptr<graphics::RendererPool> rendererPool =
+        graphics::GraphicsFactory::createHeadlessGraphicsFactory()->createRendererPool(window, windowSize,
+                                                                                       mapSize);
+    const auto inputManager = std::make_shared<input::ReplayInputManager>(
+        std::make_unique<input::DefaultInputObservationHandler>(), std::move(recording));
+    std::stack<std::unique_ptr<State>> states;
+    states.push(std::make_unique<MenuState>(window, inputManager, rendererPool, states));
+
+    std::vector<std::string> stateNames;
+    while (not inputManager->isFinished())
+    {
+        inputManager->readInput();
+        states.top()->update(frameTime);
+        states.top()->lateUpdate(frameTime);
+        states.top()->render();
+        stateNames.push_back(states.top()->getName());
+    }
+    return stateNames;
+}
+}
+
+TEST(ReplayDeterminismTest, replayingSameRecordingTwice_shouldPassThroughSameStates)
+{
+    const auto firstReplayStateNames = replayStateNames(createPlayAndPauseRecording());
+
+    const auto secondReplayStateNames = replayStateNames(createPlayAndPauseRecording());
+
+    ASSERT_EQ(firstReplayStateNames, secondReplayStateNames);
+}
+
+TEST(ReplayDeterminismTest, stateCooldowns_shouldElapseWithReplayedFrameTime)
+{
+    const auto stateNames = replayStateNames(createPlayAndPauseRecording());
+
+    const auto playClickFrame = numberOfFramesInMenu + 1;
+    const auto firstPauseFrame = playClickFrame + numberOfFramesBeforeIgnoredPause;
+    const auto secondPauseFrame = firstPauseFrame + numberOfFramesBeforePause + 1;
+    ASSERT_EQ(stateNames[playClickFrame - 1], "Menu state");
+    ASSERT_EQ(stateNames[playClickFrame], "Game state");
+    ASSERT_EQ(stateNames[firstPauseFrame], "Game state");
+    ASSERT_EQ(stateNames[secondPauseFrame - 1], "Game state");
+    ASSERT_EQ(stateNames[secondPauseFrame], "Pause state");
+    ASSERT_EQ(stateNames.back(), "Pause state");
+}
@@ -36,6 +36,7 @@ SaveMapState::SaveMapState(const std::shared_ptr<window::Window>& windowInit,
       timeAfterNextLetterCanBeDeleted{0.08f}
 {
     inputManager->registerObserver(this);
+    mapNameBuffer.reserve(mapNameMaximumSize);
 
     createBackground();
     createMapPropertiesTitle();
@@ -66,12 +67,16 @@ void SaveMapState::initialize()
     mapNameInputTextField->loadDependentComponents();
     mapNameInputTextField->start();
 
-    possibleLeaveFromStateTimer.start();
-    inputMapNameDeleteCharactersTimer.start();
+    possibleLeaveFromStateTimer.restart();
+    inputMapNameDeleteCharactersTimer.restart();
 }
 
 void SaveMapState::update(const utils::DeltaTime& deltaTime)
 {
+    freezeClickableButtonsTimer.update(deltaTime);
+    possibleLeaveFromStateTimer.update(deltaTime);
+    inputMapNameDeleteCharactersTimer.update(deltaTime);
+
     if (buttonsActionsFrozen &&
         freezeClickableButtonsTimer.getElapsedSeconds() > timeAfterButtonsCanBeClicked)
     {
@@ -101,11 +106,12 @@ void SaveMapState::update(const utils::DeltaTime& deltaTime)
 
     if (mapNameFieldClicked)
     {
-        for (const auto& alphanumericButtonKey : input::alphaNumericalButtons)
+        if (inputStatus->anyReleased(input::alphaNumericalButtonsMask))
         {
-            if (inputStatus->isKeyReleased(alphanumericButtonKey))
+            for (const auto& alphanumericButtonKey : input::alphaNumericalButtons)
             {
-                if (mapNameBuffer.size() < mapNameMaximumSize)
+                if (inputStatus->isKeyReleased(alphanumericButtonKey) &&
+                    mapNameBuffer.size() < mapNameMaximumSize)
                 {
                     mapNameBuffer += utils::getLowerCases(toString(alphanumericButtonKey));
                     mapNameInputTextField->getComponent<components::core::TextComponent>()->setText(
@@ -120,7 +126,7 @@ void SaveMapState::update(const utils::DeltaTime& deltaTime)
             {
                 if (not mapNameBuffer.empty())
                 {
-                    utils::cutOffString(mapNameBuffer, mapNameBuffer.size() - 1, mapNameBuffer.size() - 1);
+                    mapNameBuffer.pop_back();
                     mapNameInputTextField->getComponent<components::core::TextComponent>()->setText(
                         mapNameBuffer);
                 }
@@ -1,8 +1,8 @@
 #pragma once
 
 #include "InputObserver.h"
+#include "SimulationTimer.h"
 #include "State.h"
-#include "Timer.h"
 #include "core/ComponentOwner.h"
 
 namespace game
@@ -41,7 +41,7 @@ private:
                  graphics::Color);
 
     const input::InputStatus* inputStatus;
-    utils::Timer possibleLeaveFromStateTimer;
+    utils::SimulationTimer possibleLeaveFromStateTimer;
     const float timeAfterLeaveStateIsPossible;
     bool shouldBackToEditorMenu;
     std::vector<std::unique_ptr<components::core::ComponentOwner>> texts;
@@ -49,12 +49,12 @@ private:
     std::vector<std::unique_ptr<components::core::ComponentOwner>> buttons;
     std::unique_ptr<components::core::ComponentOwner> mapNameInputTextField;
     bool buttonsActionsFrozen = true;
-    utils::Timer freezeClickableButtonsTimer;
+    utils::SimulationTimer freezeClickableButtonsTimer;
     const float timeAfterButtonsCanBeClicked;
     std::string mapNameBuffer;
     bool mapNameFieldClicked;
     unsigned int mapNameMaximumSize;
-    utils::Timer inputMapNameDeleteCharactersTimer;
+    utils::SimulationTimer inputMapNameDeleteCharactersTimer;
     const float timeAfterNextLetterCanBeDeleted;
 };
 }
\ No newline at end of file
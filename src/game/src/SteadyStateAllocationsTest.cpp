@@ -0,0 +1,199 @@
+#include "gtest/gtest.h"
+
+#include "AllocationTracker.h"
+#include "DefaultInputObservationHandler.h"
+#include "EditorState.h"
+#include "FrameProfiler.h"
+#include "Game.h"
+#include "GameState.h"
+#include "GraphicsFactory.h"
+#include "MenuState.h"
+#include "ReplayInputManager.h"
+#include "SaveMapState.h"
+#include "WindowFactory.h"
+
+using namespace ::testing;
+using namespace game;
+
+namespace
+{
+const auto numberOfWarmUpFrames{240};
+const auto numberOfMeasuredFrames{600};
+const utils::Vector2u windowSize{800, 600};
+const utils::Vector2u mapSize{80, 60};
+const utils::DeltaTime frameTime{1.f / 60.f};
+const utils::Vector2f mapNameInputFieldPosition{37, 22};
+const auto mapNameInputFieldClickFrame{30};
+const auto mapNameTypingCycleLength{60};
+const std::vector<input::InputKey> typedMapNameKeys{input::InputKey::A, input::InputKey::B,
+                                                    input::InputKey::C};
+
+input::InputRecording createMovementRecording()
+{
+    const std::vector<input::InputKeysMask> movementCycle{
+        input::toKeyMask(input::InputKey::Right),
+        input::toKeysMask({input::InputKey::Right, input::InputKey::Space}), 0,
+        input::toKeyMask(input::InputKey::Left)};
+
+    input::InputRecording recording;
+    for (auto frame = 0; frame < numberOfWarmUpFrames + numberOfMeasuredFrames; frame++)
+    {
+        const auto pressedKeys = movementCycle[(frame / 30) % movementCycle.size()];
+        recording.snapshots.push_back({pressedKeys, {0, 0}, "", frameTime.count()});
+    }
+    return recording;
+}
+
+input::InputRecording createMovementRecordingWithPerformanceOverlay()
+{
+    auto recording = createMovementRecording();
+    recording.snapshots.insert(recording.snapshots.begin(),
+                               {{input::toKeyMask(input::InputKey::F3), {0, 0}, "", frameTime.count()},
+                                {0, {0, 0}, "", frameTime.count()}});
+    return recording;
+}
+
+input::InputRecording createMouseMovementRecording()
+{
+    input::InputRecording recording;
+    for (auto frame = 0; frame < numberOfWarmUpFrames + numberOfMeasuredFrames; frame++)
+    {
+        const auto framePositionInCycle = static_cast<float>(frame % numberOfWarmUpFrames);
+        const utils::Vector2f mousePosition{framePositionInCycle / 3.f, framePositionInCycle / 4.f};
+        recording.snapshots.push_back({0, mousePosition, "", frameTime.count()});
+    }
+    return recording;
+}
+
+input::InputRecording createMapNameTypingRecording()
+{
+    input::InputRecording recording;
+    for (auto frame = 0; frame < numberOfWarmUpFrames + numberOfMeasuredFrames; frame++)
+    {
+        input::InputKeysMask pressedKeys{0};
+        const auto framePositionInCycle = frame % mapNameTypingCycleLength;
+        const auto typedKeyIndex = static_cast<std::size_t>(framePositionInCycle / 12);
+        if (frame == mapNameInputFieldClickFrame)
+        {
+            pressedKeys = input::toKeyMask(input::InputKey::MouseLeft);
+        }
+        else if (frame > mapNameInputFieldClickFrame && typedKeyIndex < typedMapNameKeys.size())
+        {
+            const auto typedKeyPressed = framePositionInCycle % 12 < 6;
+            pressedKeys = typedKeyPressed ? input::toKeyMask(typedMapNameKeys[typedKeyIndex]) : 0;
+        }
+        else if (frame > mapNameInputFieldClickFrame)
+        {
+            pressedKeys = input::toKeyMask(input::InputKey::Backspace);
+        }
+        recording.snapshots.push_back({pressedKeys, mapNameInputFieldPosition, "", frameTime.count()});
+    }
+    return recording;
+}
+
+bool allocationHooksCountAllocations()
+{
+    static void* volatile probe;
+    const auto numberOfAllocationsBeforeProbe = utils::AllocationTracker::getTotalNumberOfAllocations();
+    probe = ::operator new(sizeof(int));
+    ::operator delete(probe);
+    return utils::AllocationTracker::getTotalNumberOfAllocations() > numberOfAllocationsBeforeProbe;
+}
+}
+
+class SteadyStateAllocationsTest : public Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_TRUE(allocationHooksCountAllocations());
+        utils::FrameProfiler::setEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        utils::FrameProfiler::setEnabled(false);
+        utils::FrameProfiler::clear();
+    }
+
+    std::uint64_t countMeasuredFramesAllocations(const StateCreator& createInitialState,
+                                                 input::InputRecording recording)
+    {
+        const std::shared_ptr<window::Window> window =
+            window::WindowFactory::createHeadlessWindowFactory()->createWindow(windowSize, "steadyState");
+        const std::shared_ptr<graphics::RendererPool> rendererPool =
+            graphics::GraphicsFactory::createHeadlessGraphicsFactory()->createRendererPool(window, windowSize,
+                                                                                           mapSize);
+        Game game{window, rendererPool,
+                  std::make_shared<input::ReplayInputManager>(
+                      std::make_unique<input::DefaultInputObservationHandler>(), std::move(recording)),
+                  createInitialState, false};
+
+        for (auto frame = 0; frame < numberOfWarmUpFrames; frame++)
+        {
+            game.runFrame();
+        }
+
+        const auto numberOfAllocationsAfterWarmUp = utils::AllocationTracker::getTotalNumberOfAllocations();
+        for (auto frame = 0; frame < numberOfMeasuredFrames; frame++)
+        {
+            game.runFrame();
+        }
+        return utils::AllocationTracker::getTotalNumberOfAllocations() - numberOfAllocationsAfterWarmUp;
+    }
+};
+
+TEST_F(SteadyStateAllocationsTest, menuState_shouldNotAllocateAfterWarmUp)
+{
+    const auto numberOfAllocations = countMeasuredFramesAllocations(
+        [](const auto& window, const auto& inputManager, const auto& rendererPool, auto& states) {
+            return std::make_unique<MenuState>(window, inputManager, rendererPool, states);
+        },
+        createMouseMovementRecording());
+
+    ASSERT_EQ(numberOfAllocations, 0u);
+}
+
+TEST_F(SteadyStateAllocationsTest, gameState_shouldNotAllocateAfterWarmUp)
+{
+    const auto numberOfAllocations = countMeasuredFramesAllocations(
+        [](const auto& window, const auto& inputManager, const auto& rendererPool, auto& states) {
+            return std::make_unique<GameState>(window, inputManager, rendererPool, states);
+        },
+        createMovementRecording());
+
+    ASSERT_EQ(numberOfAllocations, 0u);
+}
+
+TEST_F(SteadyStateAllocationsTest, gameStateWithPerformanceOverlay_shouldNotAllocateAfterWarmUp)
+{
+    const auto numberOfAllocations = countMeasuredFramesAllocations(
+        [](const auto& window, const auto& inputManager, const auto& rendererPool, auto& states) {
+            return std::make_unique<GameState>(window, inputManager, rendererPool, states);
+        },
+        createMovementRecordingWithPerformanceOverlay());
+
+    ASSERT_EQ(numberOfAllocations, 0u);
+}
+
+TEST_F(SteadyStateAllocationsTest, editorState_shouldNotAllocateAfterWarmUp)
+{
+    const auto numberOfAllocations = countMeasuredFramesAllocations(
+        [](const auto& window, const auto& inputManager, const auto& rendererPool, auto& states) {
+            return std::make_unique<EditorState>(window, inputManager, rendererPool, states);
+        },
+        createMouseMovementRecording());
+
+    ASSERT_EQ(numberOfAllocations, 0u);
+}
+
+TEST_F(SteadyStateAllocationsTest, saveMapStateWhileTypingAndDeletingMapName_shouldNotAllocateAfterWarmUp)
+{
+    const auto numberOfAllocations = countMeasuredFramesAllocations(
+        [](const auto& window, const auto& inputManager, const auto& rendererPool, auto& states) {
+            return std::make_unique<SaveMapState>(window, inputManager, rendererPool, states);
+        },
+        createMapNameTypingRecording());
+
+    ASSERT_EQ(numberOfAllocations, 0u);
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Vector.h"
+
+namespace game
+{
+struct SweepResult
+{
+    utils::Vector2f displacement;
+    bool collidedHorizontally;
+    bool collidedVertically;
+};
+}
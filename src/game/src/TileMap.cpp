@@ -1,25 +1,424 @@
 #include "TileMap.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
 namespace game
 {
+namespace
+{
+const auto emptyTile{0};
+
+int toCell(float coordinate, float cellLength)
+{
+    return static_cast<int>(std::floor(coordinate / cellLength));
+}
+
+int toLastCoveredCell(float endCoordinate, float cellLength)
+{
+    return static_cast<int>(std::ceil(endCoordinate / cellLength)) - 1;
+}
+
+bool isLeavingMap(const utils::Vector2i& cell, int stepX, int stepY, const utils::Vector2i& mapSize)
+{
+    return (cell.x < 0 && stepX <= 0) || (cell.x >= mapSize.x && stepX >= 0) || (cell.y < 0 && stepY <= 0) ||
+           (cell.y >= mapSize.y && stepY >= 0);
+}
+}
 
 TileMap::TileMap(utils::Vector2i mapSizeInit, utils::Vector2f tileSizeInit)
-    : mapSize(mapSizeInit), tileSize(tileSizeInit)
+    : mapSize(mapSizeInit),
+      tileSize(tileSizeInit),
+      tiles(static_cast<std::size_t>(mapSize.x) * static_cast<std::size_t>(mapSize.y), 0)
 {
-    // TODO: calculate map size
-    for (int x = 0; x < mapSize.y; x++)
-    {
-        nodes.emplace_back(mapSize.x, 0);
-    }
 }
 
 void TileMap::saveToFile() {}
 void TileMap::setTile(utils::Vector2i position, int value)
 {
-    nodes[position.y][position.x] = value;
+    tiles[getTileIndex(position)] = value;
+}
+int TileMap::getTile(utils::Vector2i position) const
+{
+    return tiles[getTileIndex(position)];
+}
+
+const std::vector<int>& TileMap::getTiles() const
+{
+    return tiles;
+}
+
+bool TileMap::isInside(utils::Vector2i position) const
+{
+    return position.x >= 0 && position.y >= 0 && position.x < mapSize.x && position.y < mapSize.y;
+}
+
+std::size_t TileMap::getTileIndex(utils::Vector2i position) const
+{
+    return static_cast<std::size_t>(position.y) * static_cast<std::size_t>(mapSize.x) +
+           static_cast<std::size_t>(position.x);
+}
+
+utils::Vector2i TileMap::getTilePosition(std::size_t tileIndex) const
+{
+    const auto width = static_cast<std::size_t>(mapSize.x);
+    return {static_cast<int>(tileIndex % width), static_cast<int>(tileIndex / width)};
+}
+
+utils::Vector2i TileMap::getSize() const
+{
+    return mapSize;
+}
+
+utils::Vector2f TileMap::getTileSize() const
+{
+    return tileSize;
 }
-int TileMap::getTile(utils::Vector2i position)
+
+TileMapEdit TileMap::fillRectangle(utils::Vector2i firstCorner, utils::Vector2i secondCorner, int value)
+{
+    const auto left = std::max(std::min(firstCorner.x, secondCorner.x), 0);
+    const auto right = std::min(std::max(firstCorner.x, secondCorner.x), mapSize.x - 1);
+    const auto top = std::max(std::min(firstCorner.y, secondCorner.y), 0);
+    const auto bottom = std::min(std::max(firstCorner.y, secondCorner.y), mapSize.y - 1);
+
+    TileMapEdit edit;
+    if (left > right || top > bottom)
+    {
+        return edit;
+    }
+
+    for (auto y = top; y <= bottom; y++)
+    {
+        const auto rowStart = getTileIndex({left, y});
+        for (auto x = 0; x <= right - left; x++)
+        {
+            changeTile(edit, rowStart + static_cast<std::size_t>(x), value);
+        }
+    }
+    return edit;
+}
+
+TileMapEdit TileMap::drawLine(utils::Vector2i start, utils::Vector2i end, int value)
+{
+    const auto deltaX = std::abs(end.x - start.x);
+    const auto deltaY = -std::abs(end.y - start.y);
+    const auto stepX = start.x < end.x ? 1 : -1;
+    const auto stepY = start.y < end.y ? 1 : -1;
+    auto error = deltaX + deltaY;
+    auto position = start;
+
+    TileMapEdit edit;
+    while (true)
+    {
+        if (isInside(position))
+        {
+            changeTile(edit, getTileIndex(position), value);
+        }
+
+        if (position == end)
+        {
+            break;
+        }
+
+        const auto doubledError = 2 * error;
+        if (doubledError >= deltaY)
+        {
+            error += deltaY;
+            position.x += stepX;
+        }
+        if (doubledError <= deltaX)
+        {
+            error += deltaX;
+            position.y += stepY;
+        }
+    }
+    return edit;
+}
+
+TileMapEdit TileMap::floodFill(utils::Vector2i start, int value)
 {
-    return nodes[position.y][position.x];
+    TileMapEdit edit;
+    if (not isInside(start))
+    {
+        return edit;
+    }
+
+    const auto targetValue = getTile(start);
+    if (targetValue == value)
+    {
+        return edit;
+    }
+
+    const auto width = static_cast<std::size_t>(mapSize.x);
+    std::vector<std::size_t> seeds{getTileIndex(start)};
+    while (not seeds.empty())
+    {
+        const auto seed = seeds.back();
+        seeds.pop_back();
+
+        if (tiles[seed] != targetValue)
+        {
+            continue;
+        }
+
+        const auto rowStart = seed - seed % width;
+        const auto rowEnd = rowStart + width;
+
+        auto spanStart = seed;
+        while (spanStart > rowStart && tiles[spanStart - 1] == targetValue)
+        {
+            spanStart--;
+        }
+
+        auto spanEnd = seed + 1;
+        while (spanEnd < rowEnd && tiles[spanEnd] == targetValue)
+        {
+            spanEnd++;
+        }
+
+        edit.push_back(TileRun{spanStart, spanEnd - spanStart, targetValue, value});
+        std::fill(tiles.begin() + static_cast<std::ptrdiff_t>(spanStart),
+                  tiles.begin() + static_cast<std::ptrdiff_t>(spanEnd), value);
+
+        const auto pushNeighbourRowSeeds = [&](std::size_t neighbourSpanStart) {
+            auto previousTileIsTarget = false;
+            for (auto tileIndex = neighbourSpanStart; tileIndex < neighbourSpanStart + (spanEnd - spanStart);
+                 tileIndex++)
+            {
+                const auto tileIsTarget = tiles[tileIndex] == targetValue;
+                if (tileIsTarget && not previousTileIsTarget)
+                {
+                    seeds.push_back(tileIndex);
+                }
+                previousTileIsTarget = tileIsTarget;
+            }
+        };
+
+        if (rowStart >= width)
+        {
+            pushNeighbourRowSeeds(spanStart - width);
+        }
+        if (rowEnd < tiles.size())
+        {
+            pushNeighbourRowSeeds(spanStart + width);
+        }
+    }
+    return edit;
 }
+
+bool TileMap::isSolid(utils::Vector2i position) const
+{
+    return isInside(position) && tiles[getTileIndex(position)] != emptyTile;
+}
+
+bool TileMap::overlapsSolidTile(const utils::FloatRect& area) const
+{
+    const auto firstColumn = std::max(toCell(area.left, tileSize.x), 0);
+    const auto lastColumn = std::min(toLastCoveredCell(area.left + area.width, tileSize.x), mapSize.x - 1);
+    const auto firstRow = std::max(toCell(area.top, tileSize.y), 0);
+    const auto lastRow = std::min(toLastCoveredCell(area.top + area.height, tileSize.y), mapSize.y - 1);
+
+    for (auto row = firstRow; row <= lastRow; row++)
+    {
+        if (isAnySolidInRow(row, firstColumn, lastColumn))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+SweepResult TileMap::sweep(const utils::FloatRect& box, const utils::Vector2f& displacement) const
+{
+    SweepResult result{{0, 0}, false, false};
+
+    result.displacement.x = sweepHorizontally(box, displacement.x);
+    result.collidedHorizontally = result.displacement.x != displacement.x;
+
+    const utils::FloatRect horizontallyMovedBox{box.left + result.displacement.x, box.top, box.width,
+                                                box.height};
+    result.displacement.y = sweepVertically(horizontallyMovedBox, displacement.y);
+    result.collidedVertically = result.displacement.y != displacement.y;
+
+    return result;
+}
+
+boost::optional<RaycastHit> TileMap::raycast(const utils::Vector2f& origin, const utils::Vector2f& direction,
+                                             float maxDistance) const
+{
+    const auto directionLength = std::hypot(direction.x, direction.y);
+    if (directionLength == 0)
+    {
+        return boost::none;
+    }
+
+    const utils::Vector2f unitDirection{direction.x / directionLength, direction.y / directionLength};
+    utils::Vector2i cell{toCell(origin.x, tileSize.x), toCell(origin.y, tileSize.y)};
+
+    if (isSolid(cell))
+    {
+        return RaycastHit{cell, origin, {0, 0}, 0};
+    }
+
+    const auto stepX = unitDirection.x > 0 ? 1 : (unitDirection.x < 0 ? -1 : 0);
+    const auto stepY = unitDirection.y > 0 ? 1 : (unitDirection.y < 0 ? -1 : 0);
+    const auto infinity = std::numeric_limits<float>::infinity();
+
+    const auto distanceToFirstBoundary = [](float position, float axisDirection, int axisCell, float cellLength) {
+        if (axisDirection > 0)
+        {
+            return (static_cast<float>(axisCell + 1) * cellLength - position) / axisDirection;
+        }
+        return (static_cast<float>(axisCell) * cellLength - position) / axisDirection;
+    };
+
+    auto nextBoundaryX =
+        stepX != 0 ? distanceToFirstBoundary(origin.x, unitDirection.x, cell.x, tileSize.x) : infinity;
+    auto nextBoundaryY =
+        stepY != 0 ? distanceToFirstBoundary(origin.y, unitDirection.y, cell.y, tileSize.y) : infinity;
+    const auto boundaryDistanceX = stepX != 0 ? tileSize.x / std::abs(unitDirection.x) : infinity;
+    const auto boundaryDistanceY = stepY != 0 ? tileSize.y / std::abs(unitDirection.y) : infinity;
+
+    while (true)
+    {
+        float distance;
+        utils::Vector2f normal;
+        if (nextBoundaryX < nextBoundaryY)
+        {
+            distance = nextBoundaryX;
+            cell.x += stepX;
+            nextBoundaryX += boundaryDistanceX;
+            normal = {static_cast<float>(-stepX), 0};
+        }
+        else
+        {
+            distance = nextBoundaryY;
+            cell.y += stepY;
+            nextBoundaryY += boundaryDistanceY;
+            normal = {0, static_cast<float>(-stepY)};
+        }
+
+        if (distance > maxDistance || isLeavingMap(cell, stepX, stepY, mapSize))
+        {
+            return boost::none;
+        }
+
+        if (isSolid(cell))
+        {
+            return RaycastHit{cell, origin + unitDirection * distance, normal, distance};
+        }
+    }
+}
+
+void TileMap::changeTile(TileMapEdit& edit, std::size_t tileIndex, int value)
+{
+    appendTileChange(edit, tileIndex, tiles[tileIndex], value);
+    tiles[tileIndex] = value;
+}
+
+bool TileMap::isAnySolidInColumn(int column, int firstRow, int lastRow) const
+{
+    if (column < 0 || column >= mapSize.x)
+    {
+        return false;
+    }
+
+    for (auto row = std::max(firstRow, 0); row <= std::min(lastRow, mapSize.y - 1); row++)
+    {
+        if (tiles[getTileIndex({column, row})] != emptyTile)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TileMap::isAnySolidInRow(int row, int firstColumn, int lastColumn) const
+{
+    if (row < 0 || row >= mapSize.y)
+    {
+        return false;
+    }
+
+    for (auto column = std::max(firstColumn, 0); column <= std::min(lastColumn, mapSize.x - 1); column++)
+    {
+        if (tiles[getTileIndex({column, row})] != emptyTile)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+float TileMap::sweepHorizontally(const utils::FloatRect& box, float displacement) const
+{
+    const auto firstRow = toCell(box.top, tileSize.y);
+    const auto lastRow = toLastCoveredCell(box.top + box.height, tileSize.y);
+
+    if (displacement > 0)
+    {
+        const auto edge = box.left + box.width;
+        const auto firstColumn = std::max(toLastCoveredCell(edge, tileSize.x) + 1, 0);
+        const auto lastColumn = std::min(toLastCoveredCell(edge + displacement, tileSize.x), mapSize.x - 1);
+        for (auto column = firstColumn; column <= lastColumn; column++)
+        {
+            if (isAnySolidInColumn(column, firstRow, lastRow))
+            {
+                return static_cast<float>(column) * tileSize.x - edge;
+            }
+        }
+    }
+    else if (displacement < 0)
+    {
+        const auto edge = box.left;
+        const auto firstColumn = std::min(toCell(edge, tileSize.x) - 1, mapSize.x - 1);
+        const auto lastColumn = std::max(toCell(edge + displacement, tileSize.x), 0);
+        for (auto column = firstColumn; column >= lastColumn; column--)
+        {
+            if (isAnySolidInColumn(column, firstRow, lastRow))
+            {
+                return static_cast<float>(column + 1) * tileSize.x - edge;
+            }
+        }
+    }
+    return displacement;
+}
+
+float TileMap::sweepVertically(const utils::FloatRect& box, float displacement) const
+{
+    const auto firstColumn = toCell(box.left, tileSize.x);
+    const auto lastColumn = toLastCoveredCell(box.left + box.width, tileSize.x);
+
+    if (displacement > 0)
+    {
+        const auto edge = box.top + box.height;
+        const auto firstRow = std::max(toLastCoveredCell(edge, tileSize.y) + 1, 0);
+        const auto lastRow = std::min(toLastCoveredCell(edge + displacement, tileSize.y), mapSize.y - 1);
+        for (auto row = firstRow; row <= lastRow; row++)
+        {
+            if (isAnySolidInRow(row, firstColumn, lastColumn))
+            {
+                return static_cast<float>(row) * tileSize.y - edge;
+            }
+        }
+    }
+    else if (displacement < 0)
+    {
+        const auto edge = box.top;
+        const auto firstRow = std::min(toCell(edge, tileSize.y) - 1, mapSize.y - 1);
+        const auto lastRow = std::max(toCell(edge + displacement, tileSize.y), 0);
+        for (auto row = firstRow; row >= lastRow; row--)
+        {
+            if (isAnySolidInRow(row, firstColumn, lastColumn))
+            {
+                return static_cast<float>(row + 1) * tileSize.y - edge;
+            }
+        }
+    }
+    return displacement;
+}
+
 }
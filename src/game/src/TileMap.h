@@ -1,8 +1,15 @@
 #pragma once
 
 #include <Vector.h>
+#include <boost/optional.hpp>
+#include <cstddef>
 #include <vector>
 
+#include "Rect.h"
+#include "RaycastHit.h"
+#include "SweepResult.h"
+#include "TileMapEdit.h"
+
 namespace game
 {
 class TileMap final
@@ -11,11 +18,31 @@ public:
     TileMap(utils::Vector2i mapSize, utils::Vector2f tileSize);
     void saveToFile();
     void setTile(utils::Vector2i position, int value);
-    int getTile(utils::Vector2i position);
+    int getTile(utils::Vector2i position) const;
+    const std::vector<int>& getTiles() const;
+    bool isInside(utils::Vector2i position) const;
+    std::size_t getTileIndex(utils::Vector2i position) const;
+    utils::Vector2i getTilePosition(std::size_t tileIndex) const;
+    utils::Vector2i getSize() const;
+    utils::Vector2f getTileSize() const;
+    TileMapEdit fillRectangle(utils::Vector2i firstCorner, utils::Vector2i secondCorner, int value);
+    TileMapEdit drawLine(utils::Vector2i start, utils::Vector2i end, int value);
+    TileMapEdit floodFill(utils::Vector2i start, int value);
+    bool isSolid(utils::Vector2i position) const;
+    bool overlapsSolidTile(const utils::FloatRect& area) const;
+    SweepResult sweep(const utils::FloatRect& box, const utils::Vector2f& displacement) const;
+    boost::optional<RaycastHit> raycast(const utils::Vector2f& origin, const utils::Vector2f& direction,
+                                        float maxDistance) const;
 
 private:
+    void changeTile(TileMapEdit&, std::size_t tileIndex, int value);
+    bool isAnySolidInColumn(int column, int firstRow, int lastRow) const;
+    bool isAnySolidInRow(int row, int firstColumn, int lastColumn) const;
+    float sweepHorizontally(const utils::FloatRect& box, float displacement) const;
+    float sweepVertically(const utils::FloatRect& box, float displacement) const;
+
     utils::Vector2i mapSize;
     utils::Vector2f tileSize;
-    std::vector<std::vector<int>> nodes;
+    std::vector<int> tiles;
 };
-}
\ No newline at end of file
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "TileRun.h"
+
+namespace game
+{
+using TileMapEdit = std::vector<TileRun>;
+
+inline void appendTileChange(TileMapEdit& edit, std::size_t tileIndex, int previousValue, int newValue)
+{
+    if (previousValue == newValue)
+    {
+        return;
+    }
+
+    if (not edit.empty())
+    {
+        auto& lastRun = edit.back();
+        if (lastRun.firstTileIndex + lastRun.length == tileIndex && lastRun.previousValue == previousValue &&
+            lastRun.newValue == newValue)
+        {
+            lastRun.length++;
+            return;
+        }
+    }
+
+    edit.push_back(TileRun{tileIndex, 1, previousValue, newValue});
+}
+}
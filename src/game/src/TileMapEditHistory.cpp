@@ -0,0 +1,130 @@
+#include "TileMapEditHistory.h"
+
+namespace game
+{
+namespace
+{
+void applyPreviousValues(TileMap& tileMap, const TileMapEdit& edit)
+{
+    for (auto run = edit.rbegin(); run != edit.rend(); run++)
+    {
+        for (auto tileIndex = run->firstTileIndex; tileIndex < run->firstTileIndex + run->length; tileIndex++)
+        {
+            tileMap.setTile(tileMap.getTilePosition(tileIndex), run->previousValue);
+        }
+    }
+}
+
+void applyNewValues(TileMap& tileMap, const TileMapEdit& edit)
+{
+    for (const auto& run : edit)
+    {
+        for (auto tileIndex = run.firstTileIndex; tileIndex < run.firstTileIndex + run.length; tileIndex++)
+        {
+            tileMap.setTile(tileMap.getTilePosition(tileIndex), run.newValue);
+        }
+    }
+}
+}
+
+TileMapEditHistory::TileMapEditHistory(std::size_t maxRecordedTileRunsInit)
+    : maxRecordedTileRuns{maxRecordedTileRunsInit}, recordedTileRuns{0}
+{
+}
+
+void TileMapEditHistory::recordTileChange(std::size_t tileIndex, int previousValue, int newValue)
+{
+    appendTileChange(pendingEdit, tileIndex, previousValue, newValue);
+}
+
+void TileMapEditHistory::recordEdit(const TileMapEdit& edit)
+{
+    for (const auto& tileRun : edit)
+    {
+        if (not pendingEdit.empty())
+        {
+            auto& lastRun = pendingEdit.back();
+            if (lastRun.firstTileIndex + lastRun.length == tileRun.firstTileIndex &&
+                lastRun.previousValue == tileRun.previousValue && lastRun.newValue == tileRun.newValue)
+            {
+                lastRun.length += tileRun.length;
+                continue;
+            }
+        }
+        pendingEdit.push_back(tileRun);
+    }
+}
+
+void TileMapEditHistory::commitEdit()
+{
+    if (pendingEdit.empty())
+    {
+        return;
+    }
+
+    recordedTileRuns += pendingEdit.size();
+    undoEdits.push_back(std::move(pendingEdit));
+    pendingEdit.clear();
+
+    for (const auto& redoEdit : redoEdits)
+    {
+        recordedTileRuns -= redoEdit.size();
+    }
+    redoEdits.clear();
+
+    dropOldestEditsAboveLimit();
+}
+
+boost::optional<const TileMapEdit&> TileMapEditHistory::undo(TileMap& tileMap)
+{
+    if (not canUndo())
+    {
+        return boost::none;
+    }
+
+    redoEdits.push_back(std::move(undoEdits.back()));
+    undoEdits.pop_back();
+    const auto& edit = redoEdits.back();
+    applyPreviousValues(tileMap, edit);
+    return edit;
+}
+
+boost::optional<const TileMapEdit&> TileMapEditHistory::redo(TileMap& tileMap)
+{
+    if (not canRedo())
+    {
+        return boost::none;
+    }
+
+    undoEdits.push_back(std::move(redoEdits.back()));
+    redoEdits.pop_back();
+    const auto& edit = undoEdits.back();
+    applyNewValues(tileMap, edit);
+    return edit;
+}
+
+bool TileMapEditHistory::canUndo() const
+{
+    return not undoEdits.empty();
+}
+
+bool TileMapEditHistory::canRedo() const
+{
+    return not redoEdits.empty();
+}
+
+std::size_t TileMapEditHistory::getNumberOfRecordedTileRuns() const
+{
+    return recordedTileRuns;
+}
+
+void TileMapEditHistory::dropOldestEditsAboveLimit()
+{
+    while (recordedTileRuns > maxRecordedTileRuns && undoEdits.size() > 1)
+    {
+        recordedTileRuns -= undoEdits.front().size();
+        undoEdits.pop_front();
+    }
+}
+
+}
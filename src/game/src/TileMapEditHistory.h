@@ -0,0 +1,34 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <deque>
+
+#include "TileMap.h"
+#include "TileMapEdit.h"
+
+namespace game
+{
+class TileMapEditHistory
+{
+public:
+    explicit TileMapEditHistory(std::size_t maxRecordedTileRuns);
+
+    void recordTileChange(std::size_t tileIndex, int previousValue, int newValue);
+    void recordEdit(const TileMapEdit&);
+    void commitEdit();
+    boost::optional<const TileMapEdit&> undo(TileMap&);
+    boost::optional<const TileMapEdit&> redo(TileMap&);
+    bool canUndo() const;
+    bool canRedo() const;
+    std::size_t getNumberOfRecordedTileRuns() const;
+
+private:
+    void dropOldestEditsAboveLimit();
+
+    const std::size_t maxRecordedTileRuns;
+    std::deque<TileMapEdit> undoEdits;
+    std::deque<TileMapEdit> redoEdits;
+    TileMapEdit pendingEdit;
+    std::size_t recordedTileRuns;
+};
+}
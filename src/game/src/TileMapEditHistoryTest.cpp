@@ -0,0 +1,120 @@
+#include "TileMapEditHistory.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace game;
+
+namespace
+{
+const utils::Vector2i mapSize{5, 4};
+const utils::Vector2f tileSize{1, 1};
+const std::size_t maxRecordedTileRuns{3};
+const int emptyTile{0};
+const int grassTile{1};
+const int stoneTile{2};
+}
+
+class TileMapEditHistoryTest : public Test
+{
+public:
+    void paintTiles(std::size_t firstTileIndex, std::size_t lastTileIndex, int value)
+    {
+        for (auto tileIndex = firstTileIndex; tileIndex <= lastTileIndex; tileIndex++)
+        {
+            const auto tilePosition = tileMap.getTilePosition(tileIndex);
+            history.recordTileChange(tileIndex, tileMap.getTile(tilePosition), value);
+            tileMap.setTile(tilePosition, value);
+        }
+        history.commitEdit();
+    }
+
+    TileMap tileMap{mapSize, tileSize};
+    TileMapEditHistory history{maxRecordedTileRuns};
+};
+
+TEST_F(TileMapEditHistoryTest, givenNoEdits_shouldNotUndoNorRedo)
+{
+    ASSERT_FALSE(history.canUndo());
+    ASSERT_FALSE(history.canRedo());
+    ASSERT_FALSE(history.undo(tileMap));
+    ASSERT_FALSE(history.redo(tileMap));
+}
+
+TEST_F(TileMapEditHistoryTest, consecutiveTileChanges_shouldBeCoalescedIntoSingleRun)
+{
+    paintTiles(3, 11, grassTile);
+
+    ASSERT_EQ(history.getNumberOfRecordedTileRuns(), 1);
+    const auto undoneEdit = history.undo(tileMap);
+    ASSERT_TRUE(undoneEdit);
+    ASSERT_EQ(*undoneEdit, (TileMapEdit{TileRun{3, 9, emptyTile, grassTile}}));
+}
+
+TEST_F(TileMapEditHistoryTest, tileChangesWithDifferentValues_shouldBeStoredInSeparateRuns)
+{
+    tileMap.setTile(tileMap.getTilePosition(1), stoneTile);
+
+    paintTiles(0, 2, grassTile);
+
+    ASSERT_EQ(history.getNumberOfRecordedTileRuns(), 3);
+}
+
+TEST_F(TileMapEditHistoryTest, undo_shouldRestorePreviousTiles)
+{
+    paintTiles(0, 4, grassTile);
+    paintTiles(2, 6, stoneTile);
+
+    history.undo(tileMap);
+
+    ASSERT_EQ(tileMap.getTile({2, 0}), grassTile);
+    ASSERT_EQ(tileMap.getTile({0, 1}), emptyTile);
+    ASSERT_TRUE(history.canRedo());
+}
+
+TEST_F(TileMapEditHistoryTest, redo_shouldReapplyUndoneTiles)
+{
+    paintTiles(0, 4, grassTile);
+    history.undo(tileMap);
+
+    const auto redoneEdit = history.redo(tileMap);
+
+    ASSERT_TRUE(redoneEdit);
+    ASSERT_EQ(*redoneEdit, (TileMapEdit{TileRun{0, 5, emptyTile, grassTile}}));
+    ASSERT_EQ(tileMap.getTile({4, 0}), grassTile);
+    ASSERT_FALSE(history.canRedo());
+}
+
+TEST_F(TileMapEditHistoryTest, commitEditAfterUndo_shouldDiscardRedoHistory)
+{
+    paintTiles(0, 4, grassTile);
+    history.undo(tileMap);
+
+    paintTiles(7, 8, stoneTile);
+
+    ASSERT_FALSE(history.canRedo());
+    ASSERT_EQ(history.getNumberOfRecordedTileRuns(), 1);
+}
+
+TEST_F(TileMapEditHistoryTest, unchangedTile_shouldNotBeRecorded)
+{
+    history.recordTileChange(0, grassTile, grassTile);
+    history.commitEdit();
+
+    ASSERT_FALSE(history.canUndo());
+}
+
+TEST_F(TileMapEditHistoryTest, exceedingRecordedTileRunsLimit_shouldDropOldestEdits)
+{
+    paintTiles(0, 0, grassTile);
+    paintTiles(2, 2, grassTile);
+    paintTiles(4, 4, grassTile);
+    paintTiles(6, 6, grassTile);
+
+    ASSERT_EQ(history.getNumberOfRecordedTileRuns(), maxRecordedTileRuns);
+    history.undo(tileMap);
+    history.undo(tileMap);
+    history.undo(tileMap);
+    ASSERT_FALSE(history.canUndo());
+    ASSERT_EQ(tileMap.getTile({0, 0}), grassTile);
+}
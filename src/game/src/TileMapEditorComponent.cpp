@@ -0,0 +1,338 @@
+#include "TileMapEditorComponent.h"
+
+#include <cmath>
+
+#include "core/ComponentOwner.h"
+#include "exceptions/TileTexturesNotInitialized.h"
+
+namespace game
+{
+namespace
+{
+const auto emptyTile{0};
+const auto highlightOutlineThickness{0.2f};
+const auto emptyTileHighlightColor = graphics::Color(255, 255, 255, 64);
+const auto placedTileHighlightColor = graphics::Color::Transparent;
+const std::size_t maxRecordedTileRuns{100000};
+}
+
+TileMapEditorComponent::TileMapEditorComponent(components::core::ComponentOwner* ownerInit,
+                                               std::shared_ptr<input::InputManager> inputManagerInit,
+                                               std::shared_ptr<graphics::RendererPool> rendererPoolInit,
+                                               std::shared_ptr<TileMap> tileMapInit,
+                                               std::vector<graphics::TexturePath> tileTexturePathsInit)
+    : Component{ownerInit},
+      inputManager{std::move(inputManagerInit)},
+      rendererPool{std::move(rendererPoolInit)},
+      tileMap{std::move(tileMapInit)},
+      tileTexturePaths{std::move(tileTexturePathsInit)},
+      inputStatus{nullptr},
+      editHistory{maxRecordedTileRuns},
+      tool{TileMapEditorTool::Brush},
+      currentTileTypeIndex{0},
+      clickingEnabled{false}
+{
+    if (tileTexturePaths.empty())
+    {
+        throw exceptions::TileTexturesNotInitialized{"TileMapEditorComponent: Tile textures not initialized"};
+    }
+
+    tileLayerId = rendererPool->acquireTileLayer(owner->transform->getPosition(), tileMap->getSize(),
+                                                 tileMap->getTileSize(), tileTexturePaths,
+                                                 graphics::VisibilityLayer::Second);
+    rendererPool->setTiles(tileLayerId, tileMap->getTiles());
+    highlightId = rendererPool->acquire(tileMap->getTileSize(), owner->transform->getPosition(),
+                                        tileTexturePaths[currentTileTypeIndex],
+                                        graphics::VisibilityLayer::Invisible);
+    inputManager->registerObserver(this);
+}
+
+TileMapEditorComponent::~TileMapEditorComponent()
+{
+    inputManager->removeObserver(this);
+    rendererPool->release(highlightId);
+    rendererPool->release(tileLayerId);
+}
+
+void TileMapEditorComponent::update(utils::DeltaTime)
+{
+    if (not enabled)
+    {
+        return;
+    }
+
+    const auto tilePosition = getTilePosition(inputStatus->getMousePosition());
+    if (tilePosition != hoveredTilePosition)
+    {
+        hoveredTilePosition = tilePosition;
+        if (hoveredTilePosition)
+        {
+            showHighlight(*hoveredTilePosition);
+        }
+        else
+        {
+            hideHighlight();
+        }
+    }
+
+    if (not clickingEnabled)
+    {
+        return;
+    }
+
+    if (inputStatus->isKeyPressed(input::InputKey::Control))
+    {
+        if (inputStatus->isKeyReleased(input::InputKey::Z))
+        {
+            undo();
+        }
+        else if (inputStatus->isKeyReleased(input::InputKey::Y))
+        {
+            redo();
+        }
+        return;
+    }
+
+    selectToolFromInput();
+
+    if (inputStatus->isKeyReleased(input::InputKey::MouseRight))
+    {
+        selectNextTileType();
+    }
+
+    if (hoveredTilePosition && not dragStartTilePosition &&
+        inputStatus->isKeyPressed(input::InputKey::MouseLeft))
+    {
+        dragStartTilePosition = hoveredTilePosition;
+    }
+
+    if (inputStatus->isKeyReleased(input::InputKey::MouseLeft))
+    {
+        if (hoveredTilePosition)
+        {
+            applyTool(*hoveredTilePosition);
+        }
+        dragStartTilePosition = boost::none;
+    }
+}
+
+void TileMapEditorComponent::handleInputStatus(const input::InputStatus& inputStatusInit)
+{
+    inputStatus = &inputStatusInit;
+}
+
+void TileMapEditorComponent::enable()
+{
+    Component::enable();
+    hoveredTilePosition = boost::none;
+}
+
+void TileMapEditorComponent::disable()
+{
+    Component::disable();
+    hoveredTilePosition = boost::none;
+    dragStartTilePosition = boost::none;
+    hideHighlight();
+}
+
+void TileMapEditorComponent::enableClicking()
+{
+    clickingEnabled = true;
+}
+
+void TileMapEditorComponent::disableClicking()
+{
+    clickingEnabled = false;
+    dragStartTilePosition = boost::none;
+}
+
+void TileMapEditorComponent::selectNextTileType()
+{
+    currentTileTypeIndex = currentTileTypeIndex + 1 < tileTexturePaths.size() ? currentTileTypeIndex + 1 : 0;
+
+    if (hoveredTilePosition)
+    {
+        showHighlight(*hoveredTilePosition);
+    }
+}
+
+void TileMapEditorComponent::setTool(TileMapEditorTool toolInit)
+{
+    tool = toolInit;
+    dragStartTilePosition = boost::none;
+}
+
+TileMapEditorTool TileMapEditorComponent::getTool() const
+{
+    return tool;
+}
+
+void TileMapEditorComponent::undo()
+{
+    if (const auto edit = editHistory.undo(*tileMap))
+    {
+        showPreviousTiles(*edit);
+        if (hoveredTilePosition)
+        {
+            showHighlight(*hoveredTilePosition);
+        }
+    }
+}
+
+void TileMapEditorComponent::redo()
+{
+    if (const auto edit = editHistory.redo(*tileMap))
+    {
+        showNewTiles(*edit);
+        if (hoveredTilePosition)
+        {
+            showHighlight(*hoveredTilePosition);
+        }
+    }
+}
+
+boost::optional<utils::Vector2i> TileMapEditorComponent::getHoveredTilePosition() const
+{
+    return hoveredTilePosition;
+}
+
+void TileMapEditorComponent::selectToolFromInput()
+{
+    if (inputStatus->isKeyReleased(input::InputKey::B))
+    {
+        setTool(TileMapEditorTool::Brush);
+    }
+    else if (inputStatus->isKeyReleased(input::InputKey::R))
+    {
+        setTool(TileMapEditorTool::Rectangle);
+    }
+    else if (inputStatus->isKeyReleased(input::InputKey::L))
+    {
+        setTool(TileMapEditorTool::Line);
+    }
+    else if (inputStatus->isKeyReleased(input::InputKey::F))
+    {
+        setTool(TileMapEditorTool::FloodFill);
+    }
+}
+
+void TileMapEditorComponent::applyTool(const utils::Vector2i& tilePosition)
+{
+    const auto dragStart = dragStartTilePosition.value_or(tilePosition);
+
+    switch (tool)
+    {
+    case TileMapEditorTool::Brush:
+        commitTileMapEdit(toggleTile(tilePosition));
+        break;
+    case TileMapEditorTool::Rectangle:
+        commitTileMapEdit(tileMap->fillRectangle(dragStart, tilePosition, getCurrentTile()));
+        break;
+    case TileMapEditorTool::Line:
+        commitTileMapEdit(tileMap->drawLine(dragStart, tilePosition, getCurrentTile()));
+        break;
+    case TileMapEditorTool::FloodFill:
+        commitTileMapEdit(tileMap->floodFill(tilePosition, getCurrentTile()));
+        break;
+    }
+}
+
+TileMapEdit TileMapEditorComponent::toggleTile(const utils::Vector2i& tilePosition)
+{
+    const auto previousTile = tileMap->getTile(tilePosition);
+    const auto newTile = previousTile == emptyTile ? getCurrentTile() : emptyTile;
+
+    tileMap->setTile(tilePosition, newTile);
+
+    TileMapEdit edit;
+    appendTileChange(edit, tileMap->getTileIndex(tilePosition), previousTile, newTile);
+    return edit;
+}
+
+void TileMapEditorComponent::commitTileMapEdit(const TileMapEdit& edit)
+{
+    if (edit.empty())
+    {
+        return;
+    }
+
+    editHistory.recordEdit(edit);
+    editHistory.commitEdit();
+    showNewTiles(edit);
+
+    if (hoveredTilePosition)
+    {
+        showHighlight(*hoveredTilePosition);
+    }
+}
+
+void TileMapEditorComponent::showNewTiles(const TileMapEdit& edit)
+{
+    for (const auto& run : edit)
+    {
+        rendererPool->setTiles(tileLayerId, run.firstTileIndex, run.length, run.newValue);
+    }
+}
+
+void TileMapEditorComponent::showPreviousTiles(const TileMapEdit& edit)
+{
+    for (auto run = edit.rbegin(); run != edit.rend(); run++)
+    {
+        rendererPool->setTiles(tileLayerId, run->firstTileIndex, run->length, run->previousValue);
+    }
+}
+
+boost::optional<utils::Vector2i>
+TileMapEditorComponent::getTilePosition(const utils::Vector2f& mousePosition) const
+{
+    const auto mousePositionOnMap = mousePosition - owner->transform->getPosition();
+    const auto tileSize = tileMap->getTileSize();
+    const auto tilePosition =
+        utils::Vector2i{static_cast<int>(std::floor(mousePositionOnMap.x / tileSize.x)),
+                        static_cast<int>(std::floor(mousePositionOnMap.y / tileSize.y))};
+
+    if (not tileMap->isInside(tilePosition))
+    {
+        return boost::none;
+    }
+    return tilePosition;
+}
+
+utils::Vector2f TileMapEditorComponent::getTileWorldPosition(const utils::Vector2i& tilePosition) const
+{
+    const auto tileSize = tileMap->getTileSize();
+    return owner->transform->getPosition() +
+           utils::Vector2f{static_cast<float>(tilePosition.x) * tileSize.x,
+                           static_cast<float>(tilePosition.y) * tileSize.y};
+}
+
+int TileMapEditorComponent::getCurrentTile() const
+{
+    return static_cast<int>(currentTileTypeIndex) + 1;
+}
+
+void TileMapEditorComponent::showHighlight(const utils::Vector2i& tilePosition)
+{
+    rendererPool->setPosition(highlightId, getTileWorldPosition(tilePosition));
+
+    if (tileMap->getTile(tilePosition) == emptyTile)
+    {
+        rendererPool->setTexture(highlightId, tileTexturePaths[currentTileTypeIndex]);
+        rendererPool->setColor(highlightId, emptyTileHighlightColor);
+        rendererPool->setOutline(highlightId, highlightOutlineThickness, graphics::Color::Green);
+    }
+    else
+    {
+        rendererPool->setColor(highlightId, placedTileHighlightColor);
+        rendererPool->setOutline(highlightId, highlightOutlineThickness, graphics::Color::Red);
+    }
+
+    rendererPool->setVisibility(highlightId, graphics::VisibilityLayer::First);
+}
+
+void TileMapEditorComponent::hideHighlight()
+{
+    rendererPool->setVisibility(highlightId, graphics::VisibilityLayer::Invisible);
+}
+
+}
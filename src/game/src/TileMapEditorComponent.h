@@ -0,0 +1,65 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <memory>
+#include <vector>
+
+#include "InputManager.h"
+#include "InputObserver.h"
+#include "RendererPool.h"
+#include "TileMap.h"
+#include "TileMapEditHistory.h"
+#include "TileMapEditorTool.h"
+#include "core/Component.h"
+
+namespace game
+{
+class TileMapEditorComponent : public components::core::Component, public input::InputObserver
+{
+public:
+    TileMapEditorComponent(components::core::ComponentOwner*, std::shared_ptr<input::InputManager>,
+                           std::shared_ptr<graphics::RendererPool>, std::shared_ptr<TileMap>,
+                           std::vector<graphics::TexturePath> tileTexturePaths);
+    ~TileMapEditorComponent();
+
+    void update(utils::DeltaTime) override;
+    void handleInputStatus(const input::InputStatus&) override;
+    void enable() override;
+    void disable() override;
+    void enableClicking();
+    void disableClicking();
+    void selectNextTileType();
+    void setTool(TileMapEditorTool);
+    TileMapEditorTool getTool() const;
+    void undo();
+    void redo();
+    boost::optional<utils::Vector2i> getHoveredTilePosition() const;
+
+private:
+    void selectToolFromInput();
+    void applyTool(const utils::Vector2i& tilePosition);
+    TileMapEdit toggleTile(const utils::Vector2i& tilePosition);
+    void commitTileMapEdit(const TileMapEdit&);
+    void showNewTiles(const TileMapEdit&);
+    void showPreviousTiles(const TileMapEdit&);
+    boost::optional<utils::Vector2i> getTilePosition(const utils::Vector2f& mousePosition) const;
+    utils::Vector2f getTileWorldPosition(const utils::Vector2i& tilePosition) const;
+    int getCurrentTile() const;
+    void showHighlight(const utils::Vector2i& tilePosition);
+    void hideHighlight();
+
+    std::shared_ptr<input::InputManager> inputManager;
+    std::shared_ptr<graphics::RendererPool> rendererPool;
+    std::shared_ptr<TileMap> tileMap;
+    const std::vector<graphics::TexturePath> tileTexturePaths;
+    const input::InputStatus* inputStatus;
+    graphics::GraphicsId highlightId;
+    graphics::GraphicsId tileLayerId;
+    TileMapEditHistory editHistory;
+    TileMapEditorTool tool;
+    boost::optional<utils::Vector2i> hoveredTilePosition;
+    boost::optional<utils::Vector2i> dragStartTilePosition;
+    unsigned int currentTileTypeIndex;
+    bool clickingEnabled;
+};
+}
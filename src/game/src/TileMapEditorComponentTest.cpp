@@ -0,0 +1,311 @@
+#include "TileMapEditorComponent.h"
+
+#include "gtest/gtest.h"
+
+#include "InputManagerMock.h"
+#include "RendererPoolMock.h"
+
+#include "GraphicsIdGenerator.h"
+#include "core/ComponentOwner.h"
+#include "exceptions/TileTexturesNotInitialized.h"
+
+using namespace ::testing;
+using namespace game;
+using namespace input;
+using namespace graphics;
+
+namespace
+{
+const utils::Vector2i mapSize{4, 3};
+const utils::Vector2f tileSize{2, 2};
+const TexturePath firstTileTexturePath{"firstTileTexturePath"};
+const TexturePath secondTileTexturePath{"secondTileTexturePath"};
+const std::vector<TexturePath> tileTexturePaths{firstTileTexturePath, secondTileTexturePath};
+const utils::Vector2f mapPosition{10, 10};
+const utils::Vector2f positionInsideFirstTile{10.5, 11};
+const utils::Vector2f positionInsideLastTile{17.5, 15.5};
+const utils::Vector2f positionOutsideMap{9, 10};
+const utils::Vector2i lastTilePosition{3, 2};
+const std::size_t lastTileIndex{11};
+const utils::Vector2f lastTileWorldPosition{16, 14};
+const utils::Vector2f firstTileWorldPosition{10, 10};
+}
+
+class TileMapEditorComponentTest_Base : public Test
+{
+public:
+    const GraphicsId highlightId{GraphicsIdGenerator::generateId()};
+    const GraphicsId tileLayerId{GraphicsIdGenerator::generateId()};
+    std::shared_ptr<StrictMock<InputManagerMock>> inputManager =
+        std::make_shared<StrictMock<InputManagerMock>>();
+    std::shared_ptr<StrictMock<RendererPoolMock>> rendererPool =
+        std::make_shared<StrictMock<RendererPoolMock>>();
+    std::shared_ptr<TileMap> tileMap = std::make_shared<TileMap>(mapSize, tileSize);
+    components::core::ComponentOwner componentOwner{mapPosition};
+};
+
+class TileMapEditorComponentTest_WithHighlight : public TileMapEditorComponentTest_Base
+{
+public:
+    TileMapEditorComponentTest_WithHighlight()
+    {
+        EXPECT_CALL(*inputManager, registerObserver(_));
+        EXPECT_CALL(*inputManager, removeObserver(_));
+        EXPECT_CALL(*rendererPool, acquireTileLayer(mapPosition, mapSize, tileSize, tileTexturePaths,
+                                                    VisibilityLayer::Second))
+            .WillOnce(Return(tileLayerId));
+        EXPECT_CALL(*rendererPool, setTiles(tileLayerId, std::vector<int>(12, 0)));
+        EXPECT_CALL(*rendererPool, release(tileLayerId));
+        EXPECT_CALL(*rendererPool, acquire(tileSize, mapPosition, firstTileTexturePath,
+                                           VisibilityLayer::Invisible))
+            .WillOnce(Return(highlightId));
+        EXPECT_CALL(*rendererPool, release(highlightId));
+    }
+};
+
+class TileMapEditorComponentTest : public TileMapEditorComponentTest_WithHighlight
+{
+public:
+    InputStatus prepareInputStatus(const utils::Vector2f& mousePosition)
+    {
+        InputStatus inputStatus;
+        inputStatus.setMousePosition(mousePosition);
+        return inputStatus;
+    }
+
+    InputStatus prepareInputStatus(InputKey releasedKey, const utils::Vector2f& mousePosition)
+    {
+        InputStatus inputStatus;
+        inputStatus.setKeyPressed(releasedKey);
+        inputStatus.setMousePosition(mousePosition);
+        inputStatus.setReleasedKeys();
+        inputStatus.clearPressedKeys();
+        inputStatus.setReleasedKeys();
+        return inputStatus;
+    }
+
+    void expectEmptyTileHighlight(const utils::Vector2f& worldPosition, const TexturePath& texturePath)
+    {
+        EXPECT_CALL(*rendererPool, setPosition(highlightId, worldPosition)).RetiresOnSaturation();
+        EXPECT_CALL(*rendererPool, setTexture(highlightId, texturePath, _)).RetiresOnSaturation();
+        EXPECT_CALL(*rendererPool, setColor(highlightId, Color(255, 255, 255, 64))).RetiresOnSaturation();
+        EXPECT_CALL(*rendererPool, setOutline(highlightId, _, Color::Green)).RetiresOnSaturation();
+        EXPECT_CALL(*rendererPool, setVisibility(highlightId, VisibilityLayer::First)).RetiresOnSaturation();
+    }
+
+    void expectTilesUpdate(std::size_t firstTileIndex, std::size_t numberOfTiles, int tile)
+    {
+        EXPECT_CALL(*rendererPool, setTiles(tileLayerId, firstTileIndex, numberOfTiles, tile))
+            .RetiresOnSaturation();
+    }
+
+    void expectPlacedTileHighlight(const utils::Vector2f& worldPosition)
+    {
+        EXPECT_CALL(*rendererPool, setPosition(highlightId, worldPosition)).RetiresOnSaturation();
+        EXPECT_CALL(*rendererPool, setColor(highlightId, Color::Transparent)).RetiresOnSaturation();
+        EXPECT_CALL(*rendererPool, setOutline(highlightId, _, Color::Red)).RetiresOnSaturation();
+        EXPECT_CALL(*rendererPool, setVisibility(highlightId, VisibilityLayer::First)).RetiresOnSaturation();
+    }
+
+    utils::DeltaTime deltaTime{1};
+    TileMapEditorComponent tileMapEditor{&componentOwner, inputManager, rendererPool, tileMap,
+                                         tileTexturePaths};
+};
+
+TEST_F(TileMapEditorComponentTest_Base, givenEmptyTileTextures_shouldThrowTileTexturesNotInitialized)
+{
+    ASSERT_THROW(TileMapEditorComponent(&componentOwner, inputManager, rendererPool, tileMap, {}),
+                 game::exceptions::TileTexturesNotInitialized);
+}
+
+TEST_F(TileMapEditorComponentTest, givenMouseOutsideMap_shouldNotHoverAnyTile)
+{
+    const auto inputStatus = prepareInputStatus(positionOutsideMap);
+    tileMapEditor.handleInputStatus(inputStatus);
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMapEditor.getHoveredTilePosition(), boost::none);
+}
+
+TEST_F(TileMapEditorComponentTest, givenMouseOverEmptyTile_shouldComputeTileAndShowHighlightOnce)
+{
+    const auto inputStatus = prepareInputStatus(positionInsideLastTile);
+    tileMapEditor.handleInputStatus(inputStatus);
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+
+    tileMapEditor.update(deltaTime);
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMapEditor.getHoveredTilePosition(), lastTilePosition);
+}
+
+TEST_F(TileMapEditorComponentTest, givenMouseLeavingMap_shouldHideHighlight)
+{
+    const auto inputStatusInside = prepareInputStatus(positionInsideFirstTile);
+    const auto inputStatusOutside = prepareInputStatus(positionOutsideMap);
+    expectEmptyTileHighlight(firstTileWorldPosition, firstTileTexturePath);
+    tileMapEditor.handleInputStatus(inputStatusInside);
+    tileMapEditor.update(deltaTime);
+    EXPECT_CALL(*rendererPool, setVisibility(highlightId, VisibilityLayer::Invisible));
+
+    tileMapEditor.handleInputStatus(inputStatusOutside);
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMapEditor.getHoveredTilePosition(), boost::none);
+}
+
+TEST_F(TileMapEditorComponentTest, givenClickingDisabled_shouldNotPlaceTile)
+{
+    const auto inputStatus = prepareInputStatus(InputKey::MouseLeft, positionInsideLastTile);
+    tileMapEditor.handleInputStatus(inputStatus);
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMap->getTile(lastTilePosition), 0);
+}
+
+TEST_F(TileMapEditorComponentTest, givenClickOnEmptyTile_shouldPlaceTileInTileMap)
+{
+    const auto inputStatus = prepareInputStatus(InputKey::MouseLeft, positionInsideLastTile);
+    tileMapEditor.handleInputStatus(inputStatus);
+    tileMapEditor.enableClicking();
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+    expectTilesUpdate(lastTileIndex, 1, 1);
+    expectPlacedTileHighlight(lastTileWorldPosition);
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMap->getTile(lastTilePosition), 1);
+}
+
+TEST_F(TileMapEditorComponentTest, givenClickOnPlacedTile_shouldRemoveTileFromTileMap)
+{
+    tileMap->setTile(lastTilePosition, 1);
+    const auto inputStatus = prepareInputStatus(InputKey::MouseLeft, positionInsideLastTile);
+    tileMapEditor.handleInputStatus(inputStatus);
+    tileMapEditor.enableClicking();
+    expectPlacedTileHighlight(lastTileWorldPosition);
+    expectTilesUpdate(lastTileIndex, 1, 0);
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMap->getTile(lastTilePosition), 0);
+}
+
+TEST_F(TileMapEditorComponentTest, givenRightClick_shouldSelectNextTileType)
+{
+    const auto inputStatus = prepareInputStatus(InputKey::MouseRight, positionOutsideMap);
+    tileMapEditor.handleInputStatus(inputStatus);
+    tileMapEditor.enableClicking();
+    tileMapEditor.update(deltaTime);
+    const auto inputStatusWithClick = prepareInputStatus(InputKey::MouseLeft, positionInsideLastTile);
+    tileMapEditor.handleInputStatus(inputStatusWithClick);
+    expectEmptyTileHighlight(lastTileWorldPosition, secondTileTexturePath);
+    expectTilesUpdate(lastTileIndex, 1, 2);
+    expectPlacedTileHighlight(lastTileWorldPosition);
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMap->getTile(lastTilePosition), 2);
+}
+
+TEST_F(TileMapEditorComponentTest, disable_shouldHideHighlightAndIgnoreInput)
+{
+    const auto inputStatus = prepareInputStatus(positionInsideLastTile);
+    tileMapEditor.handleInputStatus(inputStatus);
+    EXPECT_CALL(*rendererPool, setVisibility(highlightId, VisibilityLayer::Invisible));
+
+    tileMapEditor.disable();
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMapEditor.getHoveredTilePosition(), boost::none);
+}
+TEST_F(TileMapEditorComponentTest, controlYAfterUndo_shouldRedoPlacement)
+{
+    const auto clickStatus = prepareInputStatus(InputKey::MouseLeft, positionInsideLastTile);
+    tileMapEditor.handleInputStatus(clickStatus);
+    tileMapEditor.enableClicking();
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+    expectTilesUpdate(lastTileIndex, 1, 1);
+    expectPlacedTileHighlight(lastTileWorldPosition);
+    tileMapEditor.update(deltaTime);
+    expectTilesUpdate(lastTileIndex, 1, 0);
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+    tileMapEditor.undo();
+    expectTilesUpdate(lastTileIndex, 1, 1);
+    expectPlacedTileHighlight(lastTileWorldPosition);
+
+    tileMapEditor.redo();
+
+    ASSERT_EQ(tileMap->getTile(lastTilePosition), 1);
+}
+
+TEST_F(TileMapEditorComponentTest, controlZAfterPlacingTile_shouldUndoPlacement)
+{
+    const auto clickStatus = prepareInputStatus(InputKey::MouseLeft, positionInsideLastTile);
+    tileMapEditor.handleInputStatus(clickStatus);
+    tileMapEditor.enableClicking();
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+    expectTilesUpdate(lastTileIndex, 1, 1);
+    expectPlacedTileHighlight(lastTileWorldPosition);
+    tileMapEditor.update(deltaTime);
+    auto undoStatus = prepareInputStatus(InputKey::Z, positionInsideLastTile);
+    undoStatus.setKeyPressed(InputKey::Control);
+    tileMapEditor.handleInputStatus(undoStatus);
+    expectTilesUpdate(lastTileIndex, 1, 0);
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMap->getTile(lastTilePosition), 0);
+}
+
+TEST_F(TileMapEditorComponentTest, givenRectangleTool_dragAcrossMap_shouldFillWholeMapWithSingleUpdate)
+{
+    auto pressStatus = prepareInputStatus(positionInsideFirstTile);
+    pressStatus.setKeyPressed(InputKey::MouseLeft);
+    tileMapEditor.handleInputStatus(pressStatus);
+    tileMapEditor.enableClicking();
+    tileMapEditor.setTool(TileMapEditorTool::Rectangle);
+    expectEmptyTileHighlight(firstTileWorldPosition, firstTileTexturePath);
+    tileMapEditor.update(deltaTime);
+    const auto releaseStatus = prepareInputStatus(InputKey::MouseLeft, positionInsideLastTile);
+    tileMapEditor.handleInputStatus(releaseStatus);
+    expectEmptyTileHighlight(lastTileWorldPosition, firstTileTexturePath);
+    expectTilesUpdate(0, 12, 1);
+    expectPlacedTileHighlight(lastTileWorldPosition);
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMap->getTiles(), std::vector<int>(12, 1));
+}
+
+TEST_F(TileMapEditorComponentTest, givenFloodFillTool_clickOnEmptyTile_shouldFillConnectedEmptyTiles)
+{
+    tileMap->fillRectangle({2, 0}, {2, 2}, 2);
+    const auto inputStatus = prepareInputStatus(InputKey::MouseLeft, positionInsideFirstTile);
+    tileMapEditor.handleInputStatus(inputStatus);
+    tileMapEditor.enableClicking();
+    tileMapEditor.setTool(TileMapEditorTool::FloodFill);
+    expectEmptyTileHighlight(firstTileWorldPosition, firstTileTexturePath);
+    EXPECT_CALL(*rendererPool, setTiles(tileLayerId, _, _, 1)).Times(AtLeast(1));
+    expectPlacedTileHighlight(firstTileWorldPosition);
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMap->getTiles(), (std::vector<int>{1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0}));
+}
+
+TEST_F(TileMapEditorComponentTest, releasingToolKey_shouldSelectTool)
+{
+    const auto inputStatus = prepareInputStatus(InputKey::F, positionOutsideMap);
+    tileMapEditor.handleInputStatus(inputStatus);
+    tileMapEditor.enableClicking();
+
+    tileMapEditor.update(deltaTime);
+
+    ASSERT_EQ(tileMapEditor.getTool(), TileMapEditorTool::FloodFill);
+}
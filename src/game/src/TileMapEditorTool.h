@@ -0,0 +1,12 @@
+#pragma once
+
+namespace game
+{
+enum class TileMapEditorTool
+{
+    Brush,
+    Rectangle,
+    Line,
+    FloodFill
+};
+}
@@ -0,0 +1,236 @@
+#include "TileMap.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace game;
+
+namespace
+{
+const utils::Vector2i mapSize{5, 4};
+const utils::Vector2f tileSize{1, 1};
+const utils::Vector2i largeMapSize{1000, 1000};
+const int emptyTile{0};
+const int grassTile{1};
+const int stoneTile{2};
+}
+
+class TileMapTest : public Test
+{
+public:
+    TileMap tileMap{mapSize, tileSize};
+};
+
+TEST_F(TileMapTest, createdTileMap_shouldHaveOnlyEmptyTiles)
+{
+    ASSERT_EQ(tileMap.getTiles(), std::vector<int>(20, emptyTile));
+}
+
+TEST_F(TileMapTest, getTileIndexAndPosition_shouldBeInverse)
+{
+    const utils::Vector2i position{3, 2};
+
+    ASSERT_EQ(tileMap.getTileIndex(position), 13);
+    ASSERT_EQ(tileMap.getTilePosition(13), position);
+}
+
+TEST_F(TileMapTest, fillRectangle_shouldFillTilesBetweenCornersAndReturnOneRunPerRow)
+{
+    const auto edit = tileMap.fillRectangle({3, 2}, {1, 1}, grassTile);
+
+    ASSERT_EQ(tileMap.getTiles(),
+              (std::vector<int>{0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0}));
+    ASSERT_EQ(edit, (TileMapEdit{TileRun{6, 3, emptyTile, grassTile}, TileRun{11, 3, emptyTile, grassTile}}));
+}
+
+TEST_F(TileMapTest, fillRectangle_withCornersOutsideMap_shouldClampToMap)
+{
+    tileMap.fillRectangle({-10, -10}, {10, 10}, grassTile);
+
+    ASSERT_EQ(tileMap.getTiles(), std::vector<int>(20, grassTile));
+}
+
+TEST_F(TileMapTest, fillRectangle_partiallyOutsideMap_shouldFillOnlyOverlappingTiles)
+{
+    const auto edit = tileMap.fillRectangle({3, -2}, {7, 0}, grassTile);
+
+    ASSERT_EQ(tileMap.getTiles(),
+              (std::vector<int>{0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}));
+    ASSERT_EQ(edit, (TileMapEdit{TileRun{3, 2, emptyTile, grassTile}}));
+}
+
+TEST_F(TileMapTest, fillRectangle_entirelyOutsideMap_shouldNotChangeAnyTile)
+{
+    const auto edit = tileMap.fillRectangle({6, 1}, {9, 3}, grassTile);
+    const auto editAboveMap = tileMap.fillRectangle({0, -3}, {4, -1}, grassTile);
+
+    ASSERT_TRUE(edit.empty());
+    ASSERT_TRUE(editAboveMap.empty());
+    ASSERT_EQ(tileMap.getTiles(), std::vector<int>(20, emptyTile));
+}
+
+TEST_F(TileMapTest, drawLine_horizontal_shouldReturnSingleRun)
+{
+    const auto edit = tileMap.drawLine({4, 1}, {0, 1}, stoneTile);
+
+    ASSERT_EQ(edit.size(), 5);
+    ASSERT_EQ(tileMap.getTile({0, 1}), stoneTile);
+    ASSERT_EQ(tileMap.getTile({4, 1}), stoneTile);
+}
+
+TEST_F(TileMapTest, drawLine_diagonal_shouldSetTilesOnDiagonal)
+{
+    tileMap.drawLine({0, 0}, {3, 3}, stoneTile);
+
+    ASSERT_EQ(tileMap.getTile({0, 0}), stoneTile);
+    ASSERT_EQ(tileMap.getTile({1, 1}), stoneTile);
+    ASSERT_EQ(tileMap.getTile({2, 2}), stoneTile);
+    ASSERT_EQ(tileMap.getTile({3, 3}), stoneTile);
+    ASSERT_EQ(tileMap.getTile({1, 0}), emptyTile);
+}
+
+TEST_F(TileMapTest, floodFill_shouldFillOnlyConnectedTilesWithSameValue)
+{
+    tileMap.drawLine({2, 0}, {2, 3}, stoneTile);
+
+    tileMap.floodFill({0, 0}, grassTile);
+
+    ASSERT_EQ(tileMap.getTiles(),
+              (std::vector<int>{1, 1, 2, 0, 0, 1, 1, 2, 0, 0, 1, 1, 2, 0, 0, 1, 1, 2, 0, 0}));
+}
+
+TEST_F(TileMapTest, floodFill_withSameValue_shouldNotChangeAnything)
+{
+    const auto edit = tileMap.floodFill({0, 0}, emptyTile);
+
+    ASSERT_TRUE(edit.empty());
+}
+
+TEST_F(TileMapTest, floodFill_outsideMap_shouldNotChangeAnything)
+{
+    const auto edit = tileMap.floodFill({-1, 0}, grassTile);
+
+    ASSERT_TRUE(edit.empty());
+}
+
+TEST_F(TileMapTest, floodFill_largeMap_shouldFillWholeMapWithAtMostOneRunPerRow)
+{
+    TileMap largeTileMap{largeMapSize, tileSize};
+
+    const auto edit = largeTileMap.floodFill({500, 500}, grassTile);
+
+    ASSERT_EQ(largeTileMap.getTiles(), std::vector<int>(1000000, grassTile));
+    ASSERT_LE(edit.size(), static_cast<std::size_t>(largeMapSize.y));
+}
+
+class TileMapCollisionTest : public Test
+{
+public:
+    TileMapCollisionTest()
+    {
+        tileMap.fillRectangle({0, 7}, {9, 7}, stoneTile);
+        tileMap.fillRectangle({6, 0}, {6, 6}, stoneTile);
+    }
+
+    TileMap tileMap{{10, 8}, {2, 2}};
+};
+
+TEST_F(TileMapCollisionTest, isSolid_shouldBeTrueOnlyForNonEmptyTilesInsideMap)
+{
+    ASSERT_TRUE(tileMap.isSolid({6, 3}));
+    ASSERT_FALSE(tileMap.isSolid({5, 3}));
+    ASSERT_FALSE(tileMap.isSolid({-1, 7}));
+}
+
+TEST_F(TileMapCollisionTest, overlapsSolidTile_givenAreaTouchingSolidTile_shouldReturnTrue)
+{
+    ASSERT_TRUE(tileMap.overlapsSolidTile({10, 10, 3, 1}));
+    ASSERT_TRUE(tileMap.overlapsSolidTile({0, 13.5f, 1, 1}));
+}
+
+TEST_F(TileMapCollisionTest, overlapsSolidTile_givenAreaEndingOnTileBoundary_shouldReturnFalse)
+{
+    ASSERT_FALSE(tileMap.overlapsSolidTile({8, 10, 4, 4}));
+    ASSERT_FALSE(tileMap.overlapsSolidTile({-5, -5, 3, 3}));
+}
+
+TEST_F(TileMapCollisionTest, sweep_withoutObstacles_shouldAllowWholeDisplacement)
+{
+    const auto result = tileMap.sweep({1, 1, 2, 2}, {3, 4});
+
+    ASSERT_EQ(result.displacement, (utils::Vector2f{3, 4}));
+    ASSERT_FALSE(result.collidedHorizontally);
+    ASSERT_FALSE(result.collidedVertically);
+}
+
+TEST_F(TileMapCollisionTest, sweep_towardsWall_shouldStopAtWall)
+{
+    const auto result = tileMap.sweep({1, 1, 2, 2}, {20, 0});
+
+    ASSERT_EQ(result.displacement, (utils::Vector2f{9, 0}));
+    ASSERT_TRUE(result.collidedHorizontally);
+}
+
+TEST_F(TileMapCollisionTest, sweep_fallingOntoFloor_shouldStopOnFloor)
+{
+    const auto result = tileMap.sweep({1, 1, 2, 2}, {1, 30});
+
+    ASSERT_EQ(result.displacement, (utils::Vector2f{1, 11}));
+    ASSERT_FALSE(result.collidedHorizontally);
+    ASSERT_TRUE(result.collidedVertically);
+}
+
+TEST_F(TileMapCollisionTest, sweep_movingLeftFromWall_shouldStopAtWallRightSide)
+{
+    const auto result = tileMap.sweep({15, 2, 2, 2}, {-10, 0});
+
+    ASSERT_EQ(result.displacement, (utils::Vector2f{-1, 0}));
+    ASSERT_TRUE(result.collidedHorizontally);
+}
+
+TEST_F(TileMapCollisionTest, raycast_horizontalRayHittingWall_shouldReturnHitOnWallFace)
+{
+    const auto hit = tileMap.raycast({1, 5}, {1, 0}, 100);
+
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(hit->tilePosition, (utils::Vector2i{6, 2}));
+    ASSERT_EQ(hit->point, (utils::Vector2f{12, 5}));
+    ASSERT_EQ(hit->normal, (utils::Vector2f{-1, 0}));
+    ASSERT_FLOAT_EQ(hit->distance, 11);
+}
+
+TEST_F(TileMapCollisionTest, raycast_downwardRay_shouldHitFloorWithUpNormal)
+{
+    const auto hit = tileMap.raycast({3, 1}, {0, 5}, 100);
+
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(hit->tilePosition, (utils::Vector2i{1, 7}));
+    ASSERT_EQ(hit->normal, (utils::Vector2f{0, -1}));
+    ASSERT_FLOAT_EQ(hit->distance, 13);
+}
+
+TEST_F(TileMapCollisionTest, raycast_rayShorterThanDistanceToWall_shouldNotHit)
+{
+    ASSERT_FALSE(tileMap.raycast({1, 5}, {1, 0}, 10));
+}
+
+TEST_F(TileMapCollisionTest, raycast_rayLeavingMap_shouldNotHit)
+{
+    ASSERT_FALSE(tileMap.raycast({1, 5}, {-1, -1}, 1000));
+}
+
+TEST_F(TileMapCollisionTest, raycast_diagonalRay_shouldHitFirstSolidCellOnItsPath)
+{
+    const auto hit = tileMap.raycast({1, 1}, {1, 1}, 100);
+
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(hit->tilePosition, (utils::Vector2i{6, 6}));
+}
+
+TEST_F(TileMapCollisionTest, raycast_fromInsideSolidTile_shouldHitImmediately)
+{
+    const auto hit = tileMap.raycast({13, 3}, {1, 0}, 100);
+
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(hit->distance, 0);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+
+namespace game
+{
+struct TileRun
+{
+    std::size_t firstTileIndex;
+    std::size_t length;
+    int previousValue;
+    int newValue;
+};
+
+inline bool operator==(const TileRun& lhs, const TileRun& rhs)
+{
+    return lhs.firstTileIndex == rhs.firstTileIndex && lhs.length == rhs.length &&
+           lhs.previousValue == rhs.previousValue && lhs.newValue == rhs.newValue;
+}
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdexcept>
+
+namespace game::exceptions
+{
+struct TileTexturesNotInitialized : std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
+}
\ No newline at end of file
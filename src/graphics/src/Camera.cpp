@@ -0,0 +1,105 @@
+#include "Camera.h"
+
+#include <algorithm>
+#include <string>
+
+#include "exceptions/InvalidCameraZoom.h"
+
+namespace graphics
+{
+namespace
+{
+float clampAxis(float center, float halfSize, float boundsStart, float boundsSize)
+{
+    if (2 * halfSize >= boundsSize)
+    {
+        return boundsStart + boundsSize / 2;
+    }
+    return std::clamp(center, boundsStart + halfSize, boundsStart + boundsSize - halfSize);
+}
+}
+
+Camera::Camera(const utils::Vector2f& viewSizeInit)
+    : viewSize{viewSizeInit}, center{viewSizeInit.x / 2, viewSizeInit.y / 2}, zoom{1.f}
+{
+}
+
+void Camera::setCenter(const utils::Vector2f& centerInit)
+{
+    center = centerInit;
+    clampCenterToBounds();
+}
+
+void Camera::move(const utils::Vector2f& offset)
+{
+    setCenter(center + offset);
+}
+
+utils::Vector2f Camera::getCenter() const
+{
+    return center;
+}
+
+void Camera::setZoom(float zoomInit)
+{
+    if (zoomInit <= 0)
+    {
+        throw exceptions::InvalidCameraZoom{"Camera zoom must be positive, got: " + std::to_string(zoomInit)};
+    }
+
+    zoom = zoomInit;
+    clampCenterToBounds();
+}
+
+float Camera::getZoom() const
+{
+    return zoom;
+}
+
+void Camera::setBounds(const utils::FloatRect& boundsInit)
+{
+    bounds = boundsInit;
+    clampCenterToBounds();
+}
+
+void Camera::removeBounds()
+{
+    bounds = boost::none;
+}
+
+utils::Vector2f Camera::getSize() const
+{
+    return viewSize * zoom;
+}
+
+utils::FloatRect Camera::getVisibleArea() const
+{
+    const auto size = getSize();
+    return {center - size / 2.f, size};
+}
+
+bool Camera::isVisible(const utils::FloatRect& area) const
+{
+    return getVisibleArea().intersects(area);
+}
+
+void Camera::reset()
+{
+    zoom = 1.f;
+    bounds = boost::none;
+    center = viewSize / 2.f;
+}
+
+void Camera::clampCenterToBounds()
+{
+    if (not bounds)
+    {
+        return;
+    }
+
+    const auto halfSize = getSize() / 2.f;
+    center.x = clampAxis(center.x, halfSize.x, bounds->left, bounds->width);
+    center.y = clampAxis(center.y, halfSize.y, bounds->top, bounds->height);
+}
+
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "Rect.h"
+#include "Vector.h"
+
+namespace graphics
+{
+class Camera
+{
+public:
+    explicit Camera(const utils::Vector2f& viewSize);
+
+    void setCenter(const utils::Vector2f&);
+    void move(const utils::Vector2f& offset);
+    utils::Vector2f getCenter() const;
+    void setZoom(float zoom);
+    float getZoom() const;
+    void setBounds(const utils::FloatRect&);
+    void removeBounds();
+    utils::Vector2f getSize() const;
+    utils::FloatRect getVisibleArea() const;
+    bool isVisible(const utils::FloatRect&) const;
+    void reset();
+
+private:
+    void clampCenterToBounds();
+
+    const utils::Vector2f viewSize;
+    utils::Vector2f center;
+    float zoom;
+    boost::optional<utils::FloatRect> bounds;
+};
+}
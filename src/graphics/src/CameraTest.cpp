@@ -0,0 +1,110 @@
+#include "Camera.h"
+
+#include "gtest/gtest.h"
+
+#include "exceptions/InvalidCameraZoom.h"
+
+using namespace ::testing;
+using namespace graphics;
+
+namespace
+{
+const utils::Vector2f viewSize{80, 60};
+const utils::Vector2f defaultCenter{40, 30};
+const utils::FloatRect levelBounds{0, 0, 400, 120};
+}
+
+class CameraTest : public Test
+{
+public:
+    Camera camera{viewSize};
+};
+
+TEST_F(CameraTest, byDefault_shouldShowAreaOfViewSizeFromOrigin)
+{
+    ASSERT_EQ(camera.getCenter(), defaultCenter);
+    ASSERT_EQ(camera.getSize(), viewSize);
+    ASSERT_EQ(camera.getVisibleArea(), (utils::FloatRect{0, 0, 80, 60}));
+}
+
+TEST_F(CameraTest, setCenter_withoutBounds_shouldMoveVisibleArea)
+{
+    camera.setCenter({-100, 200});
+
+    ASSERT_EQ(camera.getVisibleArea(), (utils::FloatRect{-140, 170, 80, 60}));
+}
+
+TEST_F(CameraTest, move_shouldOffsetCenter)
+{
+    camera.move({10, -5});
+
+    ASSERT_EQ(camera.getCenter(), (utils::Vector2f{50, 25}));
+}
+
+TEST_F(CameraTest, setCenter_withBounds_shouldClampVisibleAreaToBounds)
+{
+    camera.setBounds(levelBounds);
+
+    camera.setCenter({1000, -1000});
+
+    ASSERT_EQ(camera.getVisibleArea(), (utils::FloatRect{320, 0, 80, 60}));
+}
+
+TEST_F(CameraTest, setCenter_withBoundsSmallerThanView_shouldCenterOnBounds)
+{
+    camera.setBounds({0, 0, 40, 30});
+
+    camera.setCenter({100, 100});
+
+    ASSERT_EQ(camera.getCenter(), (utils::Vector2f{20, 15}));
+}
+
+TEST_F(CameraTest, removeBounds_shouldAllowLeavingPreviousBounds)
+{
+    camera.setBounds(levelBounds);
+    camera.removeBounds();
+
+    camera.setCenter({1000, -1000});
+
+    ASSERT_EQ(camera.getCenter(), (utils::Vector2f{1000, -1000}));
+}
+
+TEST_F(CameraTest, setZoom_shouldScaleVisibleAreaAroundCenter)
+{
+    camera.setZoom(2);
+
+    ASSERT_EQ(camera.getZoom(), 2);
+    ASSERT_EQ(camera.getVisibleArea(), (utils::FloatRect{-40, -30, 160, 120}));
+}
+
+TEST_F(CameraTest, setZoom_withBounds_shouldClampEnlargedArea)
+{
+    camera.setBounds(levelBounds);
+
+    camera.setZoom(1.5);
+
+    ASSERT_EQ(camera.getVisibleArea(), (utils::FloatRect{0, 0, 120, 90}));
+}
+
+TEST_F(CameraTest, givenNonPositiveZoom_shouldThrowInvalidCameraZoom)
+{
+    ASSERT_THROW(camera.setZoom(0), exceptions::InvalidCameraZoom);
+}
+
+TEST_F(CameraTest, isVisible_shouldReturnTrueOnlyForAreasIntersectingVisibleArea)
+{
+    ASSERT_TRUE(camera.isVisible({70, 50, 20, 20}));
+    ASSERT_FALSE(camera.isVisible({80, 0, 10, 10}));
+}
+
+TEST_F(CameraTest, reset_shouldRestoreDefaultView)
+{
+    camera.setBounds(levelBounds);
+    camera.setZoom(0.5);
+    camera.setCenter({200, 100});
+
+    camera.reset();
+
+    ASSERT_EQ(camera.getCenter(), defaultCenter);
+    ASSERT_EQ(camera.getZoom(), 1);
+}
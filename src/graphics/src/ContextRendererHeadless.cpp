@@ -0,0 +1,54 @@
+#include "ContextRendererHeadless.h"
+
+namespace graphics
+{
+
+ContextRendererHeadless::ContextRendererHeadless(const utils::Vector2u& viewSizeInit)
+    : viewSize{viewSizeInit}, numberOfClears{0}, numberOfDrawCallsSinceClear{0}, totalNumberOfDrawCalls{0}
+{
+}
+
+void ContextRendererHeadless::initialize() {}
+
+void ContextRendererHeadless::clear(const Color&)
+{
+    numberOfClears++;
+    numberOfDrawCallsSinceClear = 0;
+}
+
+void ContextRendererHeadless::draw(const sf::Drawable&)
+{
+    numberOfDrawCallsSinceClear++;
+    totalNumberOfDrawCalls++;
+}
+
+void ContextRendererHeadless::setView() {}
+
+void ContextRendererHeadless::setViewSize(const utils::Vector2u& size)
+{
+    viewSize = size;
+}
+
+void ContextRendererHeadless::synchronizeViewSize() {}
+
+std::size_t ContextRendererHeadless::getNumberOfClears() const
+{
+    return numberOfClears;
+}
+
+std::size_t ContextRendererHeadless::getNumberOfDrawCallsSinceClear() const
+{
+    return numberOfDrawCallsSinceClear;
+}
+
+std::size_t ContextRendererHeadless::getTotalNumberOfDrawCalls() const
+{
+    return totalNumberOfDrawCalls;
+}
+
+utils::Vector2u ContextRendererHeadless::getViewSize() const
+{
+    return viewSize;
+}
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "ContextRenderer.h"
+
+namespace graphics
+{
+class ContextRendererHeadless : public ContextRenderer
+{
+public:
+    explicit ContextRendererHeadless(const utils::Vector2u& viewSize);
+
+    void initialize() override;
+    void clear(const Color&) override;
+    void draw(const sf::Drawable&) override;
+    void setView() override;
+    void setViewSize(const utils::Vector2u& windowsSize) override;
+    void synchronizeViewSize() override;
+    std::size_t getNumberOfClears() const;
+    std::size_t getNumberOfDrawCallsSinceClear() const;
+    std::size_t getTotalNumberOfDrawCalls() const;
+    utils::Vector2u getViewSize() const;
+
+private:
+    utils::Vector2u viewSize;
+    std::size_t numberOfClears;
+    std::size_t numberOfDrawCallsSinceClear;
+    std::size_t totalNumberOfDrawCalls;
+};
+}
@@ -0,0 +1,42 @@
+#include "ContextRendererHeadless.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace graphics;
+
+class ContextRendererHeadlessTest : public Test
+{
+public:
+    const utils::Vector2u viewSize{800, 600};
+    const sf::RectangleShape shape;
+    ContextRendererHeadless contextRenderer{viewSize};
+};
+
+TEST_F(ContextRendererHeadlessTest, draw_shouldCountDrawCalls)
+{
+    contextRenderer.draw(shape);
+    contextRenderer.draw(shape);
+
+    ASSERT_EQ(contextRenderer.getNumberOfDrawCallsSinceClear(), 2u);
+    ASSERT_EQ(contextRenderer.getTotalNumberOfDrawCalls(), 2u);
+}
+
+TEST_F(ContextRendererHeadlessTest, clear_shouldResetDrawCallsSinceClear)
+{
+    contextRenderer.draw(shape);
+
+    contextRenderer.clear(sf::Color::White);
+    contextRenderer.draw(shape);
+
+    ASSERT_EQ(contextRenderer.getNumberOfClears(), 1u);
+    ASSERT_EQ(contextRenderer.getNumberOfDrawCallsSinceClear(), 1u);
+    ASSERT_EQ(contextRenderer.getTotalNumberOfDrawCalls(), 2u);
+}
+
+TEST_F(ContextRendererHeadlessTest, setViewSize_shouldChangeViewSize)
+{
+    contextRenderer.setViewSize({1024, 768});
+
+    ASSERT_EQ(contextRenderer.getViewSize(), (utils::Vector2u{1024, 768}));
+}
@@ -1,5 +1,6 @@
 #include "DefaultGraphicsFactory.h"
 
+#include "Camera.h"
 #include "FontStorageSfml.h"
 #include "RenderTargetSfml.h"
 #include "RendererPoolSfml.h"
@@ -13,9 +14,11 @@ DefaultGraphicsFactory::createRendererPool(std::shared_ptr<window::Window> windo
                                            const utils::Vector2u& renderingRegionSize,
                                            const utils::Vector2u& logicalRegionSize) const
 {
+    const auto camera = std::make_shared<Camera>(utils::Vector2f{static_cast<float>(logicalRegionSize.x),
+                                                                 static_cast<float>(logicalRegionSize.y)});
     return std::make_unique<RendererPoolSfml>(
-        std::make_unique<RenderTargetSfml>(window, renderingRegionSize, logicalRegionSize),
-        std::make_unique<TextureStorageSfml>(), std::make_unique<FontStorageSfml>());
+        std::make_unique<RenderTargetSfml>(window, renderingRegionSize, camera),
+        std::make_unique<TextureStorageSfml>(), std::make_unique<FontStorageSfml>(), camera);
 }
 
 }
\ No newline at end of file
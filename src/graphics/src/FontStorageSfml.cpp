@@ -3,6 +3,8 @@
 #include <iostream>
 
 #include "FontLoader.h"
+#include "AllocationTracker.h"
+#include "FrameProfiler.h"
 #include "exceptions/CannotAccessFontFile.h"
 #include "exceptions/FontNotAvailable.h"
 
@@ -20,6 +22,8 @@ const sf::Font& FontStorageSfml::getFont(const FontPath& path)
 
 void FontStorageSfml::loadFont(const FontPath& path)
 {
+    PROFILE_ZONE("FontStorageSfml::loadFont");
+    ALLOCATION_TAG(Graphics);
     auto font = std::make_unique<sf::Font>();
     try
     {
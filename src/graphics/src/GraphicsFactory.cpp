@@ -1,6 +1,7 @@
 #include "GraphicsFactory.h"
 
 #include "DefaultGraphicsFactory.h"
+#include "HeadlessGraphicsFactory.h"
 
 namespace graphics
 {
@@ -9,4 +10,9 @@ std::unique_ptr<GraphicsFactory> GraphicsFactory::createGraphicsFactory()
 {
     return std::make_unique<DefaultGraphicsFactory>();
 }
+
+std::unique_ptr<GraphicsFactory> GraphicsFactory::createHeadlessGraphicsFactory()
+{
+    return std::make_unique<HeadlessGraphicsFactory>();
+}
 }
\ No newline at end of file
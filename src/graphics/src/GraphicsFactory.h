@@ -17,5 +17,6 @@ public:
                        const utils::Vector2u& logicalRegionSize) const = 0;
 
     static std::unique_ptr<GraphicsFactory> createGraphicsFactory();
+    static std::unique_ptr<GraphicsFactory> createHeadlessGraphicsFactory();
 };
 }
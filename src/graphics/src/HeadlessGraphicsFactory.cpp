@@ -0,0 +1,24 @@
+#include "HeadlessGraphicsFactory.h"
+
+#include "Camera.h"
+#include "ContextRendererHeadless.h"
+#include "FontStorageSfml.h"
+#include "RendererPoolSfml.h"
+#include "TextureStorageHeadless.h"
+
+namespace graphics
+{
+
+std::unique_ptr<RendererPool>
+HeadlessGraphicsFactory::createRendererPool(std::shared_ptr<window::Window>,
+                                            const utils::Vector2u& renderingRegionSize,
+                                            const utils::Vector2u& logicalRegionSize) const
+{
+    const auto camera = std::make_shared<Camera>(utils::Vector2f{static_cast<float>(logicalRegionSize.x),
+                                                                 static_cast<float>(logicalRegionSize.y)});
+    return std::make_unique<RendererPoolSfml>(std::make_unique<ContextRendererHeadless>(renderingRegionSize),
+                                              std::make_unique<TextureStorageHeadless>(),
+                                              std::make_unique<FontStorageSfml>(), camera);
+}
+
+}
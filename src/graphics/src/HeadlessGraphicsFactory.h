@@ -0,0 +1,16 @@
+#pragma once
+
+#include <memory>
+
+#include "GraphicsFactory.h"
+
+namespace graphics
+{
+class HeadlessGraphicsFactory : public GraphicsFactory
+{
+public:
+    std::unique_ptr<RendererPool> createRendererPool(std::shared_ptr<window::Window> window,
+                                                     const utils::Vector2u& renderingRegionSize,
+                                                     const utils::Vector2u& logicalRegionSize) const override;
+};
+}
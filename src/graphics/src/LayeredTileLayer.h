@@ -0,0 +1,18 @@
+#pragma once
+
+#include "TileLayer.h"
+#include "VisibilityLayer.h"
+
+namespace graphics
+{
+struct LayeredTileLayer
+{
+    VisibilityLayer layer;
+    TileLayer tileLayer;
+};
+
+inline bool operator<(const LayeredTileLayer& lhs, const LayeredTileLayer& rhs)
+{
+    return lhs.layer > rhs.layer;
+}
+}
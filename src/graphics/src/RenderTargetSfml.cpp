@@ -10,8 +10,8 @@ sf::View getLetterboxView(sf::View view, unsigned windowWidth, unsigned windowHe
 }
 
 RenderTargetSfml::RenderTargetSfml(std::shared_ptr<window::Window> windowInit,
-                                   const utils::Vector2u& windowSizeInit, const utils::Vector2u& areaSizeInit)
-    : window{std::move(windowInit)}, windowSize{windowSizeInit}, areaSize{areaSizeInit}
+                                   const utils::Vector2u& windowSizeInit, std::shared_ptr<Camera> cameraInit)
+    : window{std::move(windowInit)}, windowSize{windowSizeInit}, camera{std::move(cameraInit)}
 {
 }
 
@@ -32,8 +32,8 @@ void RenderTargetSfml::draw(const sf::Drawable& drawable)
 
 void RenderTargetSfml::setView()
 {
-    view.setSize(boost::numeric_cast<float>(areaSize.x), boost::numeric_cast<float>(areaSize.y));
-    view.setCenter(view.getSize().x / 2, view.getSize().y / 2);
+    view.setSize(camera->getSize());
+    view.setCenter(camera->getCenter());
     view = getLetterboxView(view, windowSize.x, windowSize.y);
     window->setView(view);
 
@@ -4,6 +4,7 @@
 #include <SFML/Graphics/View.hpp>
 #include <memory>
 
+#include "Camera.h"
 #include "ContextRenderer.h"
 #include "Vector.h"
 #include "Window.h"
@@ -15,7 +16,7 @@ class RenderTargetSfml : public ContextRenderer, public sf::RenderTarget
 {
 public:
     RenderTargetSfml(std::shared_ptr<window::Window>, const utils::Vector2u& windowSize,
-                     const utils::Vector2u& areaSize);
+                     std::shared_ptr<Camera>);
 
     void initialize() override;
     void clear(const Color&) override;
@@ -29,7 +30,7 @@ public:
 private:
     std::shared_ptr<window::Window> window;
     utils::Vector2u windowSize;
-    const utils::Vector2u areaSize;
+    std::shared_ptr<Camera> camera;
     sf::View view;
 };
 
@@ -1,11 +1,17 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include "Camera.h"
 #include "Color.h"
 #include "FontPath.h"
 #include "GraphicsId.h"
+#include "Rect.h"
+#include "RendererPoolStatistics.h"
+#include "TextureHandle.h"
 #include "TexturePath.h"
 #include "Vector.h"
 #include "VisibilityLayer.h"
@@ -24,17 +30,32 @@ public:
     virtual GraphicsId acquireText(const utils::Vector2f& position, const std::string& text, const FontPath&,
                                    unsigned characterSize = 13, VisibilityLayer = VisibilityLayer::First,
                                    const Color& = Color::Black) = 0;
+    virtual GraphicsId acquireTileLayer(const utils::Vector2f& position, const utils::Vector2i& sizeInTiles,
+                                        const utils::Vector2f& tileSize,
+                                        const std::vector<TexturePath>& tileTexturePaths,
+                                        VisibilityLayer = VisibilityLayer::Second) = 0;
     virtual void release(const GraphicsId&) = 0;
     virtual void renderAll() = 0;
     virtual void setPosition(const GraphicsId&, const utils::Vector2f& position) = 0;
+    virtual void setSize(const GraphicsId&, const utils::Vector2f& size) = 0;
     virtual boost::optional<utils::Vector2f> getPosition(const GraphicsId&) = 0;
     // TODO: remove scale
     virtual void setTexture(const GraphicsId&, const TexturePath&, const utils::Vector2f& scale = {1, 1}) = 0;
+    virtual void setTexture(const GraphicsId&, TextureHandle, const utils::Vector2f& scale = {1, 1}) = 0;
+    virtual void setTexture(const GraphicsId&, TextureHandle, const utils::IntRect& textureRect,
+                            const utils::Vector2f& scale = {1, 1}) = 0;
+    virtual TextureHandle getTextureHandle(const TexturePath&) = 0;
+    virtual bool reloadTexture(const TexturePath&) = 0;
     virtual void setText(const GraphicsId&, const std::string& text) = 0;
     virtual void setVisibility(const GraphicsId&, VisibilityLayer) = 0;
     virtual void setColor(const GraphicsId&, const Color&) = 0;
     virtual void setOutline(const GraphicsId&, float thickness, const Color&) = 0;
+    virtual void setTiles(const GraphicsId&, const std::vector<int>& tiles) = 0;
+    virtual void setTiles(const GraphicsId&, std::size_t firstTileIndex, std::size_t numberOfTiles,
+                          int tile) = 0;
     virtual void setRenderingSize(const utils::Vector2u&) = 0;
     virtual void synchronizeRenderingSize() = 0;
+    virtual std::shared_ptr<Camera> getCamera() const = 0;
+    virtual RendererPoolStatistics getStatistics() const = 0;
 };
 }
\ No newline at end of file
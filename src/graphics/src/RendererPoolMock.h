@@ -18,16 +18,30 @@ public:
     MOCK_METHOD(GraphicsId, acquireText,
                 (const utils::Vector2f& position, const std::string& text, const FontPath&,
                  unsigned characterSize, VisibilityLayer, const Color&));
+    MOCK_METHOD(GraphicsId, acquireTileLayer,
+                (const utils::Vector2f& position, const utils::Vector2i& sizeInTiles,
+                 const utils::Vector2f& tileSize, const std::vector<TexturePath>& tileTexturePaths,
+                 VisibilityLayer));
     MOCK_METHOD(void, release, (const GraphicsId&));
     MOCK_METHOD(void, renderAll, ());
     MOCK_METHOD(void, setPosition, (const GraphicsId&, const utils::Vector2f&));
+    MOCK_METHOD(void, setSize, (const GraphicsId&, const utils::Vector2f&));
     MOCK_METHOD(boost::optional<utils::Vector2f>, getPosition, (const GraphicsId&));
     MOCK_METHOD(void, setTexture, (const GraphicsId&, const TexturePath&, const utils::Vector2f&));
+    MOCK_METHOD(void, setTexture, (const GraphicsId&, TextureHandle, const utils::Vector2f&));
+    MOCK_METHOD(void, setTexture,
+                (const GraphicsId&, TextureHandle, const utils::IntRect&, const utils::Vector2f&));
+    MOCK_METHOD(TextureHandle, getTextureHandle, (const TexturePath&));
+    MOCK_METHOD(bool, reloadTexture, (const TexturePath&));
     MOCK_METHOD(void, setText, (const GraphicsId&, const std::string&));
     MOCK_METHOD(void, setVisibility, (const GraphicsId&, VisibilityLayer));
     MOCK_METHOD(void, setColor, (const GraphicsId&, const Color&));
     MOCK_METHOD(void, setOutline, (const GraphicsId&, float, const Color&));
+    MOCK_METHOD(void, setTiles, (const GraphicsId&, const std::vector<int>&));
+    MOCK_METHOD(void, setTiles, (const GraphicsId&, std::size_t, std::size_t, int));
     MOCK_METHOD(void, setRenderingSize, (const utils::Vector2u&));
     MOCK_METHOD(void, synchronizeRenderingSize, ());
+    MOCK_METHOD(std::shared_ptr<Camera>, getCamera, (), (const));
+    MOCK_METHOD(RendererPoolStatistics, getStatistics, (), (const));
 };
 }
\ No newline at end of file
@@ -1,13 +1,18 @@
 #include "RendererPoolSfml.h"
 
+#include <algorithm>
 #include <iostream>
 
+#include "AllocationTracker.h"
+#include "FrameProfiler.h"
 #include "GraphicsIdGenerator.h"
 
 namespace graphics
 {
 namespace
 {
+const auto graphicsObjectsToRemoveInitialCapacity{256u};
+
 static auto& getLayeredShapeByPosition(std::vector<LayeredShape>& shapes,
                                        std::vector<LayeredShape>::const_iterator position)
 {
@@ -39,11 +44,14 @@ static auto& getLayeredTextByPosition(const std::vector<LayeredText>& layeredTex
 
 RendererPoolSfml::RendererPoolSfml(std::unique_ptr<ContextRenderer> contextRendererInit,
                                    std::unique_ptr<TextureStorage> textureStorageInit,
-                                   std::unique_ptr<FontStorage> fontStorageInit)
+                                   std::unique_ptr<FontStorage> fontStorageInit,
+                                   std::shared_ptr<Camera> cameraInit)
     : contextRenderer{std::move(contextRendererInit)},
       textureStorage{std::move(textureStorageInit)},
-      fontStorage{std::move(fontStorageInit)}
+      fontStorage{std::move(fontStorageInit)},
+      camera{std::move(cameraInit)}
 {
+    graphicsObjectsToRemove.reserve(graphicsObjectsToRemoveInitialCapacity);
     contextRenderer->initialize();
     contextRenderer->setView();
 }
@@ -51,6 +59,7 @@ RendererPoolSfml::RendererPoolSfml(std::unique_ptr<ContextRenderer> contextRende
 GraphicsId RendererPoolSfml::acquire(const utils::Vector2f& size, const utils::Vector2f& position,
                                      const Color& color, VisibilityLayer layer)
 {
+    ALLOCATION_TAG(Graphics);
     auto id = GraphicsIdGenerator::generateId();
     auto layeredShape = LayeredShape{layer, RectangleShape{id, size, position, color}};
     layeredShapes.insert(upper_bound(layeredShapes.begin(), layeredShapes.end(), layeredShape), layeredShape);
@@ -69,6 +78,7 @@ GraphicsId RendererPoolSfml::acquireText(const utils::Vector2f& position, const
                                          const FontPath& fontPath, unsigned characterSize,
                                          VisibilityLayer layer, const Color& color)
 {
+    ALLOCATION_TAG(Graphics);
     auto id = GraphicsIdGenerator::generateId();
     const auto& font = fontStorage->getFont(fontPath);
     auto layeredText = LayeredText{layer, Text{id, position, text, font, characterSize, color}};
@@ -76,14 +86,40 @@ GraphicsId RendererPoolSfml::acquireText(const utils::Vector2f& position, const
     return id;
 }
 
+GraphicsId RendererPoolSfml::acquireTileLayer(const utils::Vector2f& position,
+                                              const utils::Vector2i& sizeInTiles,
+                                              const utils::Vector2f& tileSize,
+                                              const std::vector<TexturePath>& tileTexturePaths,
+                                              VisibilityLayer layer)
+{
+    ALLOCATION_TAG(Graphics);
+    auto id = GraphicsIdGenerator::generateId();
+    std::vector<const sf::Texture*> tileTextures;
+    for (const auto& tileTexturePath : tileTexturePaths)
+    {
+        tileTextures.push_back(&textureStorage->getTexture(tileTexturePath));
+    }
+    auto layeredTileLayer =
+        LayeredTileLayer{layer, TileLayer{id, position, sizeInTiles, tileSize, std::move(tileTextures)}};
+    const auto insertPosition =
+        upper_bound(layeredTileLayers.begin(), layeredTileLayers.end(), layeredTileLayer);
+    layeredTileLayers.insert(insertPosition, std::move(layeredTileLayer));
+    return id;
+}
+
 void RendererPoolSfml::release(const GraphicsId& id)
 {
-    graphicsObjectsToRemove.insert(id);
+    ALLOCATION_TAG(Graphics);
+    graphicsObjectsToRemove.push_back(id);
 }
 
 void RendererPoolSfml::renderAll()
 {
+    PROFILE_ZONE("RendererPoolSfml::renderAll");
+    ALLOCATION_TAG(Graphics);
     contextRenderer->clear(sf::Color::White);
+    drawCalls = 0;
+    batches = 0;
 
     if (not graphicsObjectsToRemove.empty())
     {
@@ -92,19 +128,45 @@ void RendererPoolSfml::renderAll()
 
     contextRenderer->setView();
 
+    const auto visibleArea = camera->getVisibleArea();
+    auto layeredTileLayer = layeredTileLayers.begin();
+
+    const auto drawTileLayersUpTo = [&](VisibilityLayer layer) {
+        for (; layeredTileLayer != layeredTileLayers.end() && layeredTileLayer->layer >= layer;
+             layeredTileLayer++)
+        {
+            if (layeredTileLayer->layer != VisibilityLayer::Invisible)
+            {
+                layeredTileLayer->tileLayer.updateVisibleArea(visibleArea);
+                contextRenderer->draw(layeredTileLayer->tileLayer);
+                drawCalls++;
+                batches += layeredTileLayer->tileLayer.getNumberOfBatches();
+            }
+        }
+    };
+
     for (const auto& layeredShape : layeredShapes)
     {
-        if (layeredShape.layer != VisibilityLayer::Invisible)
+        drawTileLayersUpTo(layeredShape.layer);
+
+        if (layeredShape.layer != VisibilityLayer::Invisible &&
+            visibleArea.intersects(layeredShape.shape.getGlobalBounds()))
         {
             contextRenderer->draw(layeredShape.shape);
+            drawCalls++;
+            batches++;
         }
     }
 
+    drawTileLayersUpTo(VisibilityLayer::First);
+
     for (const auto& layeredText : layeredTexts)
     {
         if (layeredText.layer != VisibilityLayer::Invisible)
         {
             contextRenderer->draw(layeredText.text);
+            drawCalls++;
+            batches++;
         }
     }
 }
@@ -125,6 +187,15 @@ void RendererPoolSfml::setPosition(const GraphicsId& id, const utils::Vector2f&
     }
 }
 
+void RendererPoolSfml::setSize(const GraphicsId& id, const utils::Vector2f& size)
+{
+    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    {
+        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
+        layeredShape.shape.setSize(size);
+    }
+}
+
 boost::optional<utils::Vector2f> RendererPoolSfml::getPosition(const GraphicsId& id)
 {
     if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
@@ -147,26 +218,54 @@ void RendererPoolSfml::setTexture(const GraphicsId& id, const TexturePath& path,
     if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
     {
         auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
-        const sf::Texture& texture = textureStorage->getTexture(path);
-        layeredShape.shape.setTexture(&texture);
-        layeredShape.shape.setScale(scale);
-        if (scale.x < 0)
-        {
-            layeredShape.shape.setOrigin(layeredShape.shape.getGlobalBounds().width / (-scale.x), 0);
-        }
-        else
-        {
-            layeredShape.shape.setOrigin(0, 0);
-        }
+        setShapeTexture(layeredShape.shape, textureStorage->getTexture(path), scale);
+    }
+}
+
+void RendererPoolSfml::setTexture(const GraphicsId& id, TextureHandle textureHandle,
+                                  const utils::Vector2f& scale)
+{
+    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    {
+        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
+        setShapeTexture(layeredShape.shape, textureStorage->getTexture(textureHandle), scale);
+    }
+}
+
+void RendererPoolSfml::setTexture(const GraphicsId& id, TextureHandle textureHandle,
+                                  const utils::IntRect& textureRect, const utils::Vector2f& scale)
+{
+    if (const auto layeredShapeIter = findLayeredShapePosition(id); layeredShapeIter != layeredShapes.end())
+    {
+        auto& layeredShape = getLayeredShapeByPosition(layeredShapes, layeredShapeIter);
+        setShapeTexture(layeredShape.shape, textureStorage->getTexture(textureHandle), scale);
+        layeredShape.shape.setTextureRect(textureRect);
     }
 }
 
+TextureHandle RendererPoolSfml::getTextureHandle(const TexturePath& path)
+{
+    return textureStorage->getTextureHandle(path);
+}
+
+bool RendererPoolSfml::reloadTexture(const TexturePath& path)
+{
+    return textureStorage->reloadTexture(path);
+}
+
 void RendererPoolSfml::setText(const GraphicsId& id, const std::string& text)
 {
+    ALLOCATION_TAG(Graphics);
     if (const auto layeredTextIter = findLayeredTextPosition(id); layeredTextIter != layeredTexts.end())
     {
+        // Converting through a reused sf::String keeps its storage instead of allocating a temporary
+        textBuffer.clear();
+        for (const auto character : text)
+        {
+            textBuffer += sf::String{static_cast<sf::Uint32>(static_cast<unsigned char>(character))};
+        }
         auto& layeredText = getLayeredTextByPosition(layeredTexts, layeredTextIter);
-        layeredText.text.setString(text);
+        layeredText.text.setString(textBuffer);
     }
 }
 
@@ -225,6 +324,27 @@ void RendererPoolSfml::setOutline(const GraphicsId& id, float thickness, const C
     }
 }
 
+void RendererPoolSfml::setTiles(const GraphicsId& id, const std::vector<int>& tiles)
+{
+    ALLOCATION_TAG(Graphics);
+    if (const auto layeredTileLayerIter = findLayeredTileLayerPosition(id);
+        layeredTileLayerIter != layeredTileLayers.end())
+    {
+        layeredTileLayerIter->tileLayer.setTiles(tiles);
+    }
+}
+
+void RendererPoolSfml::setTiles(const GraphicsId& id, std::size_t firstTileIndex, std::size_t numberOfTiles,
+                                int tile)
+{
+    ALLOCATION_TAG(Graphics);
+    if (const auto layeredTileLayerIter = findLayeredTileLayerPosition(id);
+        layeredTileLayerIter != layeredTileLayers.end())
+    {
+        layeredTileLayerIter->tileLayer.setTiles(firstTileIndex, numberOfTiles, tile);
+    }
+}
+
 void RendererPoolSfml::setRenderingSize(const utils::Vector2u& renderingSize)
 {
     contextRenderer->setViewSize(renderingSize);
@@ -235,25 +355,67 @@ void RendererPoolSfml::synchronizeRenderingSize()
     contextRenderer->synchronizeViewSize();
 }
 
+std::shared_ptr<Camera> RendererPoolSfml::getCamera() const
+{
+    return camera;
+}
+
+RendererPoolStatistics RendererPoolSfml::getStatistics() const
+{
+    return {drawCalls,
+            batches,
+            layeredShapes.size(),
+            layeredTexts.size(),
+            layeredTileLayers.size(),
+            textureStorage->getTextureMemoryInBytes()};
+}
+
 void RendererPoolSfml::cleanUnusedShapes()
 {
+    std::sort(graphicsObjectsToRemove.begin(), graphicsObjectsToRemove.end());
+
     layeredShapes.erase(std::remove_if(layeredShapes.begin(), layeredShapes.end(),
                                        [&](const LayeredShape& layeredShape) {
-                                           return graphicsObjectsToRemove.count(
-                                               layeredShape.shape.getGraphicsId());
+                                           return isScheduledForRemoval(layeredShape.shape.getGraphicsId());
                                        }),
                         layeredShapes.end());
 
     layeredTexts.erase(std::remove_if(layeredTexts.begin(), layeredTexts.end(),
                                       [&](const LayeredText& layeredText) {
-                                          return graphicsObjectsToRemove.count(
-                                              layeredText.text.getGraphicsId());
+                                          return isScheduledForRemoval(layeredText.text.getGraphicsId());
                                       }),
                        layeredTexts.end());
 
+    layeredTileLayers.erase(std::remove_if(layeredTileLayers.begin(), layeredTileLayers.end(),
+                                           [&](const LayeredTileLayer& layeredTileLayer) {
+                                               return isScheduledForRemoval(
+                                                   layeredTileLayer.tileLayer.getGraphicsId());
+                                           }),
+                            layeredTileLayers.end());
+
     graphicsObjectsToRemove.clear();
 }
 
+bool RendererPoolSfml::isScheduledForRemoval(const GraphicsId& id) const
+{
+    return std::binary_search(graphicsObjectsToRemove.begin(), graphicsObjectsToRemove.end(), id);
+}
+
+void RendererPoolSfml::setShapeTexture(RectangleShape& shape, const sf::Texture& texture,
+                                       const utils::Vector2f& scale)
+{
+    shape.setTexture(&texture, true);
+    shape.setScale(scale);
+    if (scale.x < 0)
+    {
+        shape.setOrigin(shape.getGlobalBounds().width / (-scale.x), 0);
+    }
+    else
+    {
+        shape.setOrigin(0, 0);
+    }
+}
+
 std::vector<LayeredShape>::const_iterator
 RendererPoolSfml::findLayeredShapePosition(const GraphicsId& graphicsIdToFind) const
 {
@@ -272,4 +434,13 @@ RendererPoolSfml::findLayeredTextPosition(const GraphicsId& graphicsIdToFind) co
                         });
 }
 
+std::vector<LayeredTileLayer>::iterator
+RendererPoolSfml::findLayeredTileLayerPosition(const GraphicsId& graphicsIdToFind)
+{
+    return std::find_if(layeredTileLayers.begin(), layeredTileLayers.end(),
+                        [&graphicsIdToFind](const LayeredTileLayer& layeredTileLayer) {
+                            return layeredTileLayer.tileLayer.getGraphicsId() == graphicsIdToFind;
+                        });
+}
+
 }
@@ -1,15 +1,15 @@
 #pragma once
 
-#include <boost/functional/hash.hpp>
 #include <memory>
-#include <unordered_set>
 #include <vector>
 
+#include "Camera.h"
 #include "ContextRenderer.h"
 #include "FontStorage.h"
 #include "GraphicsIdGenerator.h"
 #include "LayeredShape.h"
 #include "LayeredText.h"
+#include "LayeredTileLayer.h"
 #include "RectangleShape.h"
 #include "RendererPool.h"
 #include "Text.h"
@@ -21,7 +21,7 @@ class RendererPoolSfml : public RendererPool
 {
 public:
     RendererPoolSfml(std::unique_ptr<ContextRenderer>, std::unique_ptr<TextureStorage>,
-                     std::unique_ptr<FontStorage>);
+                     std::unique_ptr<FontStorage>, std::shared_ptr<Camera>);
 
     GraphicsId acquire(const utils::Vector2f& size, const utils::Vector2f& position, const Color&,
                        VisibilityLayer = VisibilityLayer::First) override;
@@ -30,28 +30,51 @@ public:
     GraphicsId acquireText(const utils::Vector2f& position, const std::string& text, const FontPath&,
                            unsigned characterSize, VisibilityLayer = VisibilityLayer::First,
                            const Color& = Color::Black) override;
+    GraphicsId acquireTileLayer(const utils::Vector2f& position, const utils::Vector2i& sizeInTiles,
+                                const utils::Vector2f& tileSize,
+                                const std::vector<TexturePath>& tileTexturePaths,
+                                VisibilityLayer = VisibilityLayer::Second) override;
     void release(const GraphicsId&) override;
     void renderAll() override;
     void setPosition(const GraphicsId&, const utils::Vector2f& position) override;
+    void setSize(const GraphicsId&, const utils::Vector2f& size) override;
     boost::optional<utils::Vector2f> getPosition(const GraphicsId&) override;
     void setTexture(const GraphicsId&, const TexturePath&, const utils::Vector2f& scale = {1, 1}) override;
+    void setTexture(const GraphicsId&, TextureHandle, const utils::Vector2f& scale = {1, 1}) override;
+    void setTexture(const GraphicsId&, TextureHandle, const utils::IntRect& textureRect,
+                    const utils::Vector2f& scale = {1, 1}) override;
+    TextureHandle getTextureHandle(const TexturePath&) override;
+    bool reloadTexture(const TexturePath&) override;
     void setText(const GraphicsId&, const std::string& text) override;
     void setVisibility(const GraphicsId&, VisibilityLayer) override;
     void setColor(const GraphicsId&, const Color&) override;
     void setOutline(const GraphicsId&, float thickness, const Color&) override;
+    void setTiles(const GraphicsId&, const std::vector<int>& tiles) override;
+    void setTiles(const GraphicsId&, std::size_t firstTileIndex, std::size_t numberOfTiles,
+                  int tile) override;
     void setRenderingSize(const utils::Vector2u& renderingSize) override;
     void synchronizeRenderingSize() override;
+    std::shared_ptr<Camera> getCamera() const override;
+    RendererPoolStatistics getStatistics() const override;
 
 private:
     void cleanUnusedShapes();
+    bool isScheduledForRemoval(const GraphicsId&) const;
+    void setShapeTexture(RectangleShape&, const sf::Texture&, const utils::Vector2f& scale);
     std::vector<LayeredShape>::const_iterator findLayeredShapePosition(const GraphicsId&) const;
     std::vector<LayeredText>::const_iterator findLayeredTextPosition(const GraphicsId&) const;
+    std::vector<LayeredTileLayer>::iterator findLayeredTileLayerPosition(const GraphicsId&);
 
     std::unique_ptr<ContextRenderer> contextRenderer;
     std::unique_ptr<TextureStorage> textureStorage;
     std::unique_ptr<FontStorage> fontStorage;
+    std::shared_ptr<Camera> camera;
     std::vector<LayeredShape> layeredShapes;
     std::vector<LayeredText> layeredTexts;
-    std::unordered_set<GraphicsId, boost::hash<GraphicsId>> graphicsObjectsToRemove;
+    std::vector<LayeredTileLayer> layeredTileLayers;
+    std::vector<GraphicsId> graphicsObjectsToRemove;
+    sf::String textBuffer;
+    std::size_t drawCalls{0};
+    std::size_t batches{0};
 };
 }
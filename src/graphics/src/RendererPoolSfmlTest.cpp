@@ -8,6 +8,7 @@
 #include "TextureStorageMock.h"
 
 #include "RectangleShape.h"
+#include "TileLayer.h"
 #include "exceptions/FontNotAvailable.h"
 #include "exceptions/TextureNotAvailable.h"
 
@@ -24,11 +25,15 @@ const Color color{Color::Black};
 const TexturePath validTexturePath{"validTexturePath"};
 const TexturePath validTexturePath2{"validTexturePath2"};
 const TexturePath invalidTexturePath{"invalidTexturePath"};
+const TextureHandle textureHandle{3};
 const FontPath validFontPath{"validFontPath"};
 const FontPath invalidFontPath{"invalidFontPath"};
 const std::string text{"text"};
 const unsigned characterSize = 15;
 const auto invalidId = GraphicsIdGenerator::generateId();
+const utils::Vector2f cameraViewSize{80, 60};
+const utils::Vector2i tileLayerSize{10, 10};
+const utils::Vector2f positionOutsideCamera{100, 100};
 }
 
 class RendererPoolSfmlTest_Base : public Test
@@ -50,13 +55,14 @@ public:
     TextureStorageMock* textureStorage{textureStorageInit.get()};
     std::unique_ptr<FontStorageMock> fontStorageInit{std::make_unique<StrictMock<FontStorageMock>>()};
     FontStorageMock* fontStorage{fontStorageInit.get()};
+    std::shared_ptr<Camera> camera{std::make_shared<Camera>(cameraViewSize)};
 };
 
 class RendererPoolSfmlTest : public RendererPoolSfmlTest_Base
 {
 public:
     RendererPoolSfml rendererPool{std::move(contextRendererInit), std::move(textureStorageInit),
-                                  std::move(fontStorageInit)};
+                                  std::move(fontStorageInit), camera};
 };
 
 TEST_F(RendererPoolSfmlTest, acquireShapeWithColor_positionShouldMatch)
@@ -169,6 +175,52 @@ TEST_F(RendererPoolSfmlTest, renderShapesAndTexts)
     rendererPool.renderAll();
 }
 
+TEST_F(RendererPoolSfmlTest, renderAll_shouldCountDrawCallsAndGraphicsObjectsInStatistics)
+{
+    EXPECT_CALL(*fontStorage, getFont(validFontPath)).WillOnce(ReturnRef(font));
+    rendererPool.acquireText(position, text, validFontPath, characterSize);
+    rendererPool.acquire(size1, position, color);
+    rendererPool.acquire(size1, positionOutsideCamera, color);
+    EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+    EXPECT_CALL(*contextRenderer, setView());
+    EXPECT_CALL(*contextRenderer, draw(_)).Times(2);
+    EXPECT_CALL(*textureStorage, getTextureMemoryInBytes()).WillOnce(Return(1024));
+
+    rendererPool.renderAll();
+
+    ASSERT_EQ(rendererPool.getStatistics(), (RendererPoolStatistics{2, 2, 2, 1, 0, 1024}));
+}
+
+TEST_F(RendererPoolSfmlTest, setSizeWithInvalidId_shouldDoNothingAndNoThrow)
+{
+    ASSERT_NO_THROW(rendererPool.setSize(invalidId, size2));
+}
+
+TEST_F(RendererPoolSfmlTest, renderAll_shouldNotDrawShapeOutsideCameraVisibleArea)
+{
+    rendererPool.acquire(size1, positionOutsideCamera, color);
+    EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+    EXPECT_CALL(*contextRenderer, setView());
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlTest, renderAll_afterCameraMovedOverShape_shouldDrawShape)
+{
+    rendererPool.acquire(size1, positionOutsideCamera, color);
+    camera->setCenter(positionOutsideCamera);
+    EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+    EXPECT_CALL(*contextRenderer, setView());
+    EXPECT_CALL(*contextRenderer, draw(_));
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlTest, getCamera_shouldReturnCameraUsedForRendering)
+{
+    ASSERT_EQ(rendererPool.getCamera(), camera);
+}
+
 ACTION_P(addGraphicsIdToVector, graphicsIds)
 {
     if (const auto* rectangleShape = dynamic_cast<const RectangleShape*>(&arg0); rectangleShape != nullptr)
@@ -348,6 +400,21 @@ TEST_F(RendererPoolSfmlTest, releasedShape_shouldNotBeRendered)
     rendererPool.renderAll();
 }
 
+TEST_F(RendererPoolSfmlTest, releasedShapesAmongOthers_shouldNotBeRenderedEvenWhenReleasedTwice)
+{
+    const auto firstId = rendererPool.acquire(size1, position, color);
+    rendererPool.acquire(size1, position, color);
+    const auto thirdId = rendererPool.acquire(size1, position, color);
+    rendererPool.release(thirdId);
+    rendererPool.release(firstId);
+    rendererPool.release(thirdId);
+    EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+    EXPECT_CALL(*contextRenderer, setView());
+    EXPECT_CALL(*contextRenderer, draw(_));
+
+    rendererPool.renderAll();
+}
+
 TEST_F(RendererPoolSfmlTest, releasedText_shouldNotBeRendered)
 {
     EXPECT_CALL(*fontStorage, getFont(validFontPath)).WillOnce(ReturnRef(font));
@@ -359,6 +426,76 @@ TEST_F(RendererPoolSfmlTest, releasedText_shouldNotBeRendered)
     rendererPool.renderAll();
 }
 
+TEST_F(RendererPoolSfmlTest, renderTileLayer_shouldDrawAllTilesWithSingleDrawCall)
+{
+    EXPECT_CALL(*textureStorage, getTexture(validTexturePath)).WillOnce(ReturnRef(texture));
+    const auto tileLayerId =
+        rendererPool.acquireTileLayer(position, tileLayerSize, size1, {validTexturePath});
+    rendererPool.setTiles(tileLayerId, std::vector<int>(100, 1));
+    EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+    EXPECT_CALL(*contextRenderer, setView());
+    EXPECT_CALL(*contextRenderer, draw(_));
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlTest, renderTileLayerAfterSettingTilesRun_shouldDrawChangedTiles)
+{
+    EXPECT_CALL(*textureStorage, getTexture(validTexturePath)).WillOnce(ReturnRef(texture));
+    const auto tileLayerId =
+        rendererPool.acquireTileLayer(position, tileLayerSize, size1, {validTexturePath});
+    rendererPool.setTiles(tileLayerId, 10, 5, 1);
+    EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+    EXPECT_CALL(*contextRenderer, setView());
+    EXPECT_CALL(*contextRenderer, draw(_));
+
+    rendererPool.renderAll();
+}
+
+TEST_F(RendererPoolSfmlTest, renderTileLayerWithShapes_shouldDrawTileLayerInItsVisibilityLayerOrder)
+{
+    const auto backgroundGraphicsId =
+        rendererPool.acquire(size1, position, Color::Red, VisibilityLayer::Background);
+    const auto firstLayerGraphicsId =
+        rendererPool.acquire(size1, position, Color::Red, VisibilityLayer::First);
+    EXPECT_CALL(*textureStorage, getTexture(validTexturePath)).WillOnce(ReturnRef(texture));
+    const auto tileLayerId = rendererPool.acquireTileLayer(position, tileLayerSize, size1, {validTexturePath},
+                                                           VisibilityLayer::Second);
+    std::vector<GraphicsId> graphicsIds;
+    const TileLayer* drawnTileLayer{nullptr};
+    EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+    EXPECT_CALL(*contextRenderer, setView());
+    EXPECT_CALL(*contextRenderer, draw(_))
+        .Times(3)
+        .WillRepeatedly(Invoke([&](const sf::Drawable& drawable) {
+            if (const auto* tileLayer = dynamic_cast<const TileLayer*>(&drawable); tileLayer != nullptr)
+            {
+                drawnTileLayer = tileLayer;
+                graphicsIds.push_back(tileLayer->getGraphicsId());
+                return;
+            }
+            graphicsIds.push_back(dynamic_cast<const RectangleShape&>(drawable).getGraphicsId());
+        }));
+
+    rendererPool.renderAll();
+
+    ASSERT_NE(drawnTileLayer, nullptr);
+    ASSERT_EQ(graphicsIds,
+              (std::vector<GraphicsId>{backgroundGraphicsId, tileLayerId, firstLayerGraphicsId}));
+}
+
+TEST_F(RendererPoolSfmlTest, releasedTileLayer_shouldNotBeRendered)
+{
+    EXPECT_CALL(*textureStorage, getTexture(validTexturePath)).WillOnce(ReturnRef(texture));
+    const auto tileLayerId =
+        rendererPool.acquireTileLayer(position, tileLayerSize, size1, {validTexturePath});
+    rendererPool.release(tileLayerId);
+    EXPECT_CALL(*contextRenderer, clear(sf::Color::White));
+    EXPECT_CALL(*contextRenderer, setView());
+
+    rendererPool.renderAll();
+}
+
 TEST_F(RendererPoolSfmlTest, setTextureWithValidTexturePath_shouldNoThrow)
 {
     const auto shapeId = rendererPool.acquire(size1, position, color);
@@ -376,6 +513,50 @@ TEST_F(RendererPoolSfmlTest, setTextureWithInvalidTexturePath_shouldThrowTexture
     ASSERT_THROW(rendererPool.setTexture(shapeId, invalidTexturePath), exceptions::TextureNotAvailable);
 }
 
+TEST_F(RendererPoolSfmlTest, getTextureHandle_shouldReturnHandleFromTextureStorage)
+{
+    EXPECT_CALL(*textureStorage, getTextureHandle(validTexturePath)).WillOnce(Return(textureHandle));
+
+    ASSERT_EQ(rendererPool.getTextureHandle(validTexturePath), textureHandle);
+}
+
+TEST_F(RendererPoolSfmlTest, reloadTexture_shouldReloadTextureInTextureStorage)
+{
+    EXPECT_CALL(*textureStorage, reloadTexture(validTexturePath)).WillOnce(Return(true));
+
+    ASSERT_TRUE(rendererPool.reloadTexture(validTexturePath));
+}
+
+TEST_F(RendererPoolSfmlTest, setTextureWithTextureHandle_shouldNotLookUpTextureByPath)
+{
+    const auto shapeId = rendererPool.acquire(size1, position, color);
+    EXPECT_CALL(*textureStorage, getTexture(textureHandle)).WillOnce(ReturnRef(texture));
+
+    ASSERT_NO_THROW(rendererPool.setTexture(shapeId, textureHandle));
+}
+
+TEST_F(RendererPoolSfmlTest, setTextureWithTextureHandleAndTextureRect_shouldNotThrow)
+{
+    const auto shapeId = rendererPool.acquire(size1, position, color);
+    EXPECT_CALL(*textureStorage, getTexture(textureHandle)).WillOnce(ReturnRef(texture));
+
+    ASSERT_NO_THROW(rendererPool.setTexture(shapeId, textureHandle, utils::IntRect{32, 0, 32, 32}));
+}
+
+TEST_F(RendererPoolSfmlTest, setTextureWithInvalidTextureHandle_shouldThrowTextureNotAvailable)
+{
+    const auto shapeId = rendererPool.acquire(size1, position, color);
+    EXPECT_CALL(*textureStorage, getTexture(textureHandle))
+        .WillOnce(Throw(exceptions::TextureNotAvailable{""}));
+
+    ASSERT_THROW(rendererPool.setTexture(shapeId, textureHandle), exceptions::TextureNotAvailable);
+}
+
+TEST_F(RendererPoolSfmlTest, setTextureWithTextureHandleAndInvalidGraphicsId_shouldNotThrow)
+{
+    ASSERT_NO_THROW(rendererPool.setTexture(invalidId, textureHandle));
+}
+
 TEST_F(RendererPoolSfmlTest, setTextureWithInvalidGraphicsId_shouldNotThrow)
 {
     ASSERT_NO_THROW(rendererPool.setTexture(invalidId, validTexturePath));
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <tuple>
+
+namespace graphics
+{
+struct RendererPoolStatistics
+{
+    std::size_t drawCalls;
+    std::size_t batches;
+    std::size_t shapes;
+    std::size_t texts;
+    std::size_t tileLayers;
+    std::size_t textureMemoryInBytes;
+};
+
+inline bool operator==(const RendererPoolStatistics& lhs, const RendererPoolStatistics& rhs)
+{
+    auto tieStruct = [](const RendererPoolStatistics& statistics) {
+        return std::tie(statistics.drawCalls, statistics.batches, statistics.shapes, statistics.texts,
+                        statistics.tileLayers, statistics.textureMemoryInBytes);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const RendererPoolStatistics& statistics)
+{
+    return os << "drawCalls: " << statistics.drawCalls << " batches: " << statistics.batches
+              << " shapes: " << statistics.shapes << " texts: " << statistics.texts
+              << " tileLayers: " << statistics.tileLayers
+              << " textureMemoryInBytes: " << statistics.textureMemoryInBytes;
+}
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstddef>
+
+namespace graphics
+{
+using TextureHandle = std::size_t;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "TextureHandle.h"
 #include "TexturePath.h"
 
 namespace graphics
@@ -10,5 +11,9 @@ public:
     virtual ~TextureStorage() = default;
 
     virtual const sf::Texture& getTexture(const TexturePath&) = 0;
+    virtual const sf::Texture& getTexture(TextureHandle) = 0;
+    virtual TextureHandle getTextureHandle(const TexturePath&) = 0;
+    virtual bool reloadTexture(const TexturePath&) = 0;
+    virtual std::size_t getTextureMemoryInBytes() const = 0;
 };
-}
\ No newline at end of file
+}
@@ -0,0 +1,51 @@
+#include "TextureStorageHeadless.h"
+
+#include <filesystem>
+
+#include "exceptions/TextureNotAvailable.h"
+
+namespace graphics
+{
+const sf::Texture& TextureStorageHeadless::getTexture(const TexturePath& path)
+{
+    getTextureHandle(path);
+    return placeholderTexture;
+}
+
+const sf::Texture& TextureStorageHeadless::getTexture(TextureHandle textureHandle)
+{
+    if (textureHandle >= textureHandles.size())
+    {
+        throw exceptions::TextureNotAvailable{"Texture not available for handle: " +
+                                              std::to_string(textureHandle)};
+    }
+    return placeholderTexture;
+}
+
+TextureHandle TextureStorageHeadless::getTextureHandle(const TexturePath& path)
+{
+    if (const auto textureHandleIter = textureHandles.find(path); textureHandleIter != textureHandles.end())
+    {
+        return textureHandleIter->second;
+    }
+
+    if (not std::filesystem::exists(path))
+    {
+        throw exceptions::TextureNotAvailable{"Texture file not found: " + path};
+    }
+    const auto textureHandle = textureHandles.size();
+    textureHandles[path] = textureHandle;
+    return textureHandle;
+}
+
+bool TextureStorageHeadless::reloadTexture(const TexturePath& path)
+{
+    return textureHandles.count(path) != 0;
+}
+
+std::size_t TextureStorageHeadless::getTextureMemoryInBytes() const
+{
+    return 0;
+}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <SFML/Graphics/Texture.hpp>
+#include <unordered_map>
+
+#include "TextureStorage.h"
+
+namespace graphics
+{
+class TextureStorageHeadless : public TextureStorage
+{
+public:
+    const sf::Texture& getTexture(const TexturePath& path) override;
+    const sf::Texture& getTexture(TextureHandle) override;
+    TextureHandle getTextureHandle(const TexturePath& path) override;
+    bool reloadTexture(const TexturePath& path) override;
+    std::size_t getTextureMemoryInBytes() const override;
+
+private:
+    std::unordered_map<TexturePath, TextureHandle> textureHandles;
+    sf::Texture placeholderTexture;
+};
+}
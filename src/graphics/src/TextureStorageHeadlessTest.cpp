@@ -0,0 +1,49 @@
+#include "TextureStorageHeadless.h"
+
+#include "gtest/gtest.h"
+
+#include "GetProjectPath.h"
+#include "exceptions/TextureNotAvailable.h"
+
+using namespace graphics;
+using namespace ::testing;
+
+class TextureStorageHeadlessTest : public ::testing::Test
+{
+public:
+    const std::string testDirectory{utils::getProjectPath("chimarrao-platformer") +
+                                    "src/graphics/src/testResources/"};
+    const std::string nonExistingTexturePath{testDirectory + "nonExistingFile"};
+    const std::string existingTexturePath{testDirectory + "attack-A1.png"};
+    const std::string otherExistingTexturePath{testDirectory + "VeraMono.ttf"};
+
+    TextureStorageHeadless storage;
+};
+
+TEST_F(TextureStorageHeadlessTest, getTextureHandle_shouldReturnSameHandleForSamePath)
+{
+    const auto textureHandle1 = storage.getTextureHandle(existingTexturePath);
+    const auto textureHandle2 = storage.getTextureHandle(existingTexturePath);
+    const auto otherTextureHandle = storage.getTextureHandle(otherExistingTexturePath);
+
+    ASSERT_EQ(textureHandle1, textureHandle2);
+    ASSERT_NE(textureHandle1, otherTextureHandle);
+}
+
+TEST_F(TextureStorageHeadlessTest, getTextureWithNonExistingPath_shouldThrowTextureNotAvailable)
+{
+    ASSERT_THROW(storage.getTexture(nonExistingTexturePath), exceptions::TextureNotAvailable);
+}
+
+TEST_F(TextureStorageHeadlessTest, getTextureWithInvalidHandle_shouldThrowTextureNotAvailable)
+{
+    ASSERT_THROW(storage.getTexture(TextureHandle{42}), exceptions::TextureNotAvailable);
+}
+
+TEST_F(TextureStorageHeadlessTest, reloadTexture_shouldReturnTrueOnlyForKnownPath)
+{
+    storage.getTextureHandle(existingTexturePath);
+
+    ASSERT_TRUE(storage.reloadTexture(existingTexturePath));
+    ASSERT_FALSE(storage.reloadTexture(otherExistingTexturePath));
+}
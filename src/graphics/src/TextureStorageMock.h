@@ -10,5 +10,9 @@ class TextureStorageMock : public TextureStorage
 {
 public:
     MOCK_METHOD(const sf::Texture&, getTexture, (const TexturePath&));
+    MOCK_METHOD(const sf::Texture&, getTexture, (TextureHandle));
+    MOCK_METHOD(TextureHandle, getTextureHandle, (const TexturePath&));
+    MOCK_METHOD(bool, reloadTexture, (const TexturePath&));
+    MOCK_METHOD(std::size_t, getTextureMemoryInBytes, (), (const));
 };
-}
\ No newline at end of file
+}
@@ -2,23 +2,80 @@
 
 #include <iostream>
 
+#include "AllocationTracker.h"
+#include "FrameProfiler.h"
 #include "TextureLoader.h"
 #include "exceptions/CannotAccessTextureFile.h"
 #include "exceptions/TextureNotAvailable.h"
 
 namespace graphics
 {
+namespace
+{
+const std::size_t bytesPerPixel{4};
+}
+
 const sf::Texture& TextureStorageSfml::getTexture(const TexturePath& path)
 {
-    if (not textureInStorage(path))
+    return *textures[getTextureHandle(path)];
+}
+
+const sf::Texture& TextureStorageSfml::getTexture(TextureHandle textureHandle)
+{
+    if (textureHandle >= textures.size())
+    {
+        throw exceptions::TextureNotAvailable{"Texture not available for handle: " +
+                                              std::to_string(textureHandle)};
+    }
+    return *textures[textureHandle];
+}
+
+TextureHandle TextureStorageSfml::getTextureHandle(const TexturePath& path)
+{
+    if (const auto textureHandleIter = textureHandles.find(path); textureHandleIter != textureHandles.end())
+    {
+        return textureHandleIter->second;
+    }
+    return loadTexture(path);
+}
+
+bool TextureStorageSfml::reloadTexture(const TexturePath& path)
+{
+    const auto textureHandleIter = textureHandles.find(path);
+    if (textureHandleIter == textureHandles.end())
+    {
+        return false;
+    }
+
+    sf::Texture reloadedTexture;
+    try
     {
-        loadTexture(path);
+        TextureLoader::load(reloadedTexture, path);
     }
-    return *textures.at(path);
+    catch (const exceptions::CannotAccessTextureFile& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+    textures[textureHandleIter->second]->swap(reloadedTexture);
+    return true;
 }
 
-void TextureStorageSfml::loadTexture(const TexturePath& path)
+std::size_t TextureStorageSfml::getTextureMemoryInBytes() const
 {
+    std::size_t textureMemoryInBytes{0};
+    for (const auto& texture : textures)
+    {
+        const auto textureSize = texture->getSize();
+        textureMemoryInBytes += std::size_t{textureSize.x} * textureSize.y * bytesPerPixel;
+    }
+    return textureMemoryInBytes;
+}
+
+TextureHandle TextureStorageSfml::loadTexture(const TexturePath& path)
+{
+    PROFILE_ZONE("TextureStorageSfml::loadTexture");
+    ALLOCATION_TAG(Graphics);
     auto texture = std::make_unique<sf::Texture>();
     try
     {
@@ -29,11 +86,10 @@ void TextureStorageSfml::loadTexture(const TexturePath& path)
         std::cerr << e.what() << std::endl;
         throw exceptions::TextureNotAvailable{e.what()};
     }
-    textures[path] = std::move(texture);
+    const auto textureHandle = textures.size();
+    textures.push_back(std::move(texture));
+    textureHandles[path] = textureHandle;
+    return textureHandle;
 }
 
-bool TextureStorageSfml::textureInStorage(const TexturePath& path)
-{
-    return textures.count(path) == 1;
 }
-}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "TextureLoader.h"
 #include "TextureStorage.h"
@@ -12,11 +13,15 @@ class TextureStorageSfml : public TextureStorage
 {
 public:
     const sf::Texture& getTexture(const TexturePath& path) override;
+    const sf::Texture& getTexture(TextureHandle) override;
+    TextureHandle getTextureHandle(const TexturePath& path) override;
+    bool reloadTexture(const TexturePath& path) override;
+    std::size_t getTextureMemoryInBytes() const override;
 
 private:
-    void loadTexture(const TexturePath& path);
-    bool textureInStorage(const TexturePath& path);
+    TextureHandle loadTexture(const TexturePath& path);
 
-    std::unordered_map<TexturePath, std::unique_ptr<sf::Texture>> textures;
+    std::unordered_map<TexturePath, TextureHandle> textureHandles;
+    std::vector<std::unique_ptr<sf::Texture>> textures;
 };
-}
\ No newline at end of file
+}
@@ -36,4 +36,46 @@ TEST_F(TextureStorageSfmlTest, getTexture_shouldRememberLoadedTexture)
 TEST_F(TextureStorageSfmlTest, getTextureWithNonExistingPath_shouldThrowTextureNotAvailable)
 {
     ASSERT_THROW(storage.getTexture(nonExistingTexturePath), exceptions::TextureNotAvailable);
-}
\ No newline at end of file
+}
+TEST_F(TextureStorageSfmlTest, getTextureHandle_shouldReturnSameHandleForSamePath)
+{
+    const auto textureHandle1 = storage.getTextureHandle(existingTexturePath);
+    const auto textureHandle2 = storage.getTextureHandle(existingTexturePath);
+
+    ASSERT_EQ(textureHandle1, textureHandle2);
+}
+
+TEST_F(TextureStorageSfmlTest, getTextureByHandle_shouldReturnTextureLoadedFromPath)
+{
+    const auto textureHandle = storage.getTextureHandle(existingTexturePath);
+
+    ASSERT_EQ(&storage.getTexture(textureHandle), &storage.getTexture(existingTexturePath));
+}
+
+TEST_F(TextureStorageSfmlTest, getTextureHandleWithNonExistingPath_shouldThrowTextureNotAvailable)
+{
+    ASSERT_THROW(storage.getTextureHandle(nonExistingTexturePath), exceptions::TextureNotAvailable);
+}
+
+TEST_F(TextureStorageSfmlTest, getTextureWithNotAcquiredHandle_shouldThrowTextureNotAvailable)
+{
+    const TextureHandle notAcquiredTextureHandle{42};
+
+    ASSERT_THROW(storage.getTexture(notAcquiredTextureHandle), exceptions::TextureNotAvailable);
+}
+
+TEST_F(TextureStorageSfmlTest, reloadTextureWithNotLoadedPath_shouldReturnFalse)
+{
+    ASSERT_FALSE(storage.reloadTexture(existingTexturePath));
+}
+
+TEST_F(TextureStorageSfmlTest, reloadTexture_shouldKeepTextureHandleAndTextureAddress)
+{
+    const auto textureHandle = storage.getTextureHandle(existingTexturePath);
+    const auto& textureBeforeReload = storage.getTexture(textureHandle);
+
+    ASSERT_TRUE(storage.reloadTexture(existingTexturePath));
+
+    ASSERT_EQ(storage.getTextureHandle(existingTexturePath), textureHandle);
+    ASSERT_EQ(&storage.getTexture(textureHandle), &textureBeforeReload);
+}
@@ -0,0 +1,207 @@
+#include "TileLayer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SFML/Graphics/RenderTarget.hpp"
+
+namespace graphics
+{
+namespace
+{
+const auto verticesPerTile{4u};
+const auto noQuadIndex{std::numeric_limits<std::size_t>::max()};
+
+int toTileCoordinate(float coordinate, float tileLength)
+{
+    return static_cast<int>(std::floor(coordinate / tileLength));
+}
+}
+
+TileLayer::TileLayer(GraphicsId idInit, const utils::Vector2f& positionInit,
+                     const utils::Vector2i& sizeInTilesInit, const utils::Vector2f& tileSizeInit,
+                     std::vector<const sf::Texture*> tileTexturesInit)
+    : id{idInit},
+      position{positionInit},
+      sizeInTiles{sizeInTilesInit},
+      tileSize{tileSizeInit},
+      tileTextures{std::move(tileTexturesInit)},
+      tiles(static_cast<std::size_t>(sizeInTiles.x) * static_cast<std::size_t>(sizeInTiles.y), 0),
+      verticesPerTileType(tileTextures.size(), sf::VertexArray{sf::Quads}),
+      tileIndicesPerTileType(tileTextures.size()),
+      quadIndicesByTileIndex(tiles.size(), noQuadIndex),
+      verticesOutdated{true}
+{
+}
+
+GraphicsId TileLayer::getGraphicsId() const
+{
+    return id;
+}
+
+void TileLayer::setTiles(const std::vector<int>& tilesInit)
+{
+    tiles = tilesInit;
+    tiles.resize(static_cast<std::size_t>(sizeInTiles.x) * static_cast<std::size_t>(sizeInTiles.y), 0);
+    verticesOutdated = true;
+}
+
+void TileLayer::setTiles(std::size_t firstTileIndex, std::size_t numberOfTiles, int tile)
+{
+    const auto lastTileIndex = std::min(firstTileIndex + numberOfTiles, tiles.size());
+    for (auto tileIndex = firstTileIndex; tileIndex < lastTileIndex; tileIndex++)
+    {
+        const auto previousTile = tiles[tileIndex];
+        if (previousTile == tile)
+        {
+            continue;
+        }
+
+        tiles[tileIndex] = tile;
+        if (not verticesOutdated && isTileVisible(tileIndex))
+        {
+            removeTileVertices(tileIndex, previousTile);
+            appendTileVertices(tileIndex);
+        }
+    }
+}
+
+void TileLayer::updateVisibleArea(const utils::FloatRect& visibleArea)
+{
+    const auto areaLeft = visibleArea.left - position.x;
+    const auto areaTop = visibleArea.top - position.y;
+    const auto left = std::clamp(toTileCoordinate(areaLeft, tileSize.x), 0, sizeInTiles.x);
+    const auto top = std::clamp(toTileCoordinate(areaTop, tileSize.y), 0, sizeInTiles.y);
+    const auto right =
+        std::clamp(toTileCoordinate(areaLeft + visibleArea.width, tileSize.x) + 1, 0, sizeInTiles.x);
+    const auto bottom =
+        std::clamp(toTileCoordinate(areaTop + visibleArea.height, tileSize.y) + 1, 0, sizeInTiles.y);
+    const utils::IntRect newVisibleTiles{left, top, right - left, bottom - top};
+
+    if (newVisibleTiles != visibleTiles)
+    {
+        visibleTiles = newVisibleTiles;
+        verticesOutdated = true;
+    }
+
+    if (verticesOutdated)
+    {
+        rebuildVertices();
+    }
+}
+
+std::size_t TileLayer::getNumberOfVisibleTiles() const
+{
+    std::size_t numberOfVisibleTiles{0};
+    for (const auto& vertices : verticesPerTileType)
+    {
+        numberOfVisibleTiles += vertices.getVertexCount() / verticesPerTile;
+    }
+    return numberOfVisibleTiles;
+}
+
+std::size_t TileLayer::getNumberOfBatches() const
+{
+    return static_cast<std::size_t>(
+        std::count_if(verticesPerTileType.begin(), verticesPerTileType.end(),
+                      [](const sf::VertexArray& vertices) { return vertices.getVertexCount() != 0; }));
+}
+
+void TileLayer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    for (std::size_t tileType = 0; tileType < verticesPerTileType.size(); tileType++)
+    {
+        if (verticesPerTileType[tileType].getVertexCount() != 0)
+        {
+            target.draw(verticesPerTileType[tileType], sf::RenderStates{tileTextures[tileType]});
+        }
+    }
+}
+
+void TileLayer::rebuildVertices()
+{
+    for (std::size_t tileType = 0; tileType < verticesPerTileType.size(); tileType++)
+    {
+        for (const auto tileIndex : tileIndicesPerTileType[tileType])
+        {
+            quadIndicesByTileIndex[tileIndex] = noQuadIndex;
+        }
+        tileIndicesPerTileType[tileType].clear();
+        verticesPerTileType[tileType].clear();
+    }
+
+    for (auto y = visibleTiles.top; y < visibleTiles.top + visibleTiles.height; y++)
+    {
+        for (auto x = visibleTiles.left; x < visibleTiles.left + visibleTiles.width; x++)
+        {
+            appendTileVertices(static_cast<std::size_t>(y * sizeInTiles.x + x));
+        }
+    }
+
+    verticesOutdated = false;
+}
+
+bool TileLayer::isTileVisible(std::size_t tileIndex) const
+{
+    const auto x = static_cast<int>(tileIndex % static_cast<std::size_t>(sizeInTiles.x));
+    const auto y = static_cast<int>(tileIndex / static_cast<std::size_t>(sizeInTiles.x));
+    return x >= visibleTiles.left && x < visibleTiles.left + visibleTiles.width && y >= visibleTiles.top &&
+           y < visibleTiles.top + visibleTiles.height;
+}
+
+void TileLayer::appendTileVertices(std::size_t tileIndex)
+{
+    const auto tile = tiles[tileIndex];
+    if (tile <= 0 || static_cast<std::size_t>(tile) > tileTextures.size())
+    {
+        return;
+    }
+
+    const auto tileType = static_cast<std::size_t>(tile - 1);
+    auto& vertices = verticesPerTileType[tileType];
+    const auto textureSize = utils::Vector2f{tileTextures[tileType]->getSize()};
+    const auto x = tileIndex % static_cast<std::size_t>(sizeInTiles.x);
+    const auto y = tileIndex / static_cast<std::size_t>(sizeInTiles.x);
+    const utils::Vector2f topLeft{position.x + static_cast<float>(x) * tileSize.x,
+                                  position.y + static_cast<float>(y) * tileSize.y};
+
+    quadIndicesByTileIndex[tileIndex] = tileIndicesPerTileType[tileType].size();
+    tileIndicesPerTileType[tileType].push_back(tileIndex);
+    vertices.append(sf::Vertex{topLeft, {0, 0}});
+    vertices.append(sf::Vertex{{topLeft.x + tileSize.x, topLeft.y}, {textureSize.x, 0}});
+    vertices.append(sf::Vertex{topLeft + tileSize, textureSize});
+    vertices.append(sf::Vertex{{topLeft.x, topLeft.y + tileSize.y}, {0, textureSize.y}});
+}
+
+void TileLayer::removeTileVertices(std::size_t tileIndex, int previousTile)
+{
+    const auto quadIndex = quadIndicesByTileIndex[tileIndex];
+    if (quadIndex == noQuadIndex)
+    {
+        return;
+    }
+
+    const auto tileType = static_cast<std::size_t>(previousTile - 1);
+    auto& vertices = verticesPerTileType[tileType];
+    auto& tileIndices = tileIndicesPerTileType[tileType];
+    const auto lastQuadIndex = tileIndices.size() - 1;
+
+    if (quadIndex != lastQuadIndex)
+    {
+        const auto firstVertex = quadIndex * verticesPerTile;
+        const auto firstLastQuadVertex = lastQuadIndex * verticesPerTile;
+        for (auto vertex = 0u; vertex < verticesPerTile; vertex++)
+        {
+            vertices[firstVertex + vertex] = vertices[firstLastQuadVertex + vertex];
+        }
+        tileIndices[quadIndex] = tileIndices[lastQuadIndex];
+        quadIndicesByTileIndex[tileIndices[quadIndex]] = quadIndex;
+    }
+
+    vertices.resize(lastQuadIndex * verticesPerTile);
+    tileIndices.pop_back();
+    quadIndicesByTileIndex[tileIndex] = noQuadIndex;
+}
+
+}
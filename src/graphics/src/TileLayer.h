@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "SFML/Graphics/Drawable.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/VertexArray.hpp"
+
+#include "GraphicsId.h"
+#include "Rect.h"
+#include "Vector.h"
+
+namespace graphics
+{
+class TileLayer : public sf::Drawable
+{
+public:
+    TileLayer(GraphicsId, const utils::Vector2f& position, const utils::Vector2i& sizeInTiles,
+              const utils::Vector2f& tileSize, std::vector<const sf::Texture*> tileTextures);
+
+    GraphicsId getGraphicsId() const;
+    void setTiles(const std::vector<int>& tiles);
+    void setTiles(std::size_t firstTileIndex, std::size_t numberOfTiles, int tile);
+    void updateVisibleArea(const utils::FloatRect& visibleArea);
+    std::size_t getNumberOfVisibleTiles() const;
+    std::size_t getNumberOfBatches() const;
+
+private:
+    void draw(sf::RenderTarget&, sf::RenderStates) const override;
+    void rebuildVertices();
+    bool isTileVisible(std::size_t tileIndex) const;
+    void appendTileVertices(std::size_t tileIndex);
+    void removeTileVertices(std::size_t tileIndex, int previousTile);
+
+    GraphicsId id;
+    utils::Vector2f position;
+    utils::Vector2i sizeInTiles;
+    utils::Vector2f tileSize;
+    std::vector<const sf::Texture*> tileTextures;
+    std::vector<int> tiles;
+    std::vector<sf::VertexArray> verticesPerTileType;
+    std::vector<std::vector<std::size_t>> tileIndicesPerTileType;
+    std::vector<std::size_t> quadIndicesByTileIndex;
+    utils::IntRect visibleTiles;
+    bool verticesOutdated;
+};
+
+inline bool operator==(const TileLayer& lhs, const TileLayer& rhs)
+{
+    return lhs.getGraphicsId() == rhs.getGraphicsId();
+}
+}
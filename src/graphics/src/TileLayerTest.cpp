@@ -0,0 +1,146 @@
+#include "TileLayer.h"
+
+#include "gtest/gtest.h"
+
+#include "GraphicsIdGenerator.h"
+
+using namespace graphics;
+using namespace ::testing;
+
+namespace
+{
+const auto tileLayerId = GraphicsIdGenerator::generateId();
+const utils::Vector2f position{10, 10};
+const utils::Vector2i sizeInTiles{4, 3};
+const utils::Vector2f tileSize{5, 5};
+const std::vector<int> tiles{1, 0, 2, 1, 0, 0, 0, 0, 2, 2, 0, 1};
+const utils::FloatRect wholeLayerArea{0, 0, 100, 100};
+const utils::FloatRect firstRowArea{10, 10, 20, 4};
+const utils::FloatRect areaOutsideLayer{100, 100, 20, 20};
+}
+
+class TileLayerTest : public Test
+{
+public:
+    sf::Texture firstTexture;
+    sf::Texture secondTexture;
+    TileLayer tileLayer{tileLayerId, position, sizeInTiles, tileSize, {&firstTexture, &secondTexture}};
+};
+
+TEST_F(TileLayerTest, getGraphicsId)
+{
+    ASSERT_EQ(tileLayer.getGraphicsId(), tileLayerId);
+}
+
+TEST_F(TileLayerTest, givenNoTiles_shouldNotHaveVisibleTiles)
+{
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 0);
+}
+
+TEST_F(TileLayerTest, givenWholeLayerVisible_shouldBuildAllNonEmptyTiles)
+{
+    tileLayer.setTiles(tiles);
+
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 6);
+}
+
+TEST_F(TileLayerTest, givenPartiallyVisibleLayer_shouldBuildOnlyVisibleTiles)
+{
+    tileLayer.setTiles(tiles);
+
+    tileLayer.updateVisibleArea(firstRowArea);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 3);
+}
+
+TEST_F(TileLayerTest, givenLayerOutsideVisibleArea_shouldNotBuildAnyTile)
+{
+    tileLayer.setTiles(tiles);
+
+    tileLayer.updateVisibleArea(areaOutsideLayer);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 0);
+}
+
+TEST_F(TileLayerTest, setTilesAfterUpdate_shouldRebuildOnNextUpdate)
+{
+    tileLayer.setTiles(tiles);
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    tileLayer.setTiles(std::vector<int>(tiles.size(), 1));
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 12);
+}
+
+TEST_F(TileLayerTest, numberOfBatches_shouldMatchNumberOfVisibleTileTypes)
+{
+    tileLayer.setTiles(tiles);
+
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    ASSERT_EQ(tileLayer.getNumberOfBatches(), 2u);
+}
+
+TEST_F(TileLayerTest, setTilesRunAfterUpdate_shouldUpdateVisibleTilesWithoutRebuild)
+{
+    tileLayer.setTiles(tiles);
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    tileLayer.setTiles(4, 3, 2);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 9);
+    ASSERT_EQ(tileLayer.getNumberOfBatches(), 2u);
+}
+
+TEST_F(TileLayerTest, setTilesRunClearingAllTilesOfOneType_shouldDropItsBatch)
+{
+    tileLayer.setTiles(tiles);
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    tileLayer.setTiles(0, 1, 2);
+    tileLayer.setTiles(3, 1, 0);
+    tileLayer.setTiles(11, 1, 0);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 4);
+    ASSERT_EQ(tileLayer.getNumberOfBatches(), 1u);
+}
+
+TEST_F(TileLayerTest, setTilesRunOutsideVisibleArea_shouldNotChangeVisibleTiles)
+{
+    tileLayer.setTiles(tiles);
+    tileLayer.updateVisibleArea(firstRowArea);
+
+    tileLayer.setTiles(4, 8, 1);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 3);
+}
+
+TEST_F(TileLayerTest, setTilesRunBeyondLayer_shouldChangeOnlyTilesInsideLayer)
+{
+    tileLayer.setTiles(tiles);
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    tileLayer.setTiles(10, 5, 1);
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    ASSERT_EQ(tileLayer.getNumberOfVisibleTiles(), 7);
+}
+
+TEST_F(TileLayerTest, setTilesRunAfterUpdate_shouldMatchFullRebuild)
+{
+    tileLayer.setTiles(tiles);
+    tileLayer.updateVisibleArea(wholeLayerArea);
+    tileLayer.setTiles(0, 12, 1);
+    tileLayer.setTiles(2, 3, 0);
+    const auto incrementallyUpdatedTiles = tileLayer.getNumberOfVisibleTiles();
+
+    tileLayer.setTiles(std::vector<int>{1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1});
+    tileLayer.updateVisibleArea(wholeLayerArea);
+
+    ASSERT_EQ(incrementallyUpdatedTiles, tileLayer.getNumberOfVisibleTiles());
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdexcept>
+
+namespace graphics::exceptions
+{
+struct InvalidCameraZoom : std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
+}
@@ -1,44 +1,50 @@
 #include "DefaultInputManager.h"
 
-#include <SFML/Window/Keyboard.hpp>
-#include <SFML/Window/Mouse.hpp>
+#include <SFML/Window/Event.hpp>
 
 #include "InputKey.h"
 #include "InputKeySfmlMapper.h"
 
 namespace input
 {
+namespace
+{
+const auto firstPrintableCharacter{32u};
+const auto lastPrintableCharacter{126u};
+const auto inputEventBufferCapacity{256u};
+}
+
 DefaultInputManager::DefaultInputManager(std::unique_ptr<InputObservationHandler> handler,
                                          std::shared_ptr<window::Window> windowInit)
-    : observationHandler{std::move(handler)}, window{std::move(windowInit)}
+    : observationHandler{std::move(handler)}, window{std::move(windowInit)},
+      heldKeys{0},
+      inputEvents{inputEventBufferCapacity}
 {
 }
 
 void DefaultInputManager::readInput()
 {
-    inputStatus.clearPressedKeys();
-
-    for (const auto& keyboardKey : keyboardButtons)
-    {
-        if (sf::Keyboard::isKeyPressed(InputKeySfmlMapper::getKeyboardSfmlKey(keyboardKey)))
-        {
-            inputStatus.setKeyPressed(keyboardKey);
-        }
-    }
+    InputKeysMask keysPressedDuringFrame{0};
+    inputStatus.clearEnteredText();
 
-    for (const auto& mouseKey : mouseButtons)
+    sf::Event event{};
+    while (window->pollEvent(event))
     {
-        if (sf::Mouse::isButtonPressed(InputKeySfmlMapper::getMouseSfmlKey(mouseKey)))
-        {
-            inputStatus.setKeyPressed(mouseKey);
-        }
+        handleInputEvent(event, InputEventClock::now(), keysPressedDuringFrame);
+        window->handleEvent(event);
     }
 
+    inputStatus.setPressedKeys(heldKeys | keysPressedDuringFrame);
     inputStatus.setReleasedKeys();
     inputStatus.setMousePosition(window->getMousePosition());
     notifyObservers();
 }
 
+const InputEventBuffer& DefaultInputManager::getInputEvents() const
+{
+    return inputEvents;
+}
+
 void DefaultInputManager::registerObserver(InputObserver* observer)
 {
     observationHandler->registerObserver(observer);
@@ -54,4 +60,65 @@ void DefaultInputManager::notifyObservers()
     observationHandler->notifyObservers(inputStatus);
 }
 
-}
\ No newline at end of file
+void DefaultInputManager::handleInputEvent(const sf::Event& event, InputEventTimePoint eventTimestamp,
+                                           InputKeysMask& keysPressedDuringFrame)
+{
+    switch (event.type)
+    {
+    case sf::Event::KeyPressed:
+        if (const auto inputKey = InputKeySfmlMapper::getInputKey(event.key.code))
+        {
+            pressKey(*inputKey, eventTimestamp, keysPressedDuringFrame);
+        }
+        break;
+    case sf::Event::KeyReleased:
+        if (const auto inputKey = InputKeySfmlMapper::getInputKey(event.key.code))
+        {
+            releaseKey(*inputKey, eventTimestamp);
+        }
+        break;
+    case sf::Event::MouseButtonPressed:
+        if (const auto inputKey = InputKeySfmlMapper::getInputKey(event.mouseButton.button))
+        {
+            pressKey(*inputKey, eventTimestamp, keysPressedDuringFrame);
+        }
+        break;
+    case sf::Event::MouseButtonReleased:
+        if (const auto inputKey = InputKeySfmlMapper::getInputKey(event.mouseButton.button))
+        {
+            releaseKey(*inputKey, eventTimestamp);
+        }
+        break;
+    case sf::Event::TextEntered:
+        if (event.text.unicode >= firstPrintableCharacter && event.text.unicode <= lastPrintableCharacter)
+        {
+            inputStatus.appendEnteredText(static_cast<char>(event.text.unicode));
+        }
+        break;
+    case sf::Event::LostFocus:
+        heldKeys = 0;
+        break;
+    default:
+        break;
+    }
+}
+
+void DefaultInputManager::pressKey(InputKey inputKey, InputEventTimePoint eventTimestamp,
+                                   InputKeysMask& keysPressedDuringFrame)
+{
+    if (heldKeys & toKeyMask(inputKey))
+    {
+        return;
+    }
+    heldKeys |= toKeyMask(inputKey);
+    keysPressedDuringFrame |= toKeyMask(inputKey);
+    inputEvents.push({InputEventType::KeyPressed, inputKey, eventTimestamp});
+}
+
+void DefaultInputManager::releaseKey(InputKey inputKey, InputEventTimePoint eventTimestamp)
+{
+    heldKeys &= ~toKeyMask(inputKey);
+    inputEvents.push({InputEventType::KeyReleased, inputKey, eventTimestamp});
+}
+
+}
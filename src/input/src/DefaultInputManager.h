@@ -2,10 +2,16 @@
 
 #include <memory>
 
+#include "InputKey.h"
 #include "InputManager.h"
 #include "InputObservationHandler.h"
 #include "Window.h"
 
+namespace sf
+{
+class Event;
+}
+
 namespace input
 {
 class DefaultInputManager : public InputManager
@@ -14,14 +20,20 @@ public:
     explicit DefaultInputManager(std::unique_ptr<InputObservationHandler>, std::shared_ptr<window::Window>);
 
     void readInput() override;
+    const InputEventBuffer& getInputEvents() const override;
     void registerObserver(InputObserver*) override;
     void removeObserver(InputObserver*) override;
 
 private:
     void notifyObservers() override;
+    void handleInputEvent(const sf::Event&, InputEventTimePoint, InputKeysMask& keysPressedDuringFrame);
+    void pressKey(InputKey, InputEventTimePoint, InputKeysMask& keysPressedDuringFrame);
+    void releaseKey(InputKey, InputEventTimePoint);
 
     std::unique_ptr<InputObservationHandler> observationHandler;
     std::shared_ptr<window::Window> window;
     InputStatus inputStatus;
+    InputKeysMask heldKeys;
+    InputEventBuffer inputEvents;
 };
 }
\ No newline at end of file
@@ -12,11 +12,53 @@ using namespace input;
 namespace
 {
 const utils::Vector2f mousePosition{3, 4};
+
+sf::Event createKeyEvent(sf::Event::EventType eventType, sf::Keyboard::Key key)
+{
+    sf::Event event{};
+    event.type = eventType;
+    event.key.code = key;
+    return event;
+}
+
+sf::Event createMouseButtonEvent(sf::Event::EventType eventType, sf::Mouse::Button button)
+{
+    sf::Event event{};
+    event.type = eventType;
+    event.mouseButton.button = button;
+    return event;
+}
+
+sf::Event createTextEvent(std::uint32_t unicode)
+{
+    sf::Event event{};
+    event.type = sf::Event::TextEntered;
+    event.text.unicode = unicode;
+    return event;
+}
 }
 
 class DefaultInputManagerTest : public Test
 {
 public:
+    void expectEvents(const std::vector<sf::Event>& events)
+    {
+        InSequence sequence;
+        for (const auto& event : events)
+        {
+            EXPECT_CALL(*window, pollEvent(_)).WillOnce(DoAll(SetArgReferee<0>(event), Return(true)));
+        }
+        EXPECT_CALL(*window, pollEvent(_)).WillOnce(Return(false));
+    }
+
+    void expectReadInput(const std::vector<sf::Event>& events, const InputStatus& expectedInputStatus)
+    {
+        expectEvents(events);
+        EXPECT_CALL(*window, handleEvent(_)).Times(static_cast<int>(events.size()));
+        EXPECT_CALL(*window, getMousePosition()).WillOnce(Return(mousePosition));
+        EXPECT_CALL(*observationHandler, notifyObservers(expectedInputStatus));
+    }
+
     std::shared_ptr<StrictMock<InputObserverMock>> observer1 =
         std::make_shared<StrictMock<InputObserverMock>>();
     std::shared_ptr<StrictMock<window::WindowMock>> window =
@@ -31,8 +73,84 @@ TEST_F(DefaultInputManagerTest, readInput_shouldReadMousePositionFromWindowAndNo
 {
     InputStatus inputStatus{};
     inputStatus.setMousePosition(mousePosition);
-    EXPECT_CALL(*window, getMousePosition()).WillOnce(Return(mousePosition));
-    EXPECT_CALL(*observationHandler, notifyObservers(inputStatus));
+    expectReadInput({}, inputStatus);
+
+    inputManager.readInput();
+}
+
+TEST_F(DefaultInputManagerTest, readInput_shouldSetKeysPressedFromKeyAndMouseEventsAndForwardEventsToWindow)
+{
+    InputStatus inputStatus{};
+    inputStatus.setKeyPressed(InputKey::A);
+    inputStatus.setKeyPressed(InputKey::MouseLeft);
+    inputStatus.setReleasedKeys();
+    inputStatus.setMousePosition(mousePosition);
+    expectReadInput({createKeyEvent(sf::Event::KeyPressed, sf::Keyboard::A),
+                     createMouseButtonEvent(sf::Event::MouseButtonPressed, sf::Mouse::Left)},
+                    inputStatus);
+
+    inputManager.readInput();
+}
+
+TEST_F(DefaultInputManagerTest, heldKey_shouldStayPressedUntilKeyReleasedEvent)
+{
+    InputStatus inputStatus{};
+    inputStatus.setKeyPressed(InputKey::Space);
+    inputStatus.setReleasedKeys();
+    inputStatus.setMousePosition(mousePosition);
+    expectReadInput({createKeyEvent(sf::Event::KeyPressed, sf::Keyboard::Space)}, inputStatus);
+    inputManager.readInput();
+    inputStatus.setReleasedKeys();
+    expectReadInput({}, inputStatus);
+    inputManager.readInput();
+    inputStatus.clearPressedKeys();
+    inputStatus.setReleasedKeys();
+    expectReadInput({createKeyEvent(sf::Event::KeyReleased, sf::Keyboard::Space)}, inputStatus);
+
+    inputManager.readInput();
+}
+
+TEST_F(DefaultInputManagerTest, keyPressedAndReleasedWithinOneFrame_shouldBePressedAndReleasedInNextFrame)
+{
+    InputStatus inputStatus{};
+    inputStatus.setKeyPressed(InputKey::Enter);
+    inputStatus.setReleasedKeys();
+    inputStatus.setMousePosition(mousePosition);
+    expectReadInput({createKeyEvent(sf::Event::KeyPressed, sf::Keyboard::Enter),
+                     createKeyEvent(sf::Event::KeyReleased, sf::Keyboard::Enter)},
+                    inputStatus);
+    inputManager.readInput();
+    inputStatus.clearPressedKeys();
+    inputStatus.setReleasedKeys();
+    expectReadInput({}, inputStatus);
+
+    inputManager.readInput();
+}
+
+TEST_F(DefaultInputManagerTest, readInput_shouldSetPrintableEnteredText)
+{
+    InputStatus inputStatus{};
+    inputStatus.appendEnteredText('a');
+    inputStatus.appendEnteredText('1');
+    inputStatus.setMousePosition(mousePosition);
+    expectReadInput({createTextEvent('a'), createTextEvent('\b'), createTextEvent('1')}, inputStatus);
+
+    inputManager.readInput();
+}
+
+TEST_F(DefaultInputManagerTest, lostFocus_shouldReleaseHeldKeys)
+{
+    InputStatus inputStatus{};
+    inputStatus.setKeyPressed(InputKey::Left);
+    inputStatus.setReleasedKeys();
+    inputStatus.setMousePosition(mousePosition);
+    expectReadInput({createKeyEvent(sf::Event::KeyPressed, sf::Keyboard::Left)}, inputStatus);
+    inputManager.readInput();
+    sf::Event lostFocusEvent{};
+    lostFocusEvent.type = sf::Event::LostFocus;
+    inputStatus.clearPressedKeys();
+    inputStatus.setReleasedKeys();
+    expectReadInput({lostFocusEvent}, inputStatus);
 
     inputManager.readInput();
 }
@@ -50,3 +168,31 @@ TEST_F(DefaultInputManagerTest, shouldRemoveObserver)
 
     inputManager.removeObserver(observer1.get());
 }
+
+TEST_F(DefaultInputManagerTest, readInput_shouldRecordTimestampedKeyEventsInOrderAndIgnoreKeyRepeats)
+{
+    InputStatus inputStatus{};
+    inputStatus.setKeyPressed(InputKey::W);
+    inputStatus.setKeyPressed(InputKey::MouseRight);
+    inputStatus.setReleasedKeys();
+    inputStatus.setMousePosition(mousePosition);
+    expectReadInput({createKeyEvent(sf::Event::KeyPressed, sf::Keyboard::W),
+                     createKeyEvent(sf::Event::KeyPressed, sf::Keyboard::W),
+                     createMouseButtonEvent(sf::Event::MouseButtonPressed, sf::Mouse::Right),
+                     createKeyEvent(sf::Event::KeyReleased, sf::Keyboard::W)},
+                    inputStatus);
+    const auto timeBeforeReadingInput = InputEventClock::now();
+
+    inputManager.readInput();
+
+    const auto& inputEvents = inputManager.getInputEvents();
+    ASSERT_EQ(inputEvents.size(), 3u);
+    ASSERT_EQ(inputEvents[0].type, InputEventType::KeyPressed);
+    ASSERT_EQ(inputEvents[0].key, InputKey::W);
+    ASSERT_EQ(inputEvents[1].key, InputKey::MouseRight);
+    ASSERT_EQ(inputEvents[2].type, InputEventType::KeyReleased);
+    ASSERT_EQ(inputEvents[2].key, InputKey::W);
+    ASSERT_GE(inputEvents[0].timestamp, timeBeforeReadingInput);
+    ASSERT_LE(inputEvents[0].timestamp, inputEvents[1].timestamp);
+    ASSERT_LE(inputEvents[1].timestamp, inputEvents[2].timestamp);
+}
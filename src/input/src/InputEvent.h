@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <tuple>
+
+#include "InputKey.h"
+
+namespace input
+{
+enum class InputEventType
+{
+    KeyPressed,
+    KeyReleased
+};
+
+using InputEventClock = std::chrono::steady_clock;
+using InputEventTimePoint = InputEventClock::time_point;
+
+struct InputEvent
+{
+    InputEventType type;
+    InputKey key;
+    InputEventTimePoint timestamp;
+};
+
+inline bool operator==(const InputEvent& lhs, const InputEvent& rhs)
+{
+    auto tieStruct = [](const InputEvent& inputEvent) {
+        return std::tie(inputEvent.type, inputEvent.key, inputEvent.timestamp);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const InputEvent& inputEvent)
+{
+    return os << (inputEvent.type == InputEventType::KeyPressed ? "KeyPressed " : "KeyReleased ")
+              << inputEvent.key << " at: " << inputEvent.timestamp.time_since_epoch().count() << "ns";
+}
+}
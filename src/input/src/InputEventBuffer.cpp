@@ -0,0 +1,57 @@
+#include "InputEventBuffer.h"
+
+namespace input
+{
+
+InputEventBuffer::InputEventBuffer(std::size_t capacity)
+    : events(capacity), oldestEventIndex{0}, numberOfEvents{0}, numberOfPushedEvents{0}
+{
+}
+
+void InputEventBuffer::push(const InputEvent& inputEvent)
+{
+    if (events.empty())
+    {
+        return;
+    }
+
+    const auto newEventIndex = (oldestEventIndex + numberOfEvents) % events.size();
+    events[newEventIndex] = inputEvent;
+    if (numberOfEvents < events.size())
+    {
+        numberOfEvents++;
+    }
+    else
+    {
+        oldestEventIndex = (oldestEventIndex + 1) % events.size();
+    }
+    numberOfPushedEvents++;
+}
+
+void InputEventBuffer::clear()
+{
+    oldestEventIndex = 0;
+    numberOfEvents = 0;
+}
+
+const InputEvent& InputEventBuffer::operator[](std::size_t index) const
+{
+    return events[(oldestEventIndex + index) % events.size()];
+}
+
+std::size_t InputEventBuffer::size() const
+{
+    return numberOfEvents;
+}
+
+std::size_t InputEventBuffer::capacity() const
+{
+    return events.size();
+}
+
+std::uint64_t InputEventBuffer::getNumberOfPushedEvents() const
+{
+    return numberOfPushedEvents;
+}
+
+}
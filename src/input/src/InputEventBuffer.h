@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "InputEvent.h"
+
+namespace input
+{
+class InputEventBuffer
+{
+public:
+    explicit InputEventBuffer(std::size_t capacity);
+
+    void push(const InputEvent&);
+    void clear();
+    const InputEvent& operator[](std::size_t index) const;
+    std::size_t size() const;
+    std::size_t capacity() const;
+    std::uint64_t getNumberOfPushedEvents() const;
+
+private:
+    std::vector<InputEvent> events;
+    std::size_t oldestEventIndex;
+    std::size_t numberOfEvents;
+    std::uint64_t numberOfPushedEvents;
+};
+}
@@ -0,0 +1,66 @@
+#include "InputEventBuffer.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace input;
+
+class InputEventBufferTest : public Test
+{
+public:
+    InputEvent createInputEvent(InputKey key, int timestampInMilliseconds) const
+    {
+        return {InputEventType::KeyPressed, key,
+                InputEventTimePoint{std::chrono::milliseconds{timestampInMilliseconds}}};
+    }
+
+    const InputEvent event1{createInputEvent(InputKey::A, 1)};
+    const InputEvent event2{createInputEvent(InputKey::B, 2)};
+    const InputEvent event3{createInputEvent(InputKey::C, 3)};
+    const InputEvent event4{createInputEvent(InputKey::D, 4)};
+    InputEventBuffer inputEventBuffer{3};
+};
+
+TEST_F(InputEventBufferTest, initialBuffer_shouldBeEmpty)
+{
+    ASSERT_EQ(inputEventBuffer.size(), 0u);
+    ASSERT_EQ(inputEventBuffer.capacity(), 3u);
+    ASSERT_EQ(inputEventBuffer.getNumberOfPushedEvents(), 0u);
+}
+
+TEST_F(InputEventBufferTest, pushedEvents_shouldBeReturnedFromOldest)
+{
+    inputEventBuffer.push(event1);
+    inputEventBuffer.push(event2);
+
+    ASSERT_EQ(inputEventBuffer.size(), 2u);
+    ASSERT_EQ(inputEventBuffer[0], event1);
+    ASSERT_EQ(inputEventBuffer[1], event2);
+}
+
+TEST_F(InputEventBufferTest, givenFullBuffer_shouldOverwriteOldestEvent)
+{
+    inputEventBuffer.push(event1);
+    inputEventBuffer.push(event2);
+    inputEventBuffer.push(event3);
+
+    inputEventBuffer.push(event4);
+
+    ASSERT_EQ(inputEventBuffer.size(), 3u);
+    ASSERT_EQ(inputEventBuffer[0], event2);
+    ASSERT_EQ(inputEventBuffer[2], event4);
+    ASSERT_EQ(inputEventBuffer.getNumberOfPushedEvents(), 4u);
+}
+
+TEST_F(InputEventBufferTest, clear_shouldRemoveEventsAndKeepNumberOfPushedEvents)
+{
+    inputEventBuffer.push(event1);
+    inputEventBuffer.push(event2);
+
+    inputEventBuffer.clear();
+    inputEventBuffer.push(event3);
+
+    ASSERT_EQ(inputEventBuffer.size(), 1u);
+    ASSERT_EQ(inputEventBuffer[0], event3);
+    ASSERT_EQ(inputEventBuffer.getNumberOfPushedEvents(), 3u);
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <ostream>
 #include <string>
 #include <unordered_map>
@@ -18,6 +21,7 @@ enum class InputKey
     Right,
     Space,
     Shift,
+    Control,
     Enter,
     Escape,
     Backspace,
@@ -58,12 +62,54 @@ enum class InputKey
     V,
     B,
     N,
-    M
+    M,
+    F3,
+    F4
 };
 
+using InputKeysMask = std::uint64_t;
+
+constexpr std::size_t numberOfInputKeys{static_cast<std::size_t>(InputKey::F4) + 1};
+static_assert(numberOfInputKeys <= 64, "Input keys do not fit in InputKeysMask");
+
+constexpr std::size_t toKeyIndex(InputKey inputKey)
+{
+    return static_cast<std::size_t>(inputKey);
+}
+
+constexpr InputKeysMask toKeyMask(InputKey inputKey)
+{
+    return InputKeysMask{1} << toKeyIndex(inputKey);
+}
+
+constexpr InputKeysMask toKeysMask(std::initializer_list<InputKey> inputKeys)
+{
+    InputKeysMask keysMask{0};
+    for (const auto inputKey : inputKeys)
+    {
+        keysMask |= toKeyMask(inputKey);
+    }
+    return keysMask;
+}
+
+constexpr InputKeysMask toKeysMask(InputKey firstInputKey, InputKey lastInputKey)
+{
+    InputKeysMask keysMask{0};
+    for (auto keyIndex = toKeyIndex(firstInputKey); keyIndex <= toKeyIndex(lastInputKey); keyIndex++)
+    {
+        keysMask |= InputKeysMask{1} << keyIndex;
+    }
+    return keysMask;
+}
+
+constexpr InputKeysMask allKeysMask{toKeysMask(InputKey::Up, InputKey::F4)};
+constexpr InputKeysMask mouseButtonsMask{toKeysMask({InputKey::MouseLeft, InputKey::MouseRight})};
+constexpr InputKeysMask keyboardButtonsMask{allKeysMask & ~mouseButtonsMask};
+constexpr InputKeysMask alphaNumericalButtonsMask{toKeysMask(InputKey::Number0, InputKey::M)};
+
 const std::vector<InputKey> allKeys{
     InputKey::Up,      InputKey::Down,    InputKey::Left,    InputKey::Right,     InputKey::Space,
-    InputKey::Shift,   InputKey::Enter,   InputKey::Escape, InputKey::Backspace, InputKey::MouseLeft, InputKey::MouseRight,
+    InputKey::Shift,   InputKey::Control, InputKey::Enter,   InputKey::Escape, InputKey::Backspace, InputKey::MouseLeft, InputKey::MouseRight,
     InputKey::Number0, InputKey::Number1, InputKey::Number2, InputKey::Number3,   InputKey::Number4,
     InputKey::Number5, InputKey::Number6, InputKey::Number7, InputKey::Number8,   InputKey::Number9,
     InputKey::Q,       InputKey::W,       InputKey::E,       InputKey::R,         InputKey::T,
@@ -71,18 +117,19 @@ const std::vector<InputKey> allKeys{
     InputKey::A,       InputKey::S,       InputKey::D,       InputKey::F,         InputKey::G,
     InputKey::H,       InputKey::J,       InputKey::K,       InputKey::L,         InputKey::Z,
     InputKey::X,       InputKey::C,       InputKey::V,       InputKey::B,         InputKey::N,
-    InputKey::M};
+    InputKey::M,       InputKey::F3,      InputKey::F4};
 
 const std::vector<InputKey> keyboardButtons{
     InputKey::Up,      InputKey::Down,    InputKey::Left,    InputKey::Right,   InputKey::Space,
-    InputKey::Shift,   InputKey::Enter,   InputKey::Escape,  InputKey::Backspace, InputKey::Number0, InputKey::Number1,
+    InputKey::Shift,   InputKey::Control, InputKey::Enter,   InputKey::Escape,  InputKey::Backspace, InputKey::Number0, InputKey::Number1,
     InputKey::Number2, InputKey::Number3, InputKey::Number4, InputKey::Number5, InputKey::Number6,
     InputKey::Number7, InputKey::Number8, InputKey::Number9, InputKey::Q,       InputKey::W,
     InputKey::E,       InputKey::R,       InputKey::T,       InputKey::Y,       InputKey::U,
     InputKey::I,       InputKey::O,       InputKey::P,       InputKey::A,       InputKey::S,
     InputKey::D,       InputKey::F,       InputKey::G,       InputKey::H,       InputKey::J,
     InputKey::K,       InputKey::L,       InputKey::Z,       InputKey::X,       InputKey::C,
-    InputKey::V,       InputKey::B,       InputKey::N,       InputKey::M};
+    InputKey::V,       InputKey::B,       InputKey::N,       InputKey::M,       InputKey::F3,
+    InputKey::F4};
 
 const std::vector<InputKey> alphaNumericalButtons{
     InputKey::Number0, InputKey::Number1, InputKey::Number2, InputKey::Number3, InputKey::Number4,
@@ -98,53 +145,57 @@ const std::vector<InputKey> mouseButtons{InputKey::MouseLeft, InputKey::MouseRig
 
 inline std::string toString(InputKey inputKey)
 {
-    std::unordered_map<InputKey, std::string> inputKeyToString{{InputKey::Up, "Up"},
-                                                               {InputKey::Down, "Down"},
-                                                               {InputKey::Left, "Left"},
-                                                               {InputKey::Right, "Right"},
-                                                               {InputKey::Space, "Space"},
-                                                               {InputKey::Shift, "Shift"},
-                                                               {InputKey::Enter, "Enter"},
-                                                               {InputKey::Escape, "Escape"},
-                                                               {InputKey::Backspace, "Backspace"},
-                                                               {InputKey::MouseLeft, "MouseLeft"},
-                                                               {InputKey::MouseRight, "MouseRight"},
-                                                               {InputKey::Number0, "0"},
-                                                               {InputKey::Number1, "1"},
-                                                               {InputKey::Number2, "2"},
-                                                               {InputKey::Number3, "3"},
-                                                               {InputKey::Number4, "4"},
-                                                               {InputKey::Number5, "5"},
-                                                               {InputKey::Number6, "6"},
-                                                               {InputKey::Number7, "7"},
-                                                               {InputKey::Number8, "8"},
-                                                               {InputKey::Number9, "9"},
-                                                               {InputKey::Q, "Q"},
-                                                               {InputKey::W, "W"},
-                                                               {InputKey::E, "E"},
-                                                               {InputKey::R, "R"},
-                                                               {InputKey::T, "T"},
-                                                               {InputKey::Y, "Y"},
-                                                               {InputKey::U, "U"},
-                                                               {InputKey::I, "I"},
-                                                               {InputKey::O, "O"},
-                                                               {InputKey::P, "P"},
-                                                               {InputKey::A, "A"},
-                                                               {InputKey::S, "S"},
-                                                               {InputKey::D, "D"},
-                                                               {InputKey::F, "F"},
-                                                               {InputKey::G, "G"},
-                                                               {InputKey::H, "H"},
-                                                               {InputKey::J, "J"},
-                                                               {InputKey::K, "K"},
-                                                               {InputKey::L, "L"},
-                                                               {InputKey::Z, "Z"},
-                                                               {InputKey::X, "X"},
-                                                               {InputKey::C, "C"},
-                                                               {InputKey::V, "V"},
-                                                               {InputKey::B, "B"},
-                                                               {InputKey::N, "N"},
-                                                               {InputKey::M, "M"}};
+    static const std::unordered_map<InputKey, std::string> inputKeyToString{
+        {InputKey::Up, "Up"},
+        {InputKey::Down, "Down"},
+        {InputKey::Left, "Left"},
+        {InputKey::Right, "Right"},
+        {InputKey::Space, "Space"},
+        {InputKey::Shift, "Shift"},
+        {InputKey::Control, "Control"},
+        {InputKey::Enter, "Enter"},
+        {InputKey::Escape, "Escape"},
+        {InputKey::Backspace, "Backspace"},
+        {InputKey::MouseLeft, "MouseLeft"},
+        {InputKey::MouseRight, "MouseRight"},
+        {InputKey::Number0, "0"},
+        {InputKey::Number1, "1"},
+        {InputKey::Number2, "2"},
+        {InputKey::Number3, "3"},
+        {InputKey::Number4, "4"},
+        {InputKey::Number5, "5"},
+        {InputKey::Number6, "6"},
+        {InputKey::Number7, "7"},
+        {InputKey::Number8, "8"},
+        {InputKey::Number9, "9"},
+        {InputKey::Q, "Q"},
+        {InputKey::W, "W"},
+        {InputKey::E, "E"},
+        {InputKey::R, "R"},
+        {InputKey::T, "T"},
+        {InputKey::Y, "Y"},
+        {InputKey::U, "U"},
+        {InputKey::I, "I"},
+        {InputKey::O, "O"},
+        {InputKey::P, "P"},
+        {InputKey::A, "A"},
+        {InputKey::S, "S"},
+        {InputKey::D, "D"},
+        {InputKey::F, "F"},
+        {InputKey::G, "G"},
+        {InputKey::H, "H"},
+        {InputKey::J, "J"},
+        {InputKey::K, "K"},
+        {InputKey::L, "L"},
+        {InputKey::Z, "Z"},
+        {InputKey::X, "X"},
+        {InputKey::C, "C"},
+        {InputKey::V, "V"},
+        {InputKey::B, "B"},
+        {InputKey::N, "N"},
+        {InputKey::M, "M"},
+        {InputKey::F3, "F3"},
+        {InputKey::F4, "F4"}};
 
     try
     {
@@ -160,53 +211,57 @@ inline InputKey toInputKey(const std::string& inputKeyAsString)
 {
     const auto inputKeyLowerString = utils::getLowerCases(inputKeyAsString);
 
-    std::unordered_map<std::string, InputKey> stringToInputKey{{"up", InputKey::Up},
-                                                               {"down", InputKey::Down},
-                                                               {"left", InputKey::Left},
-                                                               {"right", InputKey::Right},
-                                                               {"space", InputKey::Space},
-                                                               {"shift", InputKey::Shift},
-                                                               {"enter", InputKey::Enter},
-                                                               {"escape", InputKey::Escape},
-                                                               {"backspace", InputKey::Backspace},
-                                                               {"mouseleft", InputKey::MouseLeft},
-                                                               {"mouseright", InputKey::MouseRight},
-                                                               {"0", InputKey::Number0},
-                                                               {"1", InputKey::Number1},
-                                                               {"2", InputKey::Number2},
-                                                               {"3", InputKey::Number3},
-                                                               {"4", InputKey::Number4},
-                                                               {"5", InputKey::Number5},
-                                                               {"6", InputKey::Number6},
-                                                               {"7", InputKey::Number7},
-                                                               {"8", InputKey::Number8},
-                                                               {"9", InputKey::Number9},
-                                                               {"q", InputKey::Q},
-                                                               {"w", InputKey::W},
-                                                               {"e", InputKey::E},
-                                                               {"r", InputKey::R},
-                                                               {"t", InputKey::T},
-                                                               {"y", InputKey::Y},
-                                                               {"u", InputKey::U},
-                                                               {"i", InputKey::I},
-                                                               {"o", InputKey::O},
-                                                               {"p", InputKey::P},
-                                                               {"a", InputKey::A},
-                                                               {"s", InputKey::S},
-                                                               {"d", InputKey::D},
-                                                               {"f", InputKey::F},
-                                                               {"g", InputKey::G},
-                                                               {"h", InputKey::H},
-                                                               {"j", InputKey::J},
-                                                               {"k", InputKey::K},
-                                                               {"l", InputKey::L},
-                                                               {"z", InputKey::Z},
-                                                               {"x", InputKey::X},
-                                                               {"c", InputKey::C},
-                                                               {"v", InputKey::V},
-                                                               {"b", InputKey::B},
-                                                               {"n", InputKey::N},
-                                                               {"m", InputKey::M}};
+    static const std::unordered_map<std::string, InputKey> stringToInputKey{
+        {"up", InputKey::Up},
+        {"down", InputKey::Down},
+        {"left", InputKey::Left},
+        {"right", InputKey::Right},
+        {"space", InputKey::Space},
+        {"shift", InputKey::Shift},
+        {"control", InputKey::Control},
+        {"enter", InputKey::Enter},
+        {"escape", InputKey::Escape},
+        {"backspace", InputKey::Backspace},
+        {"mouseleft", InputKey::MouseLeft},
+        {"mouseright", InputKey::MouseRight},
+        {"0", InputKey::Number0},
+        {"1", InputKey::Number1},
+        {"2", InputKey::Number2},
+        {"3", InputKey::Number3},
+        {"4", InputKey::Number4},
+        {"5", InputKey::Number5},
+        {"6", InputKey::Number6},
+        {"7", InputKey::Number7},
+        {"8", InputKey::Number8},
+        {"9", InputKey::Number9},
+        {"q", InputKey::Q},
+        {"w", InputKey::W},
+        {"e", InputKey::E},
+        {"r", InputKey::R},
+        {"t", InputKey::T},
+        {"y", InputKey::Y},
+        {"u", InputKey::U},
+        {"i", InputKey::I},
+        {"o", InputKey::O},
+        {"p", InputKey::P},
+        {"a", InputKey::A},
+        {"s", InputKey::S},
+        {"d", InputKey::D},
+        {"f", InputKey::F},
+        {"g", InputKey::G},
+        {"h", InputKey::H},
+        {"j", InputKey::J},
+        {"k", InputKey::K},
+        {"l", InputKey::L},
+        {"z", InputKey::Z},
+        {"x", InputKey::X},
+        {"c", InputKey::C},
+        {"v", InputKey::V},
+        {"b", InputKey::B},
+        {"n", InputKey::N},
+        {"m", InputKey::M},
+        {"f3", InputKey::F3},
+        {"f4", InputKey::F4}};
 
     try
     {
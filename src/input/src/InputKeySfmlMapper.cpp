@@ -4,6 +4,19 @@
 
 namespace input
 {
+namespace
+{
+template <typename SfmlKey>
+std::unordered_map<SfmlKey, InputKey> invert(const std::unordered_map<InputKey, SfmlKey>& inputKeys)
+{
+    std::unordered_map<SfmlKey, InputKey> sfmlKeys;
+    for (const auto& [inputKey, sfmlKey] : inputKeys)
+    {
+        sfmlKeys.insert({sfmlKey, inputKey});
+    }
+    return sfmlKeys;
+}
+}
 
 std::unordered_map<InputKey, sf::Keyboard::Key> InputKeySfmlMapper::keyboardKeys{
     {InputKey::Up, sf::Keyboard::Up},
@@ -12,6 +25,7 @@ std::unordered_map<InputKey, sf::Keyboard::Key> InputKeySfmlMapper::keyboardKeys
     {InputKey::Right, sf::Keyboard::Right},
     {InputKey::Space, sf::Keyboard::Space},
     {InputKey::Shift, sf::Keyboard::LShift},
+    {InputKey::Control, sf::Keyboard::LControl},
     {InputKey::Enter, sf::Keyboard::Enter},
     {InputKey::Escape, sf::Keyboard::Escape},
     {InputKey::Backspace, sf::Keyboard::Backspace},
@@ -50,11 +64,17 @@ std::unordered_map<InputKey, sf::Keyboard::Key> InputKeySfmlMapper::keyboardKeys
     {InputKey::V, sf::Keyboard::V},
     {InputKey::B, sf::Keyboard::B},
     {InputKey::N, sf::Keyboard::N},
-    {InputKey::M, sf::Keyboard::M}};
+    {InputKey::M, sf::Keyboard::M},
+    {InputKey::F3, sf::Keyboard::F3},
+    {InputKey::F4, sf::Keyboard::F4}};
 
 std::unordered_map<InputKey, sf::Mouse::Button> InputKeySfmlMapper::mouseKeys{
     {InputKey::MouseRight, sf::Mouse::Right}, {InputKey::MouseLeft, sf::Mouse::Left}};
 
+std::unordered_map<sf::Keyboard::Key, InputKey> InputKeySfmlMapper::sfmlKeyboardKeys{invert(keyboardKeys)};
+
+std::unordered_map<sf::Mouse::Button, InputKey> InputKeySfmlMapper::sfmlMouseKeys{invert(mouseKeys)};
+
 sf::Keyboard::Key InputKeySfmlMapper::getKeyboardSfmlKey(InputKey inputKey)
 {
     try
@@ -79,4 +99,22 @@ sf::Mouse::Button InputKeySfmlMapper::getMouseSfmlKey(InputKey inputKey)
     }
 }
 
+boost::optional<InputKey> InputKeySfmlMapper::getInputKey(sf::Keyboard::Key sfmlKey)
+{
+    if (const auto inputKeyIter = sfmlKeyboardKeys.find(sfmlKey); inputKeyIter != sfmlKeyboardKeys.end())
+    {
+        return inputKeyIter->second;
+    }
+    return boost::none;
+}
+
+boost::optional<InputKey> InputKeySfmlMapper::getInputKey(sf::Mouse::Button sfmlKey)
+{
+    if (const auto inputKeyIter = sfmlMouseKeys.find(sfmlKey); inputKeyIter != sfmlMouseKeys.end())
+    {
+        return inputKeyIter->second;
+    }
+    return boost::none;
+}
+
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Mouse.hpp>
+#include <boost/optional.hpp>
 #include <unordered_map>
 
 #include "InputKey.h"
@@ -13,9 +14,13 @@ class InputKeySfmlMapper
 public:
     static sf::Keyboard::Key getKeyboardSfmlKey(InputKey);
     static sf::Mouse::Button getMouseSfmlKey(InputKey);
+    static boost::optional<InputKey> getInputKey(sf::Keyboard::Key);
+    static boost::optional<InputKey> getInputKey(sf::Mouse::Button);
 
 private:
     static std::unordered_map<InputKey, sf::Keyboard::Key> keyboardKeys;
     static std::unordered_map<InputKey, sf::Mouse::Button> mouseKeys;
+    static std::unordered_map<sf::Keyboard::Key, InputKey> sfmlKeyboardKeys;
+    static std::unordered_map<sf::Mouse::Button, InputKey> sfmlMouseKeys;
 };
 }
\ No newline at end of file
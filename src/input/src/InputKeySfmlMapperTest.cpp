@@ -41,4 +41,18 @@ TEST_F(InputKeySfmlMapperTest, givenValidMouseKey_shouldReturnSfmlEquivalent)
 {
     ASSERT_EQ(InputKeySfmlMapper::getMouseSfmlKey(mouseKey1), mouseKey1Mapped);
     ASSERT_EQ(InputKeySfmlMapper::getMouseSfmlKey(mouseKey2), mouseKey2Mapped);
-}
\ No newline at end of file
+}
+
+TEST_F(InputKeySfmlMapperTest, givenMappedSfmlKeys_shouldReturnInputKeys)
+{
+    ASSERT_EQ(InputKeySfmlMapper::getInputKey(keyboardKey1Mapped), keyboardKey1);
+    ASSERT_EQ(InputKeySfmlMapper::getInputKey(keyboardKey2Mapped), keyboardKey2);
+    ASSERT_EQ(InputKeySfmlMapper::getInputKey(mouseKey1Mapped), mouseKey1);
+    ASSERT_EQ(InputKeySfmlMapper::getInputKey(mouseKey2Mapped), mouseKey2);
+}
+
+TEST_F(InputKeySfmlMapperTest, givenNotMappedSfmlKeys_shouldReturnNone)
+{
+    ASSERT_FALSE(InputKeySfmlMapper::getInputKey(sf::Keyboard::Key::F1));
+    ASSERT_FALSE(InputKeySfmlMapper::getInputKey(sf::Mouse::Button::Middle));
+}
@@ -49,3 +49,21 @@ TEST_F(InputKeyTest, givenAllKeys_shouldReturnTheSameInputKeysAfterReadingString
         ASSERT_EQ(toInputKey(toString(key)), key);
     }
 }
+
+TEST_F(InputKeyTest, keysMasks_shouldContainExactlyKeysFromCorrespondingKeyLists)
+{
+    const auto toMask = [](const std::vector<InputKey>& keys) {
+        InputKeysMask keysMask{0};
+        for (const auto& key : keys)
+        {
+            keysMask |= toKeyMask(key);
+        }
+        return keysMask;
+    };
+
+    ASSERT_EQ(allKeys.size(), numberOfInputKeys);
+    ASSERT_EQ(allKeysMask, toMask(allKeys));
+    ASSERT_EQ(keyboardButtonsMask, toMask(keyboardButtons));
+    ASSERT_EQ(alphaNumericalButtonsMask, toMask(alphaNumericalButtons));
+    ASSERT_EQ(mouseButtonsMask, toMask(mouseButtons));
+}
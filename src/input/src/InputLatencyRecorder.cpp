@@ -0,0 +1,45 @@
+#include "InputLatencyRecorder.h"
+
+namespace input
+{
+
+void InputLatencyRecorder::framePresented(const InputEventBuffer& inputEvents,
+                                          InputEventTimePoint presentationTime)
+{
+    const auto numberOfNewEvents = inputEvents.getNumberOfPushedEvents() - numberOfProcessedEvents;
+    const auto firstNewEventIndex =
+        numberOfNewEvents < inputEvents.size() ? inputEvents.size() - numberOfNewEvents : 0;
+
+    for (auto eventIndex = firstNewEventIndex; eventIndex < inputEvents.size(); eventIndex++)
+    {
+        const auto& inputEvent = inputEvents[eventIndex];
+        samples.push_back({inputEvent, numberOfPresentedFrames, presentationTime - inputEvent.timestamp});
+    }
+
+    numberOfProcessedEvents = inputEvents.getNumberOfPushedEvents();
+    numberOfPresentedFrames++;
+}
+
+const std::vector<InputLatencySample>& InputLatencyRecorder::getSamples() const
+{
+    return samples;
+}
+
+std::uint64_t InputLatencyRecorder::getNumberOfPresentedFrames() const
+{
+    return numberOfPresentedFrames;
+}
+
+void InputLatencyRecorder::exportToCsv(std::ostream& os) const
+{
+    os << "frame,event,key,latencyMicroseconds\n";
+    for (const auto& sample : samples)
+    {
+        os << sample.frameNumber << ","
+           << (sample.inputEvent.type == InputEventType::KeyPressed ? "pressed" : "released") << ","
+           << toString(sample.inputEvent.key) << ","
+           << std::chrono::duration_cast<std::chrono::microseconds>(sample.latency).count() << "\n";
+    }
+}
+
+}
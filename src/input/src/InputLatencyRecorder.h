@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "InputEventBuffer.h"
+
+namespace input
+{
+struct InputLatencySample
+{
+    InputEvent inputEvent;
+    std::uint64_t frameNumber;
+    std::chrono::nanoseconds latency;
+};
+
+// Latency is measured from the event timestamp to frame presentation. DefaultInputManager stamps events
+// when it drains the window event queue in readInput, not when the OS delivered them, so time an event
+// waited in the queue before that frame's readInput is not included.
+class InputLatencyRecorder
+{
+public:
+    void framePresented(const InputEventBuffer&, InputEventTimePoint presentationTime);
+    const std::vector<InputLatencySample>& getSamples() const;
+    std::uint64_t getNumberOfPresentedFrames() const;
+    void exportToCsv(std::ostream&) const;
+
+private:
+    std::uint64_t numberOfProcessedEvents{0};
+    std::uint64_t numberOfPresentedFrames{0};
+    std::vector<InputLatencySample> samples;
+};
+}
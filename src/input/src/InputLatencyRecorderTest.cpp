@@ -0,0 +1,73 @@
+#include "InputLatencyRecorder.h"
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace input;
+
+namespace
+{
+InputEventTimePoint toTimePoint(int milliseconds)
+{
+    return InputEventTimePoint{std::chrono::milliseconds{milliseconds}};
+}
+}
+
+class InputLatencyRecorderTest : public Test
+{
+public:
+    const InputEvent pressedEvent{InputEventType::KeyPressed, InputKey::Space, toTimePoint(10)};
+    const InputEvent releasedEvent{InputEventType::KeyReleased, InputKey::Space, toTimePoint(14)};
+    InputEventBuffer inputEvents{2};
+    InputLatencyRecorder inputLatencyRecorder;
+};
+
+TEST_F(InputLatencyRecorderTest, givenNoEvents_shouldOnlyCountPresentedFrames)
+{
+    inputLatencyRecorder.framePresented(inputEvents, toTimePoint(16));
+
+    ASSERT_TRUE(inputLatencyRecorder.getSamples().empty());
+    ASSERT_EQ(inputLatencyRecorder.getNumberOfPresentedFrames(), 1u);
+}
+
+TEST_F(InputLatencyRecorderTest, shouldRecordLatencyFromEventToFramePresentationOnlyOnce)
+{
+    inputEvents.push(pressedEvent);
+    inputLatencyRecorder.framePresented(inputEvents, toTimePoint(16));
+    inputEvents.push(releasedEvent);
+
+    inputLatencyRecorder.framePresented(inputEvents, toTimePoint(33));
+
+    const auto& samples = inputLatencyRecorder.getSamples();
+    ASSERT_EQ(samples.size(), 2u);
+    ASSERT_EQ(samples[0].inputEvent, pressedEvent);
+    ASSERT_EQ(samples[0].frameNumber, 0u);
+    ASSERT_EQ(samples[0].latency, std::chrono::milliseconds{6});
+    ASSERT_EQ(samples[1].inputEvent, releasedEvent);
+    ASSERT_EQ(samples[1].frameNumber, 1u);
+    ASSERT_EQ(samples[1].latency, std::chrono::milliseconds{19});
+}
+
+TEST_F(InputLatencyRecorderTest, givenMoreNewEventsThanBufferCapacity_shouldRecordOnlyBufferedEvents)
+{
+    inputEvents.push(pressedEvent);
+    inputEvents.push(releasedEvent);
+    inputEvents.push(pressedEvent);
+
+    inputLatencyRecorder.framePresented(inputEvents, toTimePoint(20));
+
+    ASSERT_EQ(inputLatencyRecorder.getSamples().size(), 2u);
+}
+
+TEST_F(InputLatencyRecorderTest, shouldExportSamplesToCsv)
+{
+    inputEvents.push(pressedEvent);
+    inputLatencyRecorder.framePresented(inputEvents, toTimePoint(16));
+    std::stringstream csv;
+
+    inputLatencyRecorder.exportToCsv(csv);
+
+    ASSERT_EQ(csv.str(), "frame,event,key,latencyMicroseconds\n0,pressed,Space,6000\n");
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "InputEventBuffer.h"
 #include "ObservableInput.h"
 
 namespace input
@@ -10,5 +11,6 @@ public:
     virtual ~InputManager() = default;
 
     virtual void readInput() = 0;
+    virtual const InputEventBuffer& getInputEvents() const = 0;
 };
 }
\ No newline at end of file
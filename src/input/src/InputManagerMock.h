@@ -10,6 +10,7 @@ class InputManagerMock : public InputManager
 {
 public:
     MOCK_METHOD(void, readInput, (), (override));
+    MOCK_METHOD(const InputEventBuffer&, getInputEvents, (), (const override));
     MOCK_METHOD(void, registerObserver, (InputObserver*), (override));
     MOCK_METHOD(void, removeObserver, (InputObserver*), (override));
     MOCK_METHOD(void, notifyObservers, (), (override));
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "InputKey.h"
+#include "StlOperators.h"
+#include "Vector.h"
+
+namespace input
+{
+struct InputSnapshot
+{
+    InputKeysMask pressedKeys;
+    utils::Vector2f mousePosition;
+    std::string enteredText;
+    float deltaTimeInSeconds;
+};
+
+struct InputRecording
+{
+    std::vector<InputSnapshot> snapshots;
+};
+
+inline bool operator==(const InputSnapshot& lhs, const InputSnapshot& rhs)
+{
+    auto tieStruct = [](const InputSnapshot& snapshot) {
+        return std::tie(snapshot.pressedKeys, snapshot.mousePosition, snapshot.enteredText,
+                        snapshot.deltaTimeInSeconds);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const InputSnapshot& snapshot)
+{
+    return os << "pressedKeys: " << snapshot.pressedKeys << " mousePosition: " << snapshot.mousePosition
+              << " enteredText: " << snapshot.enteredText
+              << " deltaTimeInSeconds: " << snapshot.deltaTimeInSeconds;
+}
+
+inline bool operator==(const InputRecording& lhs, const InputRecording& rhs)
+{
+    return lhs.snapshots == rhs.snapshots;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const InputRecording& recording)
+{
+    return os << "snapshots: " << recording.snapshots;
+}
+}
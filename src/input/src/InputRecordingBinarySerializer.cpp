@@ -0,0 +1,83 @@
+#include "InputRecordingBinarySerializer.h"
+
+#include "BinaryReader.h"
+#include "BinaryWriter.h"
+
+namespace input
+{
+namespace
+{
+constexpr std::uint32_t magicNumber{0x43455249};
+constexpr std::uint32_t formatVersion{2};
+
+boost::optional<InputSnapshot> readInputSnapshot(utils::BinaryReader& reader)
+{
+    const auto pressedKeys = reader.read<InputKeysMask>();
+    const auto mousePositionX = reader.read<float>();
+    const auto mousePositionY = reader.read<float>();
+    const auto enteredText = reader.readString();
+    const auto deltaTimeInSeconds = reader.read<float>();
+
+    if (not pressedKeys || not mousePositionX || not mousePositionY || not enteredText ||
+        not deltaTimeInSeconds)
+    {
+        return boost::none;
+    }
+    return InputSnapshot{*pressedKeys, {*mousePositionX, *mousePositionY}, *enteredText, *deltaTimeInSeconds};
+}
+}
+
+std::string InputRecordingBinarySerializer::serialize(const InputRecording& inputRecording)
+{
+    utils::BinaryWriter writer;
+    writer.write(magicNumber);
+    writer.write(formatVersion);
+
+    writer.write(static_cast<std::uint32_t>(inputRecording.snapshots.size()));
+    for (const auto& snapshot : inputRecording.snapshots)
+    {
+        writer.write(snapshot.pressedKeys);
+        writer.write(snapshot.mousePosition.x);
+        writer.write(snapshot.mousePosition.y);
+        writer.writeString(snapshot.enteredText);
+        writer.write(snapshot.deltaTimeInSeconds);
+    }
+
+    return writer.getBuffer();
+}
+
+boost::optional<InputRecording> InputRecordingBinarySerializer::deserialize(const std::string& buffer)
+{
+    utils::BinaryReader reader{buffer};
+
+    if (reader.read<std::uint32_t>() != magicNumber || reader.read<std::uint32_t>() != formatVersion)
+    {
+        return boost::none;
+    }
+
+    const auto numberOfSnapshots = reader.read<std::uint32_t>();
+    if (not numberOfSnapshots || *numberOfSnapshots > reader.getNumberOfRemainingBytes())
+    {
+        return boost::none;
+    }
+
+    InputRecording inputRecording;
+    inputRecording.snapshots.reserve(*numberOfSnapshots);
+    for (std::uint32_t snapshotIndex = 0; snapshotIndex < *numberOfSnapshots; snapshotIndex++)
+    {
+        auto snapshot = readInputSnapshot(reader);
+        if (not snapshot)
+        {
+            return boost::none;
+        }
+        inputRecording.snapshots.push_back(std::move(*snapshot));
+    }
+
+    if (reader.getNumberOfRemainingBytes() != 0)
+    {
+        return boost::none;
+    }
+    return inputRecording;
+}
+
+}
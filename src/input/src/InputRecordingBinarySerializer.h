@@ -0,0 +1,16 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <string>
+
+#include "InputRecording.h"
+
+namespace input
+{
+class InputRecordingBinarySerializer
+{
+public:
+    static std::string serialize(const InputRecording&);
+    static boost::optional<InputRecording> deserialize(const std::string& buffer);
+};
+}
@@ -0,0 +1,45 @@
+#include "InputRecordingBinarySerializer.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace input;
+
+class InputRecordingBinarySerializerTest : public Test
+{
+public:
+    const InputRecording inputRecording{
+        {{0, {0, 0}, "", 1.f / 60.f},
+         {toKeysMask({InputKey::Right, InputKey::Space}), {12.5f, 3.f}, "", 0.008f},
+         {toKeyMask(InputKey::A), {12.5f, 4.f}, "a", 1.f / 120.f}}};
+};
+
+TEST_F(InputRecordingBinarySerializerTest, givenSerializedRecording_shouldReturnSameRecording)
+{
+    const auto buffer = InputRecordingBinarySerializer::serialize(inputRecording);
+
+    const auto actualInputRecording = InputRecordingBinarySerializer::deserialize(buffer);
+
+    ASSERT_TRUE(actualInputRecording);
+    ASSERT_EQ(*actualInputRecording, inputRecording);
+}
+
+TEST_F(InputRecordingBinarySerializerTest, givenTruncatedBuffer_shouldReturnNone)
+{
+    const auto buffer = InputRecordingBinarySerializer::serialize(inputRecording);
+
+    ASSERT_FALSE(InputRecordingBinarySerializer::deserialize(buffer.substr(0, buffer.size() - 1)));
+}
+
+TEST_F(InputRecordingBinarySerializerTest, givenBufferWithoutMagicNumber_shouldReturnNone)
+{
+    ASSERT_FALSE(InputRecordingBinarySerializer::deserialize("not a recording"));
+}
+
+TEST_F(InputRecordingBinarySerializerTest, givenBufferWithOtherFormatVersion_shouldReturnNone)
+{
+    auto buffer = InputRecordingBinarySerializer::serialize(inputRecording);
+    buffer[sizeof(std::uint32_t)]++;
+
+    ASSERT_FALSE(InputRecordingBinarySerializer::deserialize(buffer));
+}
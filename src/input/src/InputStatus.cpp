@@ -1,42 +1,66 @@
 #include "InputStatus.h"
 
-#include <tuple>
+#include <vector>
 
-#include "InputKey.h"
 #include "StlOperators.h"
 
 namespace input
 {
 
-InputStatus::InputStatus()
-    : numberOfKeys{allKeys.size()},
-      pressedKeys(numberOfKeys, false),
-      pressedKeysHistory(numberOfKeys, false),
-      releasedKeys(numberOfKeys, false)
+bool InputStatus::isKeyPressed(InputKey key) const
 {
+    return anyPressed(toKeyMask(key));
 }
 
-bool InputStatus::isKeyPressed(InputKey key) const
+void InputStatus::setKeyPressed(InputKey key)
 {
-    return pressedKeys.at(static_cast<unsigned>(key));
+    pressedKeys |= toKeyMask(key);
 }
 
-void InputStatus::setKeyPressed(InputKey key)
+void InputStatus::setPressedKeys(InputKeysMask keysMask)
 {
-    pressedKeys[static_cast<unsigned>(key)] = true;
+    pressedKeys = keysMask;
 }
 
 bool InputStatus::isKeyReleased(InputKey key) const
 {
-    return releasedKeys.at(static_cast<unsigned>(key));
+    return anyReleased(toKeyMask(key));
+}
+
+bool InputStatus::isKeyJustPressed(InputKey key) const
+{
+    return anyJustPressed(toKeyMask(key));
+}
+
+bool InputStatus::anyPressed(InputKeysMask keysMask) const
+{
+    return (pressedKeys & keysMask) != 0;
+}
+
+bool InputStatus::anyReleased(InputKeysMask keysMask) const
+{
+    return (releasedKeys & keysMask) != 0;
+}
+
+bool InputStatus::anyJustPressed(InputKeysMask keysMask) const
+{
+    return (justPressedKeys & keysMask) != 0;
+}
+
+InputKeysMask InputStatus::getPressedKeys() const
+{
+    return pressedKeys;
+}
+
+InputKeysMask InputStatus::getReleasedKeys() const
+{
+    return releasedKeys;
 }
 
 void InputStatus::setReleasedKeys()
 {
-    for (unsigned long i = 0; i < numberOfKeys; i++)
-    {
-        releasedKeys[i] = pressedKeysHistory[i] && not pressedKeys[i];
-    }
+    releasedKeys = pressedKeysHistory & ~pressedKeys;
+    justPressedKeys = pressedKeys & ~pressedKeysHistory;
     pressedKeysHistory = pressedKeys;
 }
 
@@ -52,47 +76,53 @@ utils::Vector2f InputStatus::getMousePosition() const
 
 void InputStatus::clearPressedKeys()
 {
-    for (unsigned long i = 0; i < numberOfKeys; i++)
-    {
-        pressedKeys[i] = false;
-    }
+    pressedKeys = 0;
+}
+
+const std::string& InputStatus::getEnteredText() const
+{
+    return enteredText;
+}
+
+void InputStatus::appendEnteredText(char character)
+{
+    enteredText += character;
+}
+
+void InputStatus::clearEnteredText()
+{
+    enteredText.clear();
 }
 
 namespace
 {
-std::tuple<std::vector<InputKey>, std::vector<InputKey>> getKeysInformation(const InputStatus& inputStatus)
+std::vector<InputKey> getKeys(InputKeysMask keysMask)
 {
-    std::vector<InputKey> pressedKeys;
-    std::vector<InputKey> releasedKeys;
+    std::vector<InputKey> keys;
     for (const auto& key : allKeys)
     {
-        if (inputStatus.isKeyPressed(key))
+        if (keysMask & toKeyMask(key))
         {
-            pressedKeys.push_back(key);
-        }
-
-        if (inputStatus.isKeyReleased(key))
-        {
-            pressedKeys.push_back(key);
+            keys.push_back(key);
         }
     }
-    return {pressedKeys, releasedKeys};
+    return keys;
 }
 }
 
 bool operator==(const InputStatus& lhs, const InputStatus& rhs)
 {
-    return getKeysInformation(lhs) == getKeysInformation(rhs) &&
-           lhs.getMousePosition() == rhs.getMousePosition();
+    return lhs.getPressedKeys() == rhs.getPressedKeys() && lhs.getReleasedKeys() == rhs.getReleasedKeys() &&
+           lhs.getMousePosition() == rhs.getMousePosition() && lhs.getEnteredText() == rhs.getEnteredText();
 }
 
 std::ostream& operator<<(std::ostream& os, const InputStatus& inputStatus)
 {
-    const auto [pressedKeys, releasedKeys] = getKeysInformation(inputStatus);
-    os << "PressedKeys: " << pressedKeys << std::endl;
-    os << "ReleasedKeys: " << releasedKeys << std::endl;
-    os << "Mouse position: " << inputStatus.getMousePosition();
+    os << "PressedKeys: " << getKeys(inputStatus.getPressedKeys()) << std::endl;
+    os << "ReleasedKeys: " << getKeys(inputStatus.getReleasedKeys()) << std::endl;
+    os << "Mouse position: " << inputStatus.getMousePosition() << std::endl;
+    os << "Entered text: " << inputStatus.getEnteredText();
     return os;
 }
 
-}
\ No newline at end of file
+}
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <ostream>
-#include <vector>
+#include <string>
 
 #include "InputKey.h"
 #include "Vector.h"
@@ -11,24 +11,33 @@ namespace input
 class InputStatus
 {
 public:
-    InputStatus();
-
     bool isKeyPressed(InputKey) const;
     void setKeyPressed(InputKey);
+    void setPressedKeys(InputKeysMask);
     bool isKeyReleased(InputKey) const;
+    bool isKeyJustPressed(InputKey) const;
+    bool anyPressed(InputKeysMask) const;
+    bool anyReleased(InputKeysMask) const;
+    bool anyJustPressed(InputKeysMask) const;
+    InputKeysMask getPressedKeys() const;
+    InputKeysMask getReleasedKeys() const;
     void setReleasedKeys();
     void setMousePosition(const utils::Vector2f&);
     utils::Vector2f getMousePosition() const;
     void clearPressedKeys();
+    const std::string& getEnteredText() const;
+    void appendEnteredText(char);
+    void clearEnteredText();
 
 private:
-    const unsigned long numberOfKeys;
-    std::vector<bool> pressedKeys;
-    std::vector<bool> pressedKeysHistory;
-    std::vector<bool> releasedKeys;
+    InputKeysMask pressedKeys{0};
+    InputKeysMask pressedKeysHistory{0};
+    InputKeysMask releasedKeys{0};
+    InputKeysMask justPressedKeys{0};
     utils::Vector2f mousePosition{};
+    std::string enteredText;
 };
 
 bool operator==(const InputStatus&, const InputStatus&);
 std::ostream& operator<<(std::ostream& os, const InputStatus&);
-}
\ No newline at end of file
+}
@@ -82,3 +82,40 @@ TEST_F(InputStatusTest, afterKeysPressedAndCleared_shouldSetReleasedKey)
     ASSERT_TRUE(inputStatus.isKeyReleased(InputKey::Up));
     ASSERT_TRUE(inputStatus.isKeyReleased(InputKey::MouseLeft));
 }
+
+TEST_F(InputStatusTest, afterKeyPressed_shouldSetKeyJustPressedOnlyInFirstFrame)
+{
+    inputStatus.setKeyPressed(InputKey::Space);
+    inputStatus.setReleasedKeys();
+
+    ASSERT_TRUE(inputStatus.isKeyJustPressed(InputKey::Space));
+
+    inputStatus.clearPressedKeys();
+    inputStatus.setKeyPressed(InputKey::Space);
+    inputStatus.setReleasedKeys();
+
+    ASSERT_FALSE(inputStatus.isKeyJustPressed(InputKey::Space));
+    ASSERT_TRUE(inputStatus.isKeyPressed(InputKey::Space));
+}
+
+TEST_F(InputStatusTest, anyPressed_shouldCheckOnlyKeysFromMask)
+{
+    inputStatus.setKeyPressed(InputKey::MouseLeft);
+
+    ASSERT_TRUE(inputStatus.anyPressed(mouseButtonsMask));
+    ASSERT_FALSE(inputStatus.anyPressed(alphaNumericalButtonsMask));
+    ASSERT_TRUE(inputStatus.anyPressed(toKeysMask({InputKey::A, InputKey::MouseLeft})));
+}
+
+TEST_F(InputStatusTest, afterAlphaNumericalKeyPressedAndCleared_anyReleasedShouldBeTrueForAlphaNumericalMask)
+{
+    inputStatus.setKeyPressed(InputKey::Number7);
+    inputStatus.setReleasedKeys();
+    inputStatus.clearPressedKeys();
+
+    inputStatus.setReleasedKeys();
+
+    ASSERT_TRUE(inputStatus.anyReleased(alphaNumericalButtonsMask));
+    ASSERT_FALSE(inputStatus.anyReleased(mouseButtonsMask));
+    ASSERT_EQ(inputStatus.getReleasedKeys(), toKeyMask(InputKey::Number7));
+}
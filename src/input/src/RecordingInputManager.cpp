@@ -0,0 +1,84 @@
+#include "RecordingInputManager.h"
+
+#include <iostream>
+
+#include "BinaryFile.h"
+#include "InputRecordingBinarySerializer.h"
+
+namespace input
+{
+
+RecordingInputManager::RecordingInputManager(std::unique_ptr<InputManager> inputManagerInit,
+                                             std::unique_ptr<InputObservationHandler> observationHandlerInit,
+                                             utils::FilePath recordingFilePathInit)
+    : inputManager{std::move(inputManagerInit)},
+      observationHandler{std::move(observationHandlerInit)},
+      recordingFilePath{std::move(recordingFilePathInit)},
+      inputStatus{nullptr}
+{
+    inputManager->registerObserver(this);
+}
+
+RecordingInputManager::~RecordingInputManager()
+{
+    inputManager->removeObserver(this);
+    saveRecording();
+}
+
+void RecordingInputManager::readInput()
+{
+    inputManager->readInput();
+}
+
+const InputEventBuffer& RecordingInputManager::getInputEvents() const
+{
+    return inputManager->getInputEvents();
+}
+
+void RecordingInputManager::registerObserver(InputObserver* observer)
+{
+    observationHandler->registerObserver(observer);
+}
+
+void RecordingInputManager::removeObserver(InputObserver* observer)
+{
+    observationHandler->removeObserver(observer);
+}
+
+void RecordingInputManager::handleInputStatus(const InputStatus& inputStatusInit)
+{
+    inputStatus = &inputStatusInit;
+    recording.snapshots.push_back(
+        {inputStatus->getPressedKeys(), inputStatus->getMousePosition(), inputStatus->getEnteredText(), 0});
+    notifyObservers();
+}
+
+void RecordingInputManager::recordDeltaTime(const utils::DeltaTime& deltaTime)
+{
+    if (not recording.snapshots.empty())
+    {
+        recording.snapshots.back().deltaTimeInSeconds = deltaTime.count();
+    }
+}
+
+const InputRecording& RecordingInputManager::getRecording() const
+{
+    return recording;
+}
+
+bool RecordingInputManager::saveRecording() const
+{
+    if (not utils::writeBinaryFile(recordingFilePath, InputRecordingBinarySerializer::serialize(recording)))
+    {
+        std::cerr << "Cannot save input recording to: " << recordingFilePath << "\n";
+        return false;
+    }
+    return true;
+}
+
+void RecordingInputManager::notifyObservers()
+{
+    observationHandler->notifyObservers(*inputStatus);
+}
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+
+#include "DeltaTime.h"
+#include "FilePath.h"
+#include "InputManager.h"
+#include "InputObservationHandler.h"
+#include "InputObserver.h"
+#include "InputRecording.h"
+
+namespace input
+{
+class RecordingInputManager : public InputManager, public InputObserver
+{
+public:
+    RecordingInputManager(std::unique_ptr<InputManager>, std::unique_ptr<InputObservationHandler>,
+                          utils::FilePath recordingFilePath);
+    ~RecordingInputManager();
+
+    void readInput() override;
+    const InputEventBuffer& getInputEvents() const override;
+    void registerObserver(InputObserver*) override;
+    void removeObserver(InputObserver*) override;
+    void handleInputStatus(const InputStatus&) override;
+    // Stores the frame delta time with the snapshot captured by the last readInput.
+    void recordDeltaTime(const utils::DeltaTime&);
+    const InputRecording& getRecording() const;
+    bool saveRecording() const;
+
+private:
+    void notifyObservers() override;
+
+    std::unique_ptr<InputManager> inputManager;
+    std::unique_ptr<InputObservationHandler> observationHandler;
+    const utils::FilePath recordingFilePath;
+    InputRecording recording;
+    const InputStatus* inputStatus;
+};
+}
@@ -0,0 +1,97 @@
+#include "RecordingInputManager.h"
+
+#include <filesystem>
+
+#include "gtest/gtest.h"
+
+#include "BinaryFile.h"
+#include "InputManagerMock.h"
+#include "InputObservationHandlerMock.h"
+#include "InputRecordingBinarySerializer.h"
+
+using namespace ::testing;
+using namespace input;
+
+namespace
+{
+const utils::DeltaTime deltaTime{0.008f};
+const utils::FilePath recordingFilePath{
+    (std::filesystem::temp_directory_path() / "RecordingInputManagerTest.rec").string()};
+}
+
+class RecordingInputManagerTest_Base : public Test
+{
+public:
+    RecordingInputManagerTest_Base()
+    {
+        EXPECT_CALL(*inputManager, registerObserver(_));
+        EXPECT_CALL(*inputManager, removeObserver(_));
+    }
+
+    ~RecordingInputManagerTest_Base()
+    {
+        std::filesystem::remove(recordingFilePath);
+    }
+
+    std::unique_ptr<StrictMock<InputManagerMock>> inputManagerInit{
+        std::make_unique<StrictMock<InputManagerMock>>()};
+    StrictMock<InputManagerMock>* inputManager{inputManagerInit.get()};
+    std::unique_ptr<StrictMock<InputObservationHandlerMock>> observationHandlerInit{
+        std::make_unique<StrictMock<InputObservationHandlerMock>>()};
+    StrictMock<InputObservationHandlerMock>* observationHandler{observationHandlerInit.get()};
+};
+
+class RecordingInputManagerTest : public RecordingInputManagerTest_Base
+{
+public:
+    std::unique_ptr<RecordingInputManager> recordingInputManager{std::make_unique<RecordingInputManager>(
+        std::move(inputManagerInit), std::move(observationHandlerInit), recordingFilePath)};
+};
+
+TEST_F(RecordingInputManagerTest, readInput_shouldRecordInputStatusAndNotifyObservers)
+{
+    InputStatus inputStatus;
+    inputStatus.setKeyPressed(InputKey::Space);
+    inputStatus.setMousePosition({3, 4});
+    inputStatus.appendEnteredText('x');
+    EXPECT_CALL(*inputManager, readInput()).WillOnce(Invoke([&] {
+        recordingInputManager->handleInputStatus(inputStatus);
+    }));
+    EXPECT_CALL(*observationHandler, notifyObservers(inputStatus));
+
+    recordingInputManager->readInput();
+
+    ASSERT_EQ(recordingInputManager->getRecording(),
+              (InputRecording{{{toKeyMask(InputKey::Space), {3, 4}, "x", 0}}}));
+}
+
+TEST_F(RecordingInputManagerTest, recordDeltaTime_shouldStoreDeltaTimeWithLastSnapshot)
+{
+    InputStatus inputStatus;
+    inputStatus.setKeyPressed(InputKey::Right);
+    EXPECT_CALL(*observationHandler, notifyObservers(inputStatus)).Times(2);
+    recordingInputManager->handleInputStatus(inputStatus);
+    recordingInputManager->handleInputStatus(inputStatus);
+
+    recordingInputManager->recordDeltaTime(deltaTime);
+
+    ASSERT_EQ(recordingInputManager->getRecording(),
+              (InputRecording{{{toKeyMask(InputKey::Right), {0, 0}, "", 0},
+                               {toKeyMask(InputKey::Right), {0, 0}, "", deltaTime.count()}}}));
+}
+
+TEST_F(RecordingInputManagerTest, destruction_shouldSaveRecordingToFile)
+{
+    InputStatus inputStatus;
+    inputStatus.setKeyPressed(InputKey::Left);
+    EXPECT_CALL(*observationHandler, notifyObservers(inputStatus));
+    recordingInputManager->handleInputStatus(inputStatus);
+    recordingInputManager->recordDeltaTime(deltaTime);
+    const auto expectedRecording = recordingInputManager->getRecording();
+
+    recordingInputManager.reset();
+
+    const auto savedRecording = utils::readBinaryFile(recordingFilePath);
+    ASSERT_TRUE(savedRecording);
+    ASSERT_EQ(InputRecordingBinarySerializer::deserialize(*savedRecording), expectedRecording);
+}
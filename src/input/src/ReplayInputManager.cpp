@@ -0,0 +1,97 @@
+#include "ReplayInputManager.h"
+
+namespace input
+{
+namespace
+{
+const auto inputEventBufferCapacity{256u};
+}
+
+ReplayInputManager::ReplayInputManager(std::unique_ptr<InputObservationHandler> observationHandlerInit,
+                                       InputRecording recordingInit)
+    : observationHandler{std::move(observationHandlerInit)},
+      recording{std::move(recordingInit)},
+      nextSnapshotIndex{0},
+      deltaTime{0},
+      inputEvents{inputEventBufferCapacity}
+{
+}
+
+void ReplayInputManager::readInput()
+{
+    inputStatus.clearEnteredText();
+
+    if (isFinished())
+    {
+        pushChangedKeysEvents(0);
+        inputStatus.clearPressedKeys();
+        deltaTime = utils::DeltaTime{0};
+    }
+    else
+    {
+        const auto& snapshot = recording.snapshots[nextSnapshotIndex++];
+        pushChangedKeysEvents(snapshot.pressedKeys);
+        inputStatus.setPressedKeys(snapshot.pressedKeys);
+        inputStatus.setMousePosition(snapshot.mousePosition);
+        deltaTime = utils::DeltaTime{snapshot.deltaTimeInSeconds};
+        for (const auto character : snapshot.enteredText)
+        {
+            inputStatus.appendEnteredText(character);
+        }
+    }
+
+    inputStatus.setReleasedKeys();
+    notifyObservers();
+}
+
+const InputEventBuffer& ReplayInputManager::getInputEvents() const
+{
+    return inputEvents;
+}
+
+void ReplayInputManager::registerObserver(InputObserver* observer)
+{
+    observationHandler->registerObserver(observer);
+}
+
+void ReplayInputManager::removeObserver(InputObserver* observer)
+{
+    observationHandler->removeObserver(observer);
+}
+
+bool ReplayInputManager::isFinished() const
+{
+    return nextSnapshotIndex >= recording.snapshots.size();
+}
+
+utils::DeltaTime ReplayInputManager::getDeltaTime() const
+{
+    return deltaTime;
+}
+
+void ReplayInputManager::notifyObservers()
+{
+    observationHandler->notifyObservers(inputStatus);
+}
+
+void ReplayInputManager::pushChangedKeysEvents(InputKeysMask pressedKeys)
+{
+    const auto changedKeys = pressedKeys ^ inputStatus.getPressedKeys();
+    if (not changedKeys)
+    {
+        return;
+    }
+
+    const auto eventTimestamp = InputEventClock::now();
+    for (const auto& key : allKeys)
+    {
+        if (changedKeys & toKeyMask(key))
+        {
+            const auto eventType =
+                (pressedKeys & toKeyMask(key)) ? InputEventType::KeyPressed : InputEventType::KeyReleased;
+            inputEvents.push({eventType, key, eventTimestamp});
+        }
+    }
+}
+
+}
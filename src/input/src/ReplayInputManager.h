@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+
+#include "DeltaTime.h"
+#include "InputManager.h"
+#include "InputObservationHandler.h"
+#include "InputRecording.h"
+
+namespace input
+{
+class ReplayInputManager : public InputManager
+{
+public:
+    ReplayInputManager(std::unique_ptr<InputObservationHandler>, InputRecording);
+
+    void readInput() override;
+    const InputEventBuffer& getInputEvents() const override;
+    void registerObserver(InputObserver*) override;
+    void removeObserver(InputObserver*) override;
+    bool isFinished() const;
+    utils::DeltaTime getDeltaTime() const;
+
+private:
+    void notifyObservers() override;
+    void pushChangedKeysEvents(InputKeysMask pressedKeys);
+
+    std::unique_ptr<InputObservationHandler> observationHandler;
+    const InputRecording recording;
+    std::size_t nextSnapshotIndex;
+    utils::DeltaTime deltaTime;
+    InputStatus inputStatus;
+    InputEventBuffer inputEvents;
+};
+}
@@ -0,0 +1,79 @@
+#include "ReplayInputManager.h"
+
+#include "gtest/gtest.h"
+
+#include "InputObservationHandlerMock.h"
+
+using namespace ::testing;
+using namespace input;
+
+class ReplayInputManagerTest : public Test
+{
+public:
+    const InputRecording inputRecording{
+        {{toKeyMask(InputKey::Right), {1, 2}, "", 0.02f}, {toKeyMask(InputKey::Space), {1, 3}, "q", 0.01f}}};
+    std::unique_ptr<StrictMock<InputObservationHandlerMock>> observationHandlerInit{
+        std::make_unique<StrictMock<InputObservationHandlerMock>>()};
+    StrictMock<InputObservationHandlerMock>* observationHandler{observationHandlerInit.get()};
+    ReplayInputManager replayInputManager{std::move(observationHandlerInit), inputRecording};
+};
+
+TEST_F(ReplayInputManagerTest, beforeReadInput_shouldReturnZeroDeltaTime)
+{
+    ASSERT_EQ(replayInputManager.getDeltaTime(), utils::DeltaTime{0});
+    ASSERT_FALSE(replayInputManager.isFinished());
+}
+
+TEST_F(ReplayInputManagerTest, readInput_shouldReturnDeltaTimeOfReplayedSnapshot)
+{
+    EXPECT_CALL(*observationHandler, notifyObservers(_)).Times(3);
+
+    replayInputManager.readInput();
+    ASSERT_EQ(replayInputManager.getDeltaTime(), utils::DeltaTime{0.02f});
+    replayInputManager.readInput();
+    ASSERT_EQ(replayInputManager.getDeltaTime(), utils::DeltaTime{0.01f});
+    replayInputManager.readInput();
+    ASSERT_EQ(replayInputManager.getDeltaTime(), utils::DeltaTime{0});
+}
+
+TEST_F(ReplayInputManagerTest, readInput_shouldNotifyObserversWithRecordedSnapshotsInOrder)
+{
+    InputStatus firstInputStatus;
+    firstInputStatus.setKeyPressed(InputKey::Right);
+    firstInputStatus.setReleasedKeys();
+    firstInputStatus.setMousePosition({1, 2});
+    InputStatus secondInputStatus{firstInputStatus};
+    secondInputStatus.clearPressedKeys();
+    secondInputStatus.setKeyPressed(InputKey::Space);
+    secondInputStatus.setReleasedKeys();
+    secondInputStatus.setMousePosition({1, 3});
+    secondInputStatus.appendEnteredText('q');
+    InSequence sequence;
+    EXPECT_CALL(*observationHandler, notifyObservers(firstInputStatus));
+    EXPECT_CALL(*observationHandler, notifyObservers(secondInputStatus));
+
+    replayInputManager.readInput();
+    replayInputManager.readInput();
+
+    ASSERT_TRUE(replayInputManager.isFinished());
+}
+
+TEST_F(ReplayInputManagerTest, readInput_shouldPushEventsForChangedKeys)
+{
+    EXPECT_CALL(*observationHandler, notifyObservers(_)).Times(3);
+
+    replayInputManager.readInput();
+    replayInputManager.readInput();
+    replayInputManager.readInput();
+
+    const auto& inputEvents = replayInputManager.getInputEvents();
+    ASSERT_EQ(inputEvents.size(), 4u);
+    ASSERT_EQ(inputEvents[0].type, InputEventType::KeyPressed);
+    ASSERT_EQ(inputEvents[0].key, InputKey::Right);
+    ASSERT_EQ(inputEvents[1].type, InputEventType::KeyReleased);
+    ASSERT_EQ(inputEvents[1].key, InputKey::Right);
+    ASSERT_EQ(inputEvents[2].type, InputEventType::KeyPressed);
+    ASSERT_EQ(inputEvents[2].key, InputKey::Space);
+    ASSERT_EQ(inputEvents[3].type, InputEventType::KeyReleased);
+    ASSERT_EQ(inputEvents[3].key, InputKey::Space);
+}
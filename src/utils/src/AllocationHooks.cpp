@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "AllocationTracker.h"
+
+namespace
+{
+struct alignas(std::max_align_t) AllocationHeader
+{
+    std::size_t size;
+    utils::AllocationTag tag;
+};
+
+void* allocate(std::size_t size) noexcept
+{
+    const auto tag = utils::AllocationTracker::getCurrentTag();
+    auto header = static_cast<AllocationHeader*>(std::malloc(sizeof(AllocationHeader) + size));
+    if (not header)
+    {
+        return nullptr;
+    }
+    header->size = size;
+    header->tag = tag;
+    utils::AllocationTracker::recordAllocation(tag, size);
+    return header + 1;
+}
+
+void* allocateOrThrow(std::size_t size)
+{
+    if (auto memory = allocate(size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void deallocate(void* memory) noexcept
+{
+    if (not memory)
+    {
+        return;
+    }
+    auto header = static_cast<AllocationHeader*>(memory) - 1;
+    utils::AllocationTracker::recordDeallocation(header->tag, header->size);
+    std::free(header);
+}
+}
+
+void* operator new(std::size_t size)
+{
+    return allocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    deallocate(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    deallocate(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    deallocate(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    deallocate(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    deallocate(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    deallocate(memory);
+}
@@ -0,0 +1,156 @@
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+namespace utils
+{
+namespace
+{
+struct AllocationCounters
+{
+    std::atomic<std::uint64_t> numberOfAllocations;
+    std::atomic<std::uint64_t> numberOfDeallocations;
+    std::atomic<std::uint64_t> allocatedBytes;
+    std::atomic<std::uint64_t> deallocatedBytes;
+};
+
+// Constant initialized, so the allocation hooks can use them before any dynamic initialization.
+std::array<AllocationCounters, numberOfAllocationTags> allocationCounters{};
+thread_local AllocationTag currentTag{AllocationTag::Untagged};
+
+FrameAllocationStatistics frameStatistics{};
+std::uint64_t numberOfAllocationsAtFrameStart{0};
+
+AllocationCounters& getCounters(AllocationTag tag)
+{
+    return allocationCounters[static_cast<std::size_t>(tag)];
+}
+}
+
+std::string toString(AllocationTag tag)
+{
+    switch (tag)
+    {
+    case AllocationTag::Untagged:
+        return "untagged";
+    case AllocationTag::Graphics:
+        return "graphics";
+    case AllocationTag::Components:
+        return "components";
+    case AllocationTag::Animations:
+        return "animations";
+    case AllocationTag::GameStates:
+        return "gameStates";
+    }
+    return "unknown";
+}
+
+bool AllocationTracker::isEnabled()
+{
+#ifdef CHIMARRAO_ALLOCATION_TRACKER_ENABLED
+    return true;
+#else
+    return false;
+#endif
+}
+
+AllocationTag AllocationTracker::getCurrentTag()
+{
+    return currentTag;
+}
+
+void AllocationTracker::setCurrentTag(AllocationTag tag)
+{
+    currentTag = tag;
+}
+
+void AllocationTracker::recordAllocation(AllocationTag tag, std::size_t size)
+{
+    auto& counters = getCounters(tag);
+    counters.numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationTracker::recordDeallocation(AllocationTag tag, std::size_t size)
+{
+    auto& counters = getCounters(tag);
+    counters.numberOfDeallocations.fetch_add(1, std::memory_order_relaxed);
+    counters.deallocatedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+AllocationStatistics AllocationTracker::getStatistics(AllocationTag tag)
+{
+    const auto& counters = getCounters(tag);
+    const auto allocatedBytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+    const auto deallocatedBytes = counters.deallocatedBytes.load(std::memory_order_relaxed);
+    return {counters.numberOfAllocations.load(std::memory_order_relaxed),
+            counters.numberOfDeallocations.load(std::memory_order_relaxed), allocatedBytes,
+            allocatedBytes > deallocatedBytes ? allocatedBytes - deallocatedBytes : 0};
+}
+
+std::uint64_t AllocationTracker::getTotalNumberOfAllocations()
+{
+    std::uint64_t totalNumberOfAllocations{0};
+    for (const auto& counters : allocationCounters)
+    {
+        totalNumberOfAllocations += counters.numberOfAllocations.load(std::memory_order_relaxed);
+    }
+    return totalNumberOfAllocations;
+}
+
+void AllocationTracker::frameFinished()
+{
+    const auto numberOfAllocations = getTotalNumberOfAllocations();
+    const auto frameAllocations = numberOfAllocations - numberOfAllocationsAtFrameStart;
+    numberOfAllocationsAtFrameStart = numberOfAllocations;
+
+    frameStatistics.numberOfFrames++;
+    if (frameAllocations > 0)
+    {
+        frameStatistics.numberOfFramesWithAllocations++;
+    }
+    frameStatistics.lastFrameAllocations = frameAllocations;
+    frameStatistics.maxFrameAllocations = std::max(frameStatistics.maxFrameAllocations, frameAllocations);
+}
+
+FrameAllocationStatistics AllocationTracker::getFrameStatistics()
+{
+    return frameStatistics;
+}
+
+void AllocationTracker::resetFrameStatistics()
+{
+    frameStatistics = {};
+    numberOfAllocationsAtFrameStart = getTotalNumberOfAllocations();
+}
+
+void AllocationTracker::writeReport(std::ostream& os)
+{
+    os << "tag,allocations,deallocations,allocatedBytes,liveBytes\n";
+    for (std::size_t tagIndex = 0; tagIndex < numberOfAllocationTags; tagIndex++)
+    {
+        const auto tag = static_cast<AllocationTag>(tagIndex);
+        const auto statistics = getStatistics(tag);
+        os << toString(tag) << "," << statistics.numberOfAllocations << ","
+           << statistics.numberOfDeallocations << "," << statistics.allocatedBytes << ","
+           << statistics.liveBytes << "\n";
+    }
+
+    os << "\nframes,framesWithAllocations,lastFrameAllocations,maxFrameAllocations\n";
+    os << frameStatistics.numberOfFrames << "," << frameStatistics.numberOfFramesWithAllocations << ","
+       << frameStatistics.lastFrameAllocations << "," << frameStatistics.maxFrameAllocations << "\n";
+}
+
+ScopedAllocationTag::ScopedAllocationTag(AllocationTag tag) : previousTag{AllocationTracker::getCurrentTag()}
+{
+    AllocationTracker::setCurrentTag(tag);
+}
+
+ScopedAllocationTag::~ScopedAllocationTag()
+{
+    AllocationTracker::setCurrentTag(previousTag);
+}
+
+}
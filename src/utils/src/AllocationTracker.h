@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <tuple>
+
+namespace utils
+{
+enum class AllocationTag
+{
+    Untagged,
+    Graphics,
+    Components,
+    Animations,
+    GameStates
+};
+
+constexpr std::size_t numberOfAllocationTags{static_cast<std::size_t>(AllocationTag::GameStates) + 1};
+
+std::string toString(AllocationTag);
+
+struct AllocationStatistics
+{
+    std::uint64_t numberOfAllocations;
+    std::uint64_t numberOfDeallocations;
+    std::uint64_t allocatedBytes;
+    std::uint64_t liveBytes;
+};
+
+inline bool operator==(const AllocationStatistics& lhs, const AllocationStatistics& rhs)
+{
+    auto tieStruct = [](const AllocationStatistics& allocationStatistics) {
+        return std::tie(allocationStatistics.numberOfAllocations, allocationStatistics.numberOfDeallocations,
+                        allocationStatistics.allocatedBytes, allocationStatistics.liveBytes);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const AllocationStatistics& allocationStatistics)
+{
+    return os << "allocations: " << allocationStatistics.numberOfAllocations
+              << " deallocations: " << allocationStatistics.numberOfDeallocations
+              << " allocatedBytes: " << allocationStatistics.allocatedBytes
+              << " liveBytes: " << allocationStatistics.liveBytes;
+}
+
+struct FrameAllocationStatistics
+{
+    std::uint64_t numberOfFrames;
+    std::uint64_t numberOfFramesWithAllocations;
+    std::uint64_t lastFrameAllocations;
+    std::uint64_t maxFrameAllocations;
+};
+
+inline bool operator==(const FrameAllocationStatistics& lhs, const FrameAllocationStatistics& rhs)
+{
+    auto tieStruct = [](const FrameAllocationStatistics& frameAllocationStatistics) {
+        return std::tie(frameAllocationStatistics.numberOfFrames,
+                        frameAllocationStatistics.numberOfFramesWithAllocations,
+                        frameAllocationStatistics.lastFrameAllocations,
+                        frameAllocationStatistics.maxFrameAllocations);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const FrameAllocationStatistics& frameAllocationStatistics)
+{
+    return os << "frames: " << frameAllocationStatistics.numberOfFrames
+              << " framesWithAllocations: " << frameAllocationStatistics.numberOfFramesWithAllocations
+              << " lastFrameAllocations: " << frameAllocationStatistics.lastFrameAllocations
+              << " maxFrameAllocations: " << frameAllocationStatistics.maxFrameAllocations;
+}
+
+// Global operator new/delete hooks are linked in only when built with ENABLE_ALLOCATION_TRACKER,
+// TaggedAllocator records its allocations regardless.
+class AllocationTracker
+{
+public:
+    static bool isEnabled();
+    static AllocationTag getCurrentTag();
+    static void setCurrentTag(AllocationTag);
+    static void recordAllocation(AllocationTag, std::size_t size);
+    static void recordDeallocation(AllocationTag, std::size_t size);
+    static AllocationStatistics getStatistics(AllocationTag);
+    static std::uint64_t getTotalNumberOfAllocations();
+    static void frameFinished();
+    static FrameAllocationStatistics getFrameStatistics();
+    static void resetFrameStatistics();
+    static void writeReport(std::ostream&);
+};
+
+class ScopedAllocationTag
+{
+public:
+    explicit ScopedAllocationTag(AllocationTag);
+    ~ScopedAllocationTag();
+
+    ScopedAllocationTag(const ScopedAllocationTag&) = delete;
+    ScopedAllocationTag& operator=(const ScopedAllocationTag&) = delete;
+
+private:
+    const AllocationTag previousTag;
+};
+}
+
+#define CHIMARRAO_ALLOCATION_CONCATENATE_IMPL(lhs, rhs) lhs##rhs
+#define CHIMARRAO_ALLOCATION_CONCATENATE(lhs, rhs) CHIMARRAO_ALLOCATION_CONCATENATE_IMPL(lhs, rhs)
+
+#ifdef CHIMARRAO_ALLOCATION_TRACKER_ENABLED
+#define ALLOCATION_TAG(tag)                                                                                  \
+    const utils::ScopedAllocationTag CHIMARRAO_ALLOCATION_CONCATENATE(allocationTag, __LINE__)               \
+        {utils::AllocationTag::tag}
+#else
+#define ALLOCATION_TAG(tag)
+#endif
@@ -0,0 +1,92 @@
+#include "AllocationTracker.h"
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace utils;
+
+class AllocationTrackerTest : public Test
+{
+public:
+    AllocationTrackerTest()
+    {
+        AllocationTracker::resetFrameStatistics();
+    }
+};
+
+TEST_F(AllocationTrackerTest, recordedAllocationsAndDeallocations_shouldBeAttributedToTag)
+{
+    const auto statisticsBefore = AllocationTracker::getStatistics(AllocationTag::Animations);
+
+    AllocationTracker::recordAllocation(AllocationTag::Animations, 100);
+    AllocationTracker::recordAllocation(AllocationTag::Animations, 50);
+    AllocationTracker::recordDeallocation(AllocationTag::Animations, 100);
+
+    const auto statisticsAfter = AllocationTracker::getStatistics(AllocationTag::Animations);
+    ASSERT_EQ(statisticsAfter.numberOfAllocations - statisticsBefore.numberOfAllocations, 2u);
+    ASSERT_EQ(statisticsAfter.numberOfDeallocations - statisticsBefore.numberOfDeallocations, 1u);
+    ASSERT_EQ(statisticsAfter.allocatedBytes - statisticsBefore.allocatedBytes, 150u);
+    ASSERT_EQ(statisticsAfter.liveBytes - statisticsBefore.liveBytes, 50u);
+}
+
+TEST_F(AllocationTrackerTest, scopedAllocationTag_shouldRestorePreviousTag)
+{
+    AllocationTracker::setCurrentTag(AllocationTag::GameStates);
+    {
+        const ScopedAllocationTag scopedAllocationTag{AllocationTag::Graphics};
+
+        ASSERT_EQ(AllocationTracker::getCurrentTag(), AllocationTag::Graphics);
+    }
+
+    ASSERT_EQ(AllocationTracker::getCurrentTag(), AllocationTag::GameStates);
+    AllocationTracker::setCurrentTag(AllocationTag::Untagged);
+}
+
+TEST_F(AllocationTrackerTest, frameFinished_shouldCountAllocationsSincePreviousFrame)
+{
+    AllocationTracker::recordAllocation(AllocationTag::Components, 8);
+    AllocationTracker::recordAllocation(AllocationTag::Components, 8);
+    AllocationTracker::frameFinished();
+    AllocationTracker::frameFinished();
+
+    ASSERT_EQ(AllocationTracker::getFrameStatistics(), (FrameAllocationStatistics{2, 1, 0, 2}));
+    AllocationTracker::recordDeallocation(AllocationTag::Components, 8);
+    AllocationTracker::recordDeallocation(AllocationTag::Components, 8);
+}
+
+TEST_F(AllocationTrackerTest, writeReport_shouldWriteRowForEachTagAndFrameSummary)
+{
+    std::stringstream report;
+
+    AllocationTracker::writeReport(report);
+
+    std::string line;
+    std::vector<std::string> lines;
+    while (std::getline(report, line))
+    {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(lines.size(), 1u + numberOfAllocationTags + 3u);
+    ASSERT_EQ(lines[0], "tag,allocations,deallocations,allocatedBytes,liveBytes");
+    ASSERT_EQ(lines[2].rfind("graphics,", 0), 0u);
+    ASSERT_EQ(lines[7], "frames,framesWithAllocations,lastFrameAllocations,maxFrameAllocations");
+}
+
+#ifdef CHIMARRAO_ALLOCATION_TRACKER_ENABLED
+TEST_F(AllocationTrackerTest, givenEnabledTracker_newShouldBeAttributedToCurrentTag)
+{
+    const auto statisticsBefore = AllocationTracker::getStatistics(AllocationTag::Graphics);
+
+    {
+        const ScopedAllocationTag scopedAllocationTag{AllocationTag::Graphics};
+        ::operator delete(::operator new(sizeof(std::uint64_t)));
+    }
+
+    const auto statisticsAfter = AllocationTracker::getStatistics(AllocationTag::Graphics);
+    ASSERT_EQ(statisticsAfter.numberOfAllocations - statisticsBefore.numberOfAllocations, 1u);
+    ASSERT_EQ(statisticsAfter.numberOfDeallocations - statisticsBefore.numberOfDeallocations, 1u);
+    ASSERT_EQ(statisticsAfter.allocatedBytes - statisticsBefore.allocatedBytes, sizeof(std::uint64_t));
+}
+#endif
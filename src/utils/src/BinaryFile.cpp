@@ -0,0 +1,36 @@
+#include "BinaryFile.h"
+
+#include <fstream>
+
+namespace utils
+{
+
+boost::optional<std::string> readBinaryFile(const FilePath& filePath)
+{
+    std::ifstream file{filePath, std::ios::binary | std::ios::ate};
+    if (not file)
+    {
+        return boost::none;
+    }
+
+    const auto fileSize = static_cast<std::size_t>(file.tellg());
+    std::string content(fileSize, '\0');
+    file.seekg(0);
+    if (not file.read(content.data(), static_cast<std::streamsize>(fileSize)))
+    {
+        return boost::none;
+    }
+    return content;
+}
+
+bool writeBinaryFile(const FilePath& filePath, const std::string& content)
+{
+    std::ofstream file{filePath, std::ios::binary | std::ios::trunc};
+    if (not file)
+    {
+        return false;
+    }
+    return static_cast<bool>(file.write(content.data(), static_cast<std::streamsize>(content.size())));
+}
+
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <string>
+
+#include "FilePath.h"
+
+namespace utils
+{
+boost::optional<std::string> readBinaryFile(const FilePath&);
+bool writeBinaryFile(const FilePath&, const std::string& content);
+}
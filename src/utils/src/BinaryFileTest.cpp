@@ -0,0 +1,39 @@
+#include "BinaryFile.h"
+
+#include <filesystem>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace utils;
+
+class BinaryFileTest : public Test
+{
+public:
+    ~BinaryFileTest()
+    {
+        std::filesystem::remove(filePath);
+    }
+
+    const FilePath filePath{(std::filesystem::temp_directory_path() / "BinaryFileTest.bin").string()};
+    const FilePath nonExistingFilePath{
+        (std::filesystem::temp_directory_path() / "nonExistingDirectory" / "file.bin").string()};
+    const std::string content{std::string{"binary"} + '\0' + std::string{"content\n"}};
+};
+
+TEST_F(BinaryFileTest, givenNonExistingFile_shouldReturnNone)
+{
+    ASSERT_FALSE(readBinaryFile(nonExistingFilePath));
+}
+
+TEST_F(BinaryFileTest, givenNonExistingDirectory_shouldNotWriteFile)
+{
+    ASSERT_FALSE(writeBinaryFile(nonExistingFilePath, content));
+}
+
+TEST_F(BinaryFileTest, givenWrittenFile_shouldReadSameContent)
+{
+    ASSERT_TRUE(writeBinaryFile(filePath, content));
+
+    ASSERT_EQ(readBinaryFile(filePath), content);
+}
@@ -0,0 +1,25 @@
+#include "BinaryReader.h"
+
+namespace utils
+{
+
+BinaryReader::BinaryReader(const std::string& bufferInit) : buffer{bufferInit}, position{0} {}
+
+boost::optional<std::string> BinaryReader::readString()
+{
+    const auto size = read<std::uint32_t>();
+    if (not size || getNumberOfRemainingBytes() < *size)
+    {
+        return boost::none;
+    }
+    auto value = buffer.substr(position, *size);
+    position += *size;
+    return value;
+}
+
+std::size_t BinaryReader::getNumberOfRemainingBytes() const
+{
+    return buffer.size() - position;
+}
+
+}
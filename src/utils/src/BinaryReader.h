@@ -0,0 +1,37 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace utils
+{
+class BinaryReader
+{
+public:
+    explicit BinaryReader(const std::string& buffer);
+
+    template <typename T>
+    boost::optional<T> read()
+    {
+        static_assert(std::is_arithmetic_v<T>, "BinaryReader: only arithmetic types can be read");
+        if (getNumberOfRemainingBytes() < sizeof(T))
+        {
+            return boost::none;
+        }
+        T value;
+        std::memcpy(&value, buffer.data() + position, sizeof(T));
+        position += sizeof(T);
+        return value;
+    }
+
+    boost::optional<std::string> readString();
+    std::size_t getNumberOfRemainingBytes() const;
+
+private:
+    const std::string& buffer;
+    std::size_t position;
+};
+}
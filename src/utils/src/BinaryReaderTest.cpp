@@ -0,0 +1,51 @@
+#include "BinaryReader.h"
+
+#include "gtest/gtest.h"
+
+#include "BinaryWriter.h"
+
+using namespace ::testing;
+using namespace utils;
+
+class BinaryReaderTest : public Test
+{
+public:
+    const std::uint64_t number{1234567890123ull};
+    const float floatingPointNumber{0.25f};
+    const std::string text{"resources/Player/Idle/idle-with-weapon-1.png"};
+};
+
+TEST_F(BinaryReaderTest, givenValuesWrittenByBinaryWriter_shouldReadSameValuesInOrder)
+{
+    BinaryWriter writer;
+    writer.write(number);
+    writer.writeString(text);
+    writer.write(floatingPointNumber);
+    writer.write(true);
+    BinaryReader reader{writer.getBuffer()};
+
+    ASSERT_EQ(reader.read<std::uint64_t>(), number);
+    ASSERT_EQ(reader.readString(), text);
+    ASSERT_EQ(reader.read<float>(), floatingPointNumber);
+    ASSERT_EQ(reader.read<bool>(), true);
+    ASSERT_EQ(reader.getNumberOfRemainingBytes(), 0);
+}
+
+TEST_F(BinaryReaderTest, givenTooFewBytes_shouldReturnNone)
+{
+    const std::string buffer{"abc"};
+    BinaryReader reader{buffer};
+
+    ASSERT_FALSE(reader.read<std::uint32_t>());
+    ASSERT_EQ(reader.getNumberOfRemainingBytes(), buffer.size());
+}
+
+TEST_F(BinaryReaderTest, givenStringLongerThanRemainingBytes_shouldReturnNone)
+{
+    BinaryWriter writer;
+    writer.writeString(text);
+    const auto truncatedBuffer = writer.getBuffer().substr(0, writer.getBuffer().size() - 1);
+    BinaryReader reader{truncatedBuffer};
+
+    ASSERT_FALSE(reader.readString());
+}
@@ -0,0 +1,17 @@
+#include "BinaryWriter.h"
+
+namespace utils
+{
+
+void BinaryWriter::writeString(const std::string& value)
+{
+    write(static_cast<std::uint32_t>(value.size()));
+    buffer.append(value);
+}
+
+const std::string& BinaryWriter::getBuffer() const
+{
+    return buffer;
+}
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace utils
+{
+class BinaryWriter
+{
+public:
+    template <typename T>
+    void write(T value)
+    {
+        static_assert(std::is_arithmetic_v<T>, "BinaryWriter: only arithmetic types can be written");
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void writeString(const std::string&);
+    const std::string& getBuffer() const;
+
+private:
+    std::string buffer;
+};
+}
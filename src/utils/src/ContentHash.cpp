@@ -0,0 +1,22 @@
+#include "ContentHash.h"
+
+namespace utils
+{
+namespace
+{
+constexpr std::uint64_t fnvOffsetBasis{14695981039346656037ull};
+constexpr std::uint64_t fnvPrime{1099511628211ull};
+}
+
+std::uint64_t calculateContentHash(const std::string& content)
+{
+    auto hash = fnvOffsetBasis;
+    for (const auto character : content)
+    {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= fnvPrime;
+    }
+    return hash;
+}
+
+}
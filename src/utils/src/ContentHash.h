@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace utils
+{
+std::uint64_t calculateContentHash(const std::string& content);
+}
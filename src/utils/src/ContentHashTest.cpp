@@ -0,0 +1,28 @@
+#include "ContentHash.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace utils;
+
+class ContentHashTest : public Test
+{
+public:
+    const std::string content{"animators:\n  - name: player\n"};
+    const std::string modifiedContent{"animators:\n  - name: playes\n"};
+};
+
+TEST_F(ContentHashTest, givenSameContent_shouldReturnSameHash)
+{
+    ASSERT_EQ(calculateContentHash(content), calculateContentHash(std::string{content}));
+}
+
+TEST_F(ContentHashTest, givenDifferentContent_shouldReturnDifferentHashes)
+{
+    ASSERT_NE(calculateContentHash(content), calculateContentHash(modifiedContent));
+}
+
+TEST_F(ContentHashTest, givenEmptyContent_shouldReturnFnvOffsetBasis)
+{
+    ASSERT_EQ(calculateContentHash(""), 14695981039346656037ull);
+}
@@ -0,0 +1,120 @@
+#include "DurationHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace utils
+{
+namespace
+{
+unsigned getMostSignificantBit(std::uint64_t value)
+{
+    unsigned mostSignificantBit{0};
+    while (value >>= 1)
+    {
+        mostSignificantBit++;
+    }
+    return mostSignificantBit;
+}
+}
+
+DurationHistogram::DurationHistogram(unsigned subBucketBitsInit, unsigned maxValueBits)
+    : subBucketBits{subBucketBitsInit},
+      maxValue{(std::uint64_t{1} << maxValueBits) - 1},
+      counts(getBucketIndex(maxValue) + 1, 0),
+      totalCount{0},
+      sumOfValues{0},
+      maxRecordedValue{0}
+{
+}
+
+void DurationHistogram::record(std::chrono::microseconds duration)
+{
+    const auto value =
+        std::min(static_cast<std::uint64_t>(std::max<std::int64_t>(duration.count(), 0)), maxValue);
+    counts[getBucketIndex(value)]++;
+    totalCount++;
+    sumOfValues += value;
+    maxRecordedValue = std::max(maxRecordedValue, value);
+}
+
+std::chrono::microseconds DurationHistogram::getValueAtPercentile(double percentile) const
+{
+    if (totalCount == 0)
+    {
+        return std::chrono::microseconds{0};
+    }
+
+    const auto clampedPercentile = std::clamp(percentile, 0.0, 100.0);
+    const auto countAtPercentile = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(clampedPercentile / 100.0 * totalCount)));
+
+    std::uint64_t cumulativeCount{0};
+    for (std::size_t bucketIndex = 0; bucketIndex < counts.size(); bucketIndex++)
+    {
+        cumulativeCount += counts[bucketIndex];
+        if (cumulativeCount >= countAtPercentile)
+        {
+            const auto value = std::min(getHighestValueInBucket(bucketIndex), maxRecordedValue);
+            return std::chrono::microseconds{static_cast<std::int64_t>(value)};
+        }
+    }
+    return getMax();
+}
+
+std::chrono::microseconds DurationHistogram::getMax() const
+{
+    return std::chrono::microseconds{static_cast<std::int64_t>(maxRecordedValue)};
+}
+
+std::chrono::microseconds DurationHistogram::getMean() const
+{
+    if (totalCount == 0)
+    {
+        return std::chrono::microseconds{0};
+    }
+    return std::chrono::microseconds{static_cast<std::int64_t>(sumOfValues / totalCount)};
+}
+
+std::uint64_t DurationHistogram::getTotalCount() const
+{
+    return totalCount;
+}
+
+void DurationHistogram::reset()
+{
+    std::fill(counts.begin(), counts.end(), 0);
+    totalCount = 0;
+    sumOfValues = 0;
+    maxRecordedValue = 0;
+}
+
+std::size_t DurationHistogram::getBucketIndex(std::uint64_t value) const
+{
+    const auto linearRange = std::uint64_t{1} << subBucketBits;
+    if (value < linearRange)
+    {
+        return static_cast<std::size_t>(value);
+    }
+
+    const auto shift = getMostSignificantBit(value) - (subBucketBits - 1);
+    const auto halfLinearRange = linearRange / 2;
+    const auto subBucketIndex = (value >> shift) - halfLinearRange;
+    return static_cast<std::size_t>(linearRange + (shift - 1) * halfLinearRange + subBucketIndex);
+}
+
+std::uint64_t DurationHistogram::getHighestValueInBucket(std::size_t bucketIndex) const
+{
+    const auto linearRange = std::uint64_t{1} << subBucketBits;
+    if (bucketIndex < linearRange)
+    {
+        return bucketIndex;
+    }
+
+    const auto halfLinearRange = linearRange / 2;
+    const auto shift = (bucketIndex - linearRange) / halfLinearRange + 1;
+    const auto subBucketIndex = (bucketIndex - linearRange) % halfLinearRange;
+    return ((halfLinearRange + subBucketIndex + 1) << shift) - 1;
+}
+
+}
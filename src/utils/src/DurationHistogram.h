@@ -0,0 +1,34 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace utils
+{
+// Log-linear histogram of durations in microseconds: every power of two range is split into
+// the same number of linear sub buckets, so relative precision is constant across the range.
+class DurationHistogram
+{
+public:
+    explicit DurationHistogram(unsigned subBucketBits = 7, unsigned maxValueBits = 36);
+
+    void record(std::chrono::microseconds);
+    std::chrono::microseconds getValueAtPercentile(double percentile) const;
+    std::chrono::microseconds getMax() const;
+    std::chrono::microseconds getMean() const;
+    std::uint64_t getTotalCount() const;
+    void reset();
+
+private:
+    std::size_t getBucketIndex(std::uint64_t value) const;
+    std::uint64_t getHighestValueInBucket(std::size_t bucketIndex) const;
+
+    const unsigned subBucketBits;
+    const std::uint64_t maxValue;
+    std::vector<std::uint64_t> counts;
+    std::uint64_t totalCount;
+    std::uint64_t sumOfValues;
+    std::uint64_t maxRecordedValue;
+};
+}
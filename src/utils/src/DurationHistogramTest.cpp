@@ -0,0 +1,75 @@
+#include "DurationHistogram.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace utils;
+using namespace std::chrono_literals;
+
+class DurationHistogramTest : public Test
+{
+public:
+    DurationHistogram histogram;
+};
+
+TEST_F(DurationHistogramTest, givenNoRecordedValues_shouldReturnZeros)
+{
+    ASSERT_EQ(histogram.getTotalCount(), 0u);
+    ASSERT_EQ(histogram.getValueAtPercentile(99), 0us);
+    ASSERT_EQ(histogram.getMax(), 0us);
+    ASSERT_EQ(histogram.getMean(), 0us);
+}
+
+TEST_F(DurationHistogramTest, givenValuesInLinearRange_shouldReturnExactPercentiles)
+{
+    for (auto value = 1; value <= 100; value++)
+    {
+        histogram.record(std::chrono::microseconds{value});
+    }
+
+    ASSERT_EQ(histogram.getTotalCount(), 100u);
+    ASSERT_EQ(histogram.getValueAtPercentile(50), 50us);
+    ASSERT_EQ(histogram.getValueAtPercentile(95), 95us);
+    ASSERT_EQ(histogram.getValueAtPercentile(99), 99us);
+    ASSERT_EQ(histogram.getValueAtPercentile(100), 100us);
+    ASSERT_EQ(histogram.getMean(), 50us);
+}
+
+TEST_F(DurationHistogramTest, givenLargeValues_shouldReturnPercentilesWithinRelativePrecision)
+{
+    for (auto sample = 0; sample < 990; sample++)
+    {
+        histogram.record(16667us);
+    }
+    for (auto sample = 0; sample < 10; sample++)
+    {
+        histogram.record(50000us);
+    }
+
+    const auto p50 = histogram.getValueAtPercentile(50);
+    ASSERT_GE(p50, 16667us);
+    ASSERT_LE(p50.count(), 16667 + 16667 / 64);
+    ASSERT_EQ(histogram.getValueAtPercentile(99), p50);
+    ASSERT_EQ(histogram.getValueAtPercentile(99.9), 50000us);
+    ASSERT_EQ(histogram.getMax(), 50000us);
+}
+
+TEST_F(DurationHistogramTest, givenValueAboveRange_shouldClampIt)
+{
+    DurationHistogram smallHistogram{7, 10};
+
+    smallHistogram.record(5000us);
+
+    ASSERT_EQ(smallHistogram.getMax(), 1023us);
+    ASSERT_EQ(smallHistogram.getValueAtPercentile(100), 1023us);
+}
+
+TEST_F(DurationHistogramTest, reset_shouldDropRecordedValues)
+{
+    histogram.record(10us);
+
+    histogram.reset();
+
+    ASSERT_EQ(histogram.getTotalCount(), 0u);
+    ASSERT_EQ(histogram.getMax(), 0us);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <vector>
+
+#include "FilePath.h"
+
+namespace utils
+{
+class FileWatcher
+{
+public:
+    virtual ~FileWatcher() = default;
+
+    virtual void watchFile(const FilePath&) = 0;
+    virtual std::vector<FilePath> pollChangedFiles() = 0;
+};
+}
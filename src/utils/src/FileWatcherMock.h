@@ -0,0 +1,15 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "FileWatcher.h"
+
+namespace utils
+{
+class FileWatcherMock : public FileWatcher
+{
+public:
+    MOCK_METHOD(void, watchFile, (const FilePath&));
+    MOCK_METHOD(std::vector<FilePath>, pollChangedFiles, ());
+};
+}
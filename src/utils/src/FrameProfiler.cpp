@@ -0,0 +1,161 @@
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "ProfilerZoneBuffer.h"
+
+namespace utils
+{
+namespace
+{
+const auto zoneBufferCapacity{65536u};
+const auto processId{1};
+
+struct ProfilerState
+{
+    std::atomic<bool> enabled{false};
+    const ProfilerClock::time_point startTime{ProfilerClock::now()};
+    std::mutex zoneBuffersMutex;
+    std::vector<std::unique_ptr<ProfilerZoneBuffer>> zoneBuffers;
+};
+
+ProfilerState& getProfilerState()
+{
+    static ProfilerState profilerState;
+    return profilerState;
+}
+
+struct ThreadZoneBuffer
+{
+    ProfilerZoneBuffer* buffer;
+    std::uint32_t threadId;
+};
+
+ThreadZoneBuffer createThreadZoneBuffer()
+{
+    auto& profilerState = getProfilerState();
+    std::lock_guard<std::mutex> lock{profilerState.zoneBuffersMutex};
+    profilerState.zoneBuffers.push_back(std::make_unique<ProfilerZoneBuffer>(zoneBufferCapacity));
+    return {profilerState.zoneBuffers.back().get(),
+            static_cast<std::uint32_t>(profilerState.zoneBuffers.size())};
+}
+
+const ThreadZoneBuffer& getThreadZoneBuffer()
+{
+    thread_local const auto threadZoneBuffer = createThreadZoneBuffer();
+    return threadZoneBuffer;
+}
+
+std::int64_t toNanosecondsSinceStart(ProfilerClock::time_point timePoint)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint - getProfilerState().startTime)
+        .count();
+}
+
+void writeEscapedJsonString(std::ostream& os, const char* text)
+{
+    os << '"';
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '"' || *text == '\\')
+        {
+            os << '\\';
+        }
+        os << *text;
+    }
+    os << '"';
+}
+
+void writeMicroseconds(std::ostream& os, std::int64_t nanoseconds)
+{
+    const auto fraction = nanoseconds % 1000;
+    os << nanoseconds / 1000 << '.' << fraction / 100 << fraction / 10 % 10 << fraction % 10;
+}
+}
+
+void FrameProfiler::setEnabled(bool enabled)
+{
+    getProfilerState().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool FrameProfiler::isEnabled()
+{
+    return getProfilerState().enabled.load(std::memory_order_relaxed);
+}
+
+void FrameProfiler::recordZone(const char* name, ProfilerClock::time_point start,
+                               ProfilerClock::time_point end)
+{
+    const auto& threadZoneBuffer = getThreadZoneBuffer();
+    const auto startNanoseconds = toNanosecondsSinceStart(start);
+    threadZoneBuffer.buffer->push(
+        {name, threadZoneBuffer.threadId, startNanoseconds, toNanosecondsSinceStart(end) - startNanoseconds});
+}
+
+std::vector<ProfilerZone> FrameProfiler::getZones()
+{
+    auto& profilerState = getProfilerState();
+    std::vector<ProfilerZone> zones;
+    {
+        std::lock_guard<std::mutex> lock{profilerState.zoneBuffersMutex};
+        for (const auto& zoneBuffer : profilerState.zoneBuffers)
+        {
+            const auto threadZones = zoneBuffer->getZones();
+            zones.insert(zones.end(), threadZones.begin(), threadZones.end());
+        }
+    }
+    std::stable_sort(zones.begin(), zones.end(), [](const ProfilerZone& lhs, const ProfilerZone& rhs) {
+        return lhs.startNanoseconds < rhs.startNanoseconds;
+    });
+    return zones;
+}
+
+void FrameProfiler::exportChromeTrace(std::ostream& os)
+{
+    os << "{\"traceEvents\":[";
+    auto firstZone = true;
+    for (const auto& zone : getZones())
+    {
+        os << (firstZone ? "\n" : ",\n") << "{\"name\":";
+        writeEscapedJsonString(os, zone.name);
+        os << ",\"cat\":\"chimarrao\",\"ph\":\"X\",\"ts\":";
+        writeMicroseconds(os, zone.startNanoseconds);
+        os << ",\"dur\":";
+        writeMicroseconds(os, zone.durationNanoseconds);
+        os << ",\"pid\":" << processId << ",\"tid\":" << zone.threadId << "}";
+        firstZone = false;
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void FrameProfiler::clear()
+{
+    auto& profilerState = getProfilerState();
+    std::lock_guard<std::mutex> lock{profilerState.zoneBuffersMutex};
+    for (const auto& zoneBuffer : profilerState.zoneBuffers)
+    {
+        zoneBuffer->clear();
+    }
+}
+
+ScopedProfilerZone::ScopedProfilerZone(const char* nameInit)
+    : name{nameInit}, enabled{FrameProfiler::isEnabled()}
+{
+    if (enabled)
+    {
+        start = ProfilerClock::now();
+    }
+}
+
+ScopedProfilerZone::~ScopedProfilerZone()
+{
+    if (enabled)
+    {
+        FrameProfiler::recordZone(name, start, ProfilerClock::now());
+    }
+}
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <vector>
+
+#include "ProfilerZone.h"
+
+namespace utils
+{
+using ProfilerClock = std::chrono::steady_clock;
+
+class FrameProfiler
+{
+public:
+    static void setEnabled(bool);
+    static bool isEnabled();
+    static void recordZone(const char* name, ProfilerClock::time_point start, ProfilerClock::time_point end);
+    static std::vector<ProfilerZone> getZones();
+    static void exportChromeTrace(std::ostream&);
+    static void clear();
+};
+
+class ScopedProfilerZone
+{
+public:
+    explicit ScopedProfilerZone(const char* name);
+    ~ScopedProfilerZone();
+
+    ScopedProfilerZone(const ScopedProfilerZone&) = delete;
+    ScopedProfilerZone& operator=(const ScopedProfilerZone&) = delete;
+
+private:
+    const char* name;
+    bool enabled;
+    ProfilerClock::time_point start;
+};
+}
+
+#define CHIMARRAO_PROFILE_CONCATENATE_IMPL(lhs, rhs) lhs##rhs
+#define CHIMARRAO_PROFILE_CONCATENATE(lhs, rhs) CHIMARRAO_PROFILE_CONCATENATE_IMPL(lhs, rhs)
+
+#ifdef CHIMARRAO_PROFILER_DISABLED
+#define PROFILE_ZONE(name)
+#else
+#define PROFILE_ZONE(name)                                                                                   \
+    const utils::ScopedProfilerZone CHIMARRAO_PROFILE_CONCATENATE(profilerZone, __LINE__){name}
+#endif
+
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
@@ -0,0 +1,83 @@
+#include "FrameProfiler.h"
+
+#include <sstream>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace utils;
+
+namespace
+{
+void profiledFunction()
+{
+    PROFILE_FUNCTION();
+}
+}
+
+class FrameProfilerTest : public Test
+{
+public:
+    FrameProfilerTest()
+    {
+        FrameProfiler::clear();
+    }
+
+    ~FrameProfilerTest()
+    {
+        FrameProfiler::setEnabled(false);
+        FrameProfiler::clear();
+    }
+
+    const ProfilerClock::time_point start{ProfilerClock::now()};
+};
+
+TEST_F(FrameProfilerTest, givenDisabledProfiler_shouldNotRecordScopedZones)
+{
+    FrameProfiler::setEnabled(false);
+
+    {
+        PROFILE_ZONE("disabledZone");
+    }
+
+    ASSERT_TRUE(FrameProfiler::getZones().empty());
+}
+
+TEST_F(FrameProfilerTest, givenEnabledProfiler_shouldRecordScopedZones)
+{
+    FrameProfiler::setEnabled(true);
+
+    {
+        PROFILE_ZONE("outerZone");
+        profiledFunction();
+    }
+
+    const auto zones = FrameProfiler::getZones();
+    ASSERT_EQ(zones.size(), 2u);
+    ASSERT_EQ(std::string{zones[0].name}, "outerZone");
+    ASSERT_EQ(std::string{zones[1].name}, "profiledFunction");
+    ASSERT_GE(zones[0].durationNanoseconds, zones[1].durationNanoseconds);
+}
+
+TEST_F(FrameProfilerTest, zonesRecordedOnDifferentThreads_shouldHaveDifferentThreadIds)
+{
+    FrameProfiler::recordZone("mainThreadZone", start, start);
+    std::thread{[this] { FrameProfiler::recordZone("workerThreadZone", start, start); }}.join();
+
+    const auto zones = FrameProfiler::getZones();
+    ASSERT_EQ(zones.size(), 2u);
+    ASSERT_NE(zones[0].threadId, zones[1].threadId);
+}
+
+TEST_F(FrameProfilerTest, exportChromeTrace_shouldWriteCompleteEvents)
+{
+    FrameProfiler::recordZone("frame", start, start + std::chrono::nanoseconds{1500});
+    std::stringstream trace;
+
+    FrameProfiler::exportChromeTrace(trace);
+
+    ASSERT_NE(trace.str().find("{\"traceEvents\":["), std::string::npos);
+    ASSERT_NE(trace.str().find("\"name\":\"frame\",\"cat\":\"chimarrao\",\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(trace.str().find("\"dur\":1.500"), std::string::npos);
+}
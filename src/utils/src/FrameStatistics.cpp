@@ -0,0 +1,101 @@
+#include "FrameStatistics.h"
+
+#include <iomanip>
+
+namespace utils
+{
+namespace
+{
+const auto frameName{"frame"};
+
+std::chrono::microseconds toMicroseconds(DeltaTime duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration);
+}
+
+double toMilliseconds(std::chrono::microseconds duration)
+{
+    return static_cast<double>(duration.count()) / 1000.0;
+}
+}
+
+FrameStatistics::FrameStatistics(std::vector<std::string> phaseNamesInit, DeltaTime hitchThresholdInit)
+    : phaseNames{std::move(phaseNamesInit)},
+      hitchThreshold{toMicroseconds(hitchThresholdInit)},
+      phaseRecords(phaseNames.size())
+{
+}
+
+void FrameStatistics::recordFrame(DeltaTime frameTime)
+{
+    record(frameRecord, frameTime);
+}
+
+void FrameStatistics::recordPhase(std::size_t phaseIndex, DeltaTime phaseTime)
+{
+    record(phaseRecords.at(phaseIndex), phaseTime);
+}
+
+DurationStatistics FrameStatistics::getFrameStatistics() const
+{
+    return getStatistics(frameName, frameRecord);
+}
+
+DurationStatistics FrameStatistics::getPhaseStatistics(std::size_t phaseIndex) const
+{
+    return getStatistics(phaseNames.at(phaseIndex), phaseRecords.at(phaseIndex));
+}
+
+void FrameStatistics::writeReport(std::ostream& os) const
+{
+    os << "name,count,p50Milliseconds,p95Milliseconds,p99Milliseconds,maxMilliseconds,hitches\n";
+
+    auto writeRow = [&os](const DurationStatistics& statistics) {
+        os << statistics.name << "," << statistics.count << "," << std::fixed << std::setprecision(3)
+           << toMilliseconds(statistics.p50) << "," << toMilliseconds(statistics.p95) << ","
+           << toMilliseconds(statistics.p99) << "," << toMilliseconds(statistics.max) << ","
+           << statistics.hitches << "\n";
+    };
+
+    writeRow(getFrameStatistics());
+    for (std::size_t phaseIndex = 0; phaseIndex < phaseNames.size(); phaseIndex++)
+    {
+        writeRow(getPhaseStatistics(phaseIndex));
+    }
+}
+
+void FrameStatistics::reset()
+{
+    frameRecord.histogram.reset();
+    frameRecord.hitches = 0;
+    for (auto& phaseRecord : phaseRecords)
+    {
+        phaseRecord.histogram.reset();
+        phaseRecord.hitches = 0;
+    }
+}
+
+void FrameStatistics::record(DurationRecord& durationRecord, DeltaTime duration)
+{
+    const auto durationInMicroseconds = toMicroseconds(duration);
+    durationRecord.histogram.record(durationInMicroseconds);
+    if (durationInMicroseconds > hitchThreshold)
+    {
+        durationRecord.hitches++;
+    }
+}
+
+DurationStatistics FrameStatistics::getStatistics(const std::string& name,
+                                                  const DurationRecord& durationRecord) const
+{
+    const auto& histogram = durationRecord.histogram;
+    return {name,
+            histogram.getTotalCount(),
+            histogram.getValueAtPercentile(50),
+            histogram.getValueAtPercentile(95),
+            histogram.getValueAtPercentile(99),
+            histogram.getMax(),
+            durationRecord.hitches};
+}
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "DeltaTime.h"
+#include "DurationHistogram.h"
+
+namespace utils
+{
+struct DurationStatistics
+{
+    std::string name;
+    std::uint64_t count;
+    std::chrono::microseconds p50;
+    std::chrono::microseconds p95;
+    std::chrono::microseconds p99;
+    std::chrono::microseconds max;
+    std::uint64_t hitches;
+};
+
+inline bool operator==(const DurationStatistics& lhs, const DurationStatistics& rhs)
+{
+    auto tieStruct = [](const DurationStatistics& durationStatistics) {
+        return std::tie(durationStatistics.name, durationStatistics.count, durationStatistics.p50,
+                        durationStatistics.p95, durationStatistics.p99, durationStatistics.max,
+                        durationStatistics.hitches);
+    };
+    return tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const DurationStatistics& durationStatistics)
+{
+    return os << "name: " << durationStatistics.name << " count: " << durationStatistics.count
+              << " p50: " << durationStatistics.p50.count() << " p95: " << durationStatistics.p95.count()
+              << " p99: " << durationStatistics.p99.count() << " max: " << durationStatistics.max.count()
+              << " hitches: " << durationStatistics.hitches;
+}
+
+class FrameStatistics
+{
+public:
+    FrameStatistics(std::vector<std::string> phaseNames, DeltaTime hitchThreshold);
+
+    void recordFrame(DeltaTime frameTime);
+    void recordPhase(std::size_t phaseIndex, DeltaTime phaseTime);
+    DurationStatistics getFrameStatistics() const;
+    DurationStatistics getPhaseStatistics(std::size_t phaseIndex) const;
+    void writeReport(std::ostream&) const;
+    void reset();
+
+private:
+    struct DurationRecord
+    {
+        DurationHistogram histogram;
+        std::uint64_t hitches{0};
+    };
+
+    void record(DurationRecord&, DeltaTime duration);
+    DurationStatistics getStatistics(const std::string& name, const DurationRecord&) const;
+
+    const std::vector<std::string> phaseNames;
+    const std::chrono::microseconds hitchThreshold;
+    DurationRecord frameRecord;
+    std::vector<DurationRecord> phaseRecords;
+};
+}
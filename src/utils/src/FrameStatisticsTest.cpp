@@ -0,0 +1,74 @@
+#include "FrameStatistics.h"
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace utils;
+using namespace std::chrono_literals;
+
+class FrameStatisticsTest : public Test
+{
+public:
+    FrameStatistics frameStatistics{{"update", "render"}, DeltaTime{0.02f}};
+};
+
+TEST_F(FrameStatisticsTest, givenNoFrames_shouldReturnEmptyStatistics)
+{
+    ASSERT_EQ(frameStatistics.getFrameStatistics(), (DurationStatistics{"frame", 0, 0us, 0us, 0us, 0us, 0}));
+}
+
+TEST_F(FrameStatisticsTest, shouldCountFramesAboveHitchThreshold)
+{
+    frameStatistics.recordFrame(DeltaTime{0.01f});
+    frameStatistics.recordFrame(DeltaTime{0.015f});
+    frameStatistics.recordFrame(DeltaTime{0.05f});
+
+    const auto statistics = frameStatistics.getFrameStatistics();
+
+    ASSERT_EQ(statistics.count, 3u);
+    ASSERT_EQ(statistics.hitches, 1u);
+    ASSERT_EQ(statistics.max, 50000us);
+}
+
+TEST_F(FrameStatisticsTest, shouldRecordPhasesSeparately)
+{
+    frameStatistics.recordPhase(0, DeltaTime{0.0001f});
+    frameStatistics.recordPhase(1, DeltaTime{0.0001f});
+    frameStatistics.recordPhase(1, DeltaTime{0.0001f});
+
+    ASSERT_EQ(frameStatistics.getPhaseStatistics(0).name, "update");
+    ASSERT_EQ(frameStatistics.getPhaseStatistics(0).count, 1u);
+    ASSERT_EQ(frameStatistics.getPhaseStatistics(1).name, "render");
+    ASSERT_EQ(frameStatistics.getPhaseStatistics(1).count, 2u);
+}
+
+TEST_F(FrameStatisticsTest, givenInvalidPhaseIndex_shouldThrow)
+{
+    ASSERT_THROW(frameStatistics.recordPhase(2, DeltaTime{0.01f}), std::out_of_range);
+}
+
+TEST_F(FrameStatisticsTest, writeReport_shouldWriteCsvRowForFrameAndEachPhase)
+{
+    frameStatistics.recordFrame(DeltaTime{0.1f});
+    std::stringstream report;
+
+    frameStatistics.writeReport(report);
+
+    ASSERT_EQ(report.str(),
+              "name,count,p50Milliseconds,p95Milliseconds,p99Milliseconds,maxMilliseconds,hitches\n"
+              "frame,1,100.000,100.000,100.000,100.000,1\n"
+              "update,0,0.000,0.000,0.000,0.000,0\n"
+              "render,0,0.000,0.000,0.000,0.000,0\n");
+}
+
+TEST_F(FrameStatisticsTest, reset_shouldDropRecordedFramesAndHitches)
+{
+    frameStatistics.recordFrame(DeltaTime{0.05f});
+
+    frameStatistics.reset();
+
+    ASSERT_EQ(frameStatistics.getFrameStatistics().count, 0u);
+    ASSERT_EQ(frameStatistics.getFrameStatistics().hitches, 0u);
+}
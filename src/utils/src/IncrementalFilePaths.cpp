@@ -0,0 +1,52 @@
+#include "IncrementalFilePaths.h"
+
+#include <charconv>
+
+namespace utils
+{
+
+void IncrementalFilePaths::assign(std::string_view prefix, int firstNumber, std::string_view suffix,
+                                  unsigned numberOfFilePaths)
+{
+    clear();
+
+    const auto maxFilePathSize = prefix.size() + maxNumberOfDigits + suffix.size();
+    buffer.reserve(maxFilePathSize * numberOfFilePaths);
+    filePathEndOffsets.reserve(numberOfFilePaths);
+
+    for (unsigned filePathIndex = 0; filePathIndex < numberOfFilePaths; filePathIndex++)
+    {
+        char numberDigits[maxNumberOfDigits];
+        const auto numberEnd = std::to_chars(numberDigits, numberDigits + maxNumberOfDigits,
+                                             firstNumber + static_cast<int>(filePathIndex))
+                                   .ptr;
+        buffer.append(prefix);
+        buffer.append(numberDigits, numberEnd);
+        buffer.append(suffix);
+        filePathEndOffsets.push_back(buffer.size());
+    }
+}
+
+void IncrementalFilePaths::clear()
+{
+    buffer.clear();
+    filePathEndOffsets.clear();
+}
+
+std::size_t IncrementalFilePaths::size() const
+{
+    return filePathEndOffsets.size();
+}
+
+bool IncrementalFilePaths::empty() const
+{
+    return filePathEndOffsets.empty();
+}
+
+std::string_view IncrementalFilePaths::operator[](std::size_t filePathIndex) const
+{
+    const auto filePathBegin = filePathIndex == 0 ? 0 : filePathEndOffsets[filePathIndex - 1];
+    return std::string_view{buffer}.substr(filePathBegin, filePathEndOffsets[filePathIndex] - filePathBegin);
+}
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils
+{
+class IncrementalFilePaths
+{
+public:
+    static constexpr int maxNumberOfDigits{12};
+
+    void assign(std::string_view prefix, int firstNumber, std::string_view suffix,
+                unsigned numberOfFilePaths);
+    void clear();
+    std::size_t size() const;
+    bool empty() const;
+    std::string_view operator[](std::size_t filePathIndex) const;
+
+private:
+    std::string buffer;
+    std::vector<std::size_t> filePathEndOffsets;
+};
+}
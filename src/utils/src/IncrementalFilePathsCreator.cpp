@@ -1,100 +1,96 @@
 #include "IncrementalFilePathsCreator.h"
 
-#include <boost/algorithm/string.hpp>
-#include <sstream>
-
-#include "StringHelper.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
 
 namespace utils
 {
 namespace
 {
 const auto fileNameSeparator{'/'};
+
+bool isDigit(char character)
+{
+    return std::isdigit(static_cast<unsigned char>(character));
+}
 }
 
 FilePaths IncrementalFilePathsCreator::createFilePaths(const FilePath& fullPathToFirstFile,
                                                        unsigned int numberOfIncrementalFiles)
 {
-    if (fullPathToFirstFile.empty() || numberOfIncrementalFiles == 0)
-    {
-        return {};
-    }
-
-    const auto directory = extractDirectory(fullPathToFirstFile);
-    const auto fileName = extractFileName(fullPathToFirstFile);
-
-    if (not directory || not fileName)
+    const auto filePathPattern = parseFilePathPattern(fullPathToFirstFile);
+    if (not filePathPattern || numberOfIncrementalFiles == 0)
     {
         return {};
     }
 
-    if (auto numberFromFileName = extractNumberFromFileName(*fileName))
+    FilePaths filePaths;
+    filePaths.reserve(numberOfIncrementalFiles);
+    for (unsigned fileIndex = 0; fileIndex < numberOfIncrementalFiles; fileIndex++)
     {
-        FilePaths filePaths;
-        for (int i = 0; i < numberOfIncrementalFiles; i++)
-        {
-            auto currentFileNameNumber = *numberFromFileName + i;
-            auto currentFileName = *fileName;
-            boost::replace_all(currentFileName, std::to_string(*numberFromFileName),
-                               std::to_string(currentFileNameNumber));
-            filePaths.push_back(*directory + currentFileName);
-        }
-        return filePaths;
+        char numberDigits[IncrementalFilePaths::maxNumberOfDigits];
+        const auto numberEnd =
+            std::to_chars(numberDigits, numberDigits + IncrementalFilePaths::maxNumberOfDigits,
+                          filePathPattern->firstNumber + static_cast<int>(fileIndex))
+                .ptr;
+        auto& filePath = filePaths.emplace_back();
+        filePath.reserve(filePathPattern->prefix.size() + static_cast<std::size_t>(numberEnd - numberDigits) +
+                         filePathPattern->suffix.size());
+        filePath.append(filePathPattern->prefix);
+        filePath.append(numberDigits, numberEnd);
+        filePath.append(filePathPattern->suffix);
     }
-    return {};
+    return filePaths;
 }
 
-boost::optional<std::string> IncrementalFilePathsCreator::extractDirectory(const FilePath& filePath)
+void IncrementalFilePathsCreator::createFilePaths(const FilePath& fullPathToFirstFile,
+                                                  unsigned int numberOfIncrementalFiles,
+                                                  IncrementalFilePaths& filePaths)
 {
-    const auto fileNameSeparatorIndex = filePath.rfind(fileNameSeparator);
-    if (fileNameSeparatorIndex != std::string::npos)
+    const auto filePathPattern = parseFilePathPattern(fullPathToFirstFile);
+    if (not filePathPattern)
     {
-        return utils::substring(filePath, 0, fileNameSeparatorIndex + 1);
+        filePaths.clear();
+        return;
     }
-    return boost::none;
+    filePaths.assign(filePathPattern->prefix, filePathPattern->firstNumber, filePathPattern->suffix,
+                     numberOfIncrementalFiles);
 }
 
-boost::optional<std::string> IncrementalFilePathsCreator::extractFileName(const FilePath& filePath)
+boost::optional<IncrementalFilePathsCreator::FilePathPattern>
+IncrementalFilePathsCreator::parseFilePathPattern(std::string_view fullPathToFirstFile)
 {
-    const auto fileNameSeparatorIndex = filePath.rfind(fileNameSeparator);
-    if (fileNameSeparatorIndex != std::string::npos && fileNameSeparatorIndex + 1 < filePath.size())
+    const auto fileNameSeparatorIndex = fullPathToFirstFile.rfind(fileNameSeparator);
+    if (fileNameSeparatorIndex == std::string_view::npos)
     {
-        return utils::substring(filePath, fileNameSeparatorIndex + 1, filePath.size());
+        return boost::none;
     }
-    return boost::none;
-}
 
-boost::optional<int> IncrementalFilePathsCreator::extractNumberFromFileName(const FilePath& filePath)
-{
-    int numberCounter{0};
-    std::string numberAsString;
-    int number;
+    const auto fileNameBegin = fullPathToFirstFile.cbegin() + fileNameSeparatorIndex + 1;
+    const auto numberBegin = std::find_if(fileNameBegin, fullPathToFirstFile.cend(), isDigit);
+    const auto numberEnd = std::find_if_not(numberBegin, fullPathToFirstFile.cend(), isDigit);
+    const auto hasLeadingZero = numberEnd - numberBegin > 1 && *numberBegin == '0';
 
-    int i = 0;
-    while (i < filePath.size() && numberCounter < 2)
+    if (numberBegin == numberEnd || hasLeadingZero ||
+        std::any_of(numberEnd, fullPathToFirstFile.cend(), isDigit))
     {
-        if (isdigit(filePath[i]))
-        {
-            numberCounter++;
-            if (numberCounter == 1)
-            {
-                std::stringstream tempStream{std::string(filePath.cbegin() + i, filePath.cend())};
-                tempStream >> number;
-                numberAsString = std::to_string(number);
-                i += numberAsString.size();
-                continue;
-            }
-        }
-        i++;
+        return boost::none;
     }
 
-    int numberPosition = filePath.find(numberAsString);
-    if (numberCounter != 1 || numberPosition == std::string::npos)
+    int firstNumber;
+    const auto numberBeginIndex = static_cast<std::size_t>(numberBegin - fullPathToFirstFile.cbegin());
+    const auto numberEndIndex = static_cast<std::size_t>(numberEnd - fullPathToFirstFile.cbegin());
+    const auto numberDigits = fullPathToFirstFile.substr(numberBeginIndex, numberEndIndex - numberBeginIndex);
+    const auto numberParsingResult =
+        std::from_chars(numberDigits.data(), numberDigits.data() + numberDigits.size(), firstNumber);
+    if (numberParsingResult.ec != std::errc{})
     {
         return boost::none;
     }
 
-    return std::stoi(numberAsString);
+    return FilePathPattern{fullPathToFirstFile.substr(0, numberBeginIndex), firstNumber,
+                           fullPathToFirstFile.substr(numberEndIndex)};
 }
 
-}
\ No newline at end of file
+}
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <string_view>
 
 #include "FilePath.h"
+#include "IncrementalFilePaths.h"
 
 namespace utils
 {
@@ -10,10 +12,17 @@ class IncrementalFilePathsCreator
 {
 public:
     static FilePaths createFilePaths(const FilePath& fullPathToFirstFile, unsigned numberOfIncrementalFiles);
+    static void createFilePaths(const FilePath& fullPathToFirstFile, unsigned numberOfIncrementalFiles,
+                                IncrementalFilePaths&);
 
 private:
-    static boost::optional<std::string> extractDirectory(const FilePath&);
-    static boost::optional<std::string> extractFileName(const FilePath&);
-    static boost::optional<int> extractNumberFromFileName(const FilePath&);
+    struct FilePathPattern
+    {
+        std::string_view prefix;
+        int firstNumber;
+        std::string_view suffix;
+    };
+
+    static boost::optional<FilePathPattern> parseFilePathPattern(std::string_view fullPathToFirstFile);
 };
-}
\ No newline at end of file
+}
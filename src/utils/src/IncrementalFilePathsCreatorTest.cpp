@@ -12,6 +12,8 @@ const auto filePathWithoutNumberInFileName{"something/file.txt"};
 const auto filePathWithoutFileNameSeparator{"xxxx"};
 const auto filePathWithMultipleNumbersInFileName{"something/33file11.txt"};
 const auto filePathWithFileNameSeparator{"something/file11.txt"};
+const auto filePathWithNumberInDirectory{"resources/1 Enemy/idle8.png"};
+const auto filePathWithLeadingZeroNumber{"something/file01.txt"};
 const FilePaths filePaths{"something/file11.txt", "something/file12.txt", "something/file13.txt"};
 }
 
@@ -62,4 +64,42 @@ TEST_F(IncrementalFilePathsCreatorTest,
     const auto actualFilePaths = filePathsCreator.createFilePaths(filePathWithFileNameSeparator, 3);
 
     ASSERT_EQ(actualFilePaths, filePaths);
-}
\ No newline at end of file
+}
+
+TEST_F(IncrementalFilePathsCreatorTest, givenNumberInDirectory_shouldIncrementOnlyNumberInFileName)
+{
+    const auto actualFilePaths = filePathsCreator.createFilePaths(filePathWithNumberInDirectory, 2);
+
+    ASSERT_EQ(actualFilePaths, (FilePaths{"resources/1 Enemy/idle8.png", "resources/1 Enemy/idle9.png"}));
+}
+
+TEST_F(IncrementalFilePathsCreatorTest, givenNumberWithLeadingZero_shouldReturnEmptyFilePaths)
+{
+    const auto actualFilePaths = filePathsCreator.createFilePaths(filePathWithLeadingZeroNumber, 3);
+
+    ASSERT_TRUE(actualFilePaths.empty());
+}
+
+TEST_F(IncrementalFilePathsCreatorTest,
+       givenValidFilePathAndIncrementalFilePaths_shouldCreateFilePathsWithIncrementedNames)
+{
+    IncrementalFilePaths actualFilePaths;
+
+    filePathsCreator.createFilePaths(filePathWithFileNameSeparator, 3, actualFilePaths);
+
+    ASSERT_EQ(actualFilePaths.size(), filePaths.size());
+    ASSERT_EQ(actualFilePaths[0], filePaths[0]);
+    ASSERT_EQ(actualFilePaths[1], filePaths[1]);
+    ASSERT_EQ(actualFilePaths[2], filePaths[2]);
+}
+
+TEST_F(IncrementalFilePathsCreatorTest,
+       givenFilePathWithoutNumberAndIncrementalFilePaths_shouldClearPreviouslyCreatedFilePaths)
+{
+    IncrementalFilePaths actualFilePaths;
+    filePathsCreator.createFilePaths(filePathWithFileNameSeparator, 3, actualFilePaths);
+
+    filePathsCreator.createFilePaths(filePathWithoutNumberInFileName, 3, actualFilePaths);
+
+    ASSERT_TRUE(actualFilePaths.empty());
+}
@@ -0,0 +1,39 @@
+#include "IncrementalFilePaths.h"
+
+#include "gtest/gtest.h"
+
+using namespace utils;
+using namespace ::testing;
+
+class IncrementalFilePathsTest : public Test
+{
+public:
+    IncrementalFilePaths filePaths;
+};
+
+TEST_F(IncrementalFilePathsTest, givenZeroNumberOfFilePaths_shouldBeEmpty)
+{
+    filePaths.assign("idle/idle", 1, ".png", 0);
+
+    ASSERT_TRUE(filePaths.empty());
+}
+
+TEST_F(IncrementalFilePathsTest, assign_shouldCreateFilePathsWithIncrementedNumbers)
+{
+    filePaths.assign("idle/idle", 9, ".png", 3);
+
+    ASSERT_EQ(filePaths.size(), 3u);
+    ASSERT_EQ(filePaths[0], "idle/idle9.png");
+    ASSERT_EQ(filePaths[1], "idle/idle10.png");
+    ASSERT_EQ(filePaths[2], "idle/idle11.png");
+}
+
+TEST_F(IncrementalFilePathsTest, assignAgain_shouldReplacePreviousFilePaths)
+{
+    filePaths.assign("idle/idle", 1, ".png", 3);
+
+    filePaths.assign("walk/walk", 5, ".png", 1);
+
+    ASSERT_EQ(filePaths.size(), 1u);
+    ASSERT_EQ(filePaths[0], "walk/walk5.png");
+}
@@ -0,0 +1,115 @@
+#include "InotifyFileWatcher.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace utils
+{
+namespace
+{
+constexpr auto invalidDescriptor{-1};
+
+std::string getNormalizedPath(const std::filesystem::path& directory, const std::string& fileName)
+{
+    return (directory / fileName).lexically_normal().string();
+}
+}
+
+#ifdef __linux__
+
+InotifyFileWatcher::InotifyFileWatcher() : inotifyDescriptor{inotify_init1(IN_NONBLOCK | IN_CLOEXEC)} {}
+
+InotifyFileWatcher::~InotifyFileWatcher()
+{
+    if (inotifyDescriptor != invalidDescriptor)
+    {
+        close(inotifyDescriptor);
+    }
+}
+
+void InotifyFileWatcher::watchFile(const FilePath& filePath)
+{
+    if (inotifyDescriptor == invalidDescriptor)
+    {
+        return;
+    }
+
+    const std::filesystem::path path{filePath};
+    const auto directory = path.has_parent_path() ? path.parent_path() : std::filesystem::path{"."};
+    const auto normalizedPath = getNormalizedPath(directory, path.filename().string());
+    if (watchedFiles.count(normalizedPath))
+    {
+        return;
+    }
+
+    const auto watchDescriptor =
+        inotify_add_watch(inotifyDescriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (watchDescriptor == invalidDescriptor)
+    {
+        return;
+    }
+
+    watchedDirectories[watchDescriptor] = directory.string();
+    watchedFiles[normalizedPath] = filePath;
+}
+
+std::vector<FilePath> InotifyFileWatcher::pollChangedFiles()
+{
+    std::vector<FilePath> changedFiles;
+    if (inotifyDescriptor == invalidDescriptor)
+    {
+        return changedFiles;
+    }
+
+    alignas(inotify_event) char buffer[4096];
+    ssize_t numberOfReadBytes;
+    while ((numberOfReadBytes = read(inotifyDescriptor, buffer, sizeof(buffer))) > 0)
+    {
+        for (auto eventPosition = buffer; eventPosition < buffer + numberOfReadBytes;)
+        {
+            const auto* event = reinterpret_cast<const inotify_event*>(eventPosition);
+            eventPosition += sizeof(inotify_event) + event->len;
+
+            const auto directoryIter = watchedDirectories.find(event->wd);
+            if (event->len == 0 || directoryIter == watchedDirectories.cend())
+            {
+                continue;
+            }
+
+            const auto fileIter = watchedFiles.find(getNormalizedPath(directoryIter->second, event->name));
+            if (fileIter == watchedFiles.cend())
+            {
+                continue;
+            }
+
+            const auto& changedFile = fileIter->second;
+            if (std::find(changedFiles.cbegin(), changedFiles.cend(), changedFile) == changedFiles.cend())
+            {
+                changedFiles.push_back(changedFile);
+            }
+        }
+    }
+    return changedFiles;
+}
+
+#else
+
+InotifyFileWatcher::InotifyFileWatcher() : inotifyDescriptor{invalidDescriptor} {}
+
+InotifyFileWatcher::~InotifyFileWatcher() = default;
+
+void InotifyFileWatcher::watchFile(const FilePath&) {}
+
+std::vector<FilePath> InotifyFileWatcher::pollChangedFiles()
+{
+    return {};
+}
+
+#endif
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "FileWatcher.h"
+
+namespace utils
+{
+class InotifyFileWatcher : public FileWatcher
+{
+public:
+    InotifyFileWatcher();
+    ~InotifyFileWatcher();
+    InotifyFileWatcher(const InotifyFileWatcher&) = delete;
+    InotifyFileWatcher& operator=(const InotifyFileWatcher&) = delete;
+
+    void watchFile(const FilePath&) override;
+    std::vector<FilePath> pollChangedFiles() override;
+
+private:
+    int inotifyDescriptor;
+    std::unordered_map<int, std::string> watchedDirectories;
+    std::unordered_map<std::string, FilePath> watchedFiles;
+};
+}
@@ -0,0 +1,66 @@
+#include "InotifyFileWatcher.h"
+
+#include <filesystem>
+
+#include "gtest/gtest.h"
+
+#include "BinaryFile.h"
+
+using namespace ::testing;
+using namespace utils;
+
+class InotifyFileWatcherTest : public Test
+{
+public:
+    InotifyFileWatcherTest()
+    {
+        std::filesystem::create_directories(directory);
+        writeBinaryFile(watchedFilePath, "idle");
+        writeBinaryFile(notWatchedFilePath, "walk");
+    }
+
+    ~InotifyFileWatcherTest()
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    const std::filesystem::path directory{std::filesystem::temp_directory_path() / "InotifyFileWatcherTest"};
+    const FilePath watchedFilePath{(directory / "watched.yaml").string()};
+    const FilePath notWatchedFilePath{(directory / "notWatched.yaml").string()};
+    InotifyFileWatcher fileWatcher;
+};
+
+TEST_F(InotifyFileWatcherTest, givenNoChanges_shouldReturnNoChangedFiles)
+{
+    fileWatcher.watchFile(watchedFilePath);
+
+    ASSERT_TRUE(fileWatcher.pollChangedFiles().empty());
+}
+
+TEST_F(InotifyFileWatcherTest, givenWatchedFileWrittenTwice_shouldReturnItOnce)
+{
+    fileWatcher.watchFile(watchedFilePath);
+    writeBinaryFile(watchedFilePath, "attack");
+    writeBinaryFile(watchedFilePath, "hit");
+
+    ASSERT_EQ(fileWatcher.pollChangedFiles(), std::vector<FilePath>{watchedFilePath});
+    ASSERT_TRUE(fileWatcher.pollChangedFiles().empty());
+}
+
+TEST_F(InotifyFileWatcherTest, givenNotWatchedFileInWatchedDirectoryChanged_shouldReturnNoChangedFiles)
+{
+    fileWatcher.watchFile(watchedFilePath);
+    writeBinaryFile(notWatchedFilePath, "attack");
+
+    ASSERT_TRUE(fileWatcher.pollChangedFiles().empty());
+}
+
+TEST_F(InotifyFileWatcherTest, givenWatchedFileReplacedByRename_shouldReturnIt)
+{
+    const auto temporaryFilePath = watchedFilePath + ".tmp";
+    fileWatcher.watchFile(watchedFilePath);
+    writeBinaryFile(temporaryFilePath, "attack");
+    std::filesystem::rename(temporaryFilePath, watchedFilePath);
+
+    ASSERT_EQ(fileWatcher.pollChangedFiles(), std::vector<FilePath>{watchedFilePath});
+}
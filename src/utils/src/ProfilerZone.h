@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <tuple>
+
+namespace utils
+{
+struct ProfilerZone
+{
+    const char* name;
+    std::uint32_t threadId;
+    std::int64_t startNanoseconds;
+    std::int64_t durationNanoseconds;
+};
+
+inline bool operator==(const ProfilerZone& lhs, const ProfilerZone& rhs)
+{
+    auto tieStruct = [](const ProfilerZone& zone) {
+        return std::tie(zone.threadId, zone.startNanoseconds, zone.durationNanoseconds);
+    };
+    return std::string{lhs.name} == std::string{rhs.name} && tieStruct(lhs) == tieStruct(rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const ProfilerZone& zone)
+{
+    return os << "name: " << zone.name << " threadId: " << zone.threadId
+              << " startNanoseconds: " << zone.startNanoseconds
+              << " durationNanoseconds: " << zone.durationNanoseconds;
+}
+}
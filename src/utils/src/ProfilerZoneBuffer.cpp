@@ -0,0 +1,45 @@
+#include "ProfilerZoneBuffer.h"
+
+#include <algorithm>
+
+namespace utils
+{
+
+ProfilerZoneBuffer::ProfilerZoneBuffer(std::size_t capacity)
+    : zones(capacity), numberOfPushedZones{0}, firstZoneIndex{0}
+{
+}
+
+void ProfilerZoneBuffer::push(const ProfilerZone& zone)
+{
+    const auto zoneIndex = numberOfPushedZones.load(std::memory_order_relaxed);
+    zones[zoneIndex % zones.size()] = zone;
+    numberOfPushedZones.store(zoneIndex + 1, std::memory_order_release);
+}
+
+std::vector<ProfilerZone> ProfilerZoneBuffer::getZones() const
+{
+    const auto endIndex = numberOfPushedZones.load(std::memory_order_acquire);
+    const auto beginIndex =
+        std::max(firstZoneIndex.load(std::memory_order_relaxed), endIndex - std::min(endIndex, zones.size()));
+
+    std::vector<ProfilerZone> storedZones;
+    storedZones.reserve(endIndex - beginIndex);
+    for (auto zoneIndex = beginIndex; zoneIndex < endIndex; zoneIndex++)
+    {
+        storedZones.push_back(zones[zoneIndex % zones.size()]);
+    }
+    return storedZones;
+}
+
+std::size_t ProfilerZoneBuffer::getNumberOfPushedZones() const
+{
+    return numberOfPushedZones.load(std::memory_order_acquire);
+}
+
+void ProfilerZoneBuffer::clear()
+{
+    firstZoneIndex.store(numberOfPushedZones.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+}
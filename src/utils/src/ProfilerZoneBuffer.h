@@ -0,0 +1,28 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "ProfilerZone.h"
+
+namespace utils
+{
+// Single producer ring buffer: only the owning thread pushes. Other threads may call getZones and clear
+// only once the owning thread has stopped pushing, as the trace export at exit does, because zone slots
+// are not atomic and push overwrites them after wrap-around.
+class ProfilerZoneBuffer
+{
+public:
+    explicit ProfilerZoneBuffer(std::size_t capacity);
+
+    void push(const ProfilerZone&);
+    std::vector<ProfilerZone> getZones() const;
+    std::size_t getNumberOfPushedZones() const;
+    void clear();
+
+private:
+    std::vector<ProfilerZone> zones;
+    std::atomic<std::size_t> numberOfPushedZones;
+    std::atomic<std::size_t> firstZoneIndex;
+};
+}
@@ -0,0 +1,43 @@
+#include "ProfilerZoneBuffer.h"
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace utils;
+
+class ProfilerZoneBufferTest : public Test
+{
+public:
+    const ProfilerZone zone1{"zone1", 1, 0, 10};
+    const ProfilerZone zone2{"zone2", 1, 10, 20};
+    const ProfilerZone zone3{"zone3", 1, 30, 5};
+    ProfilerZoneBuffer buffer{2};
+};
+
+TEST_F(ProfilerZoneBufferTest, pushedZones_shouldBeReturnedOldestFirst)
+{
+    buffer.push(zone1);
+    buffer.push(zone2);
+
+    ASSERT_EQ(buffer.getZones(), (std::vector<ProfilerZone>{zone1, zone2}));
+}
+
+TEST_F(ProfilerZoneBufferTest, givenFullBuffer_shouldOverwriteOldestZone)
+{
+    buffer.push(zone1);
+    buffer.push(zone2);
+    buffer.push(zone3);
+
+    ASSERT_EQ(buffer.getZones(), (std::vector<ProfilerZone>{zone2, zone3}));
+    ASSERT_EQ(buffer.getNumberOfPushedZones(), 3u);
+}
+
+TEST_F(ProfilerZoneBufferTest, clear_shouldDropZonesPushedBefore)
+{
+    buffer.push(zone1);
+
+    buffer.clear();
+    buffer.push(zone2);
+
+    ASSERT_EQ(buffer.getZones(), (std::vector<ProfilerZone>{zone2}));
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <iostream>
+
+#include "SFML/Graphics/Rect.hpp"
+
+namespace utils
+{
+using FloatRect = sf::FloatRect;
+using IntRect = sf::IntRect;
+}
+
+namespace sf
+{
+inline std::ostream& operator<<(std::ostream& os, const utils::FloatRect& rect)
+{
+    return os << "{" << rect.left << ", " << rect.top << ", " << rect.width << ", " << rect.height << "}";
+}
+
+inline std::ostream& operator<<(std::ostream& os, const utils::IntRect& rect)
+{
+    return os << "{" << rect.left << ", " << rect.top << ", " << rect.width << ", " << rect.height << "}";
+}
+}
@@ -0,0 +1,21 @@
+#include "SimulationTimer.h"
+
+namespace utils
+{
+
+void SimulationTimer::update(const DeltaTime& deltaTime)
+{
+    elapsed += deltaTime;
+}
+
+void SimulationTimer::restart()
+{
+    elapsed = DeltaTime{0};
+}
+
+float SimulationTimer::getElapsedSeconds() const
+{
+    return elapsed.count();
+}
+
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "DeltaTime.h"
+
+namespace utils
+{
+// Measures time by accumulating frame delta times, so a replayed frame sequence always measures the same
+// elapsed time regardless of wall-clock speed.
+class SimulationTimer
+{
+public:
+    void update(const DeltaTime&);
+    void restart();
+    float getElapsedSeconds() const;
+
+private:
+    DeltaTime elapsed{0};
+};
+}
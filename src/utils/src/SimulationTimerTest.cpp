@@ -0,0 +1,34 @@
+#include "SimulationTimer.h"
+
+#include "gtest/gtest.h"
+
+using namespace utils;
+
+class SimulationTimerTest : public testing::Test
+{
+public:
+    SimulationTimer timer;
+};
+
+TEST_F(SimulationTimerTest, newTimer_shouldHaveNoElapsedTime)
+{
+    ASSERT_FLOAT_EQ(timer.getElapsedSeconds(), 0.f);
+}
+
+TEST_F(SimulationTimerTest, shouldAccumulateDeltaTimes)
+{
+    timer.update(DeltaTime{0.25f});
+    timer.update(DeltaTime{0.5f});
+
+    ASSERT_FLOAT_EQ(timer.getElapsedSeconds(), 0.75f);
+}
+
+TEST_F(SimulationTimerTest, restart_shouldResetElapsedTime)
+{
+    timer.update(DeltaTime{0.25f});
+
+    timer.restart();
+    timer.update(DeltaTime{0.1f});
+
+    ASSERT_FLOAT_EQ(timer.getElapsedSeconds(), 0.1f);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "AllocationTracker.h"
+
+namespace utils
+{
+// Allocates straight from malloc and records the memory under Tag, so it is accounted for even when the
+// global allocation hooks are not linked in, and never counted twice when they are.
+template <typename T, AllocationTag Tag>
+class TaggedAllocator
+{
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TaggedAllocator<U, Tag>;
+    };
+
+    TaggedAllocator() = default;
+
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U, Tag>&)
+    {
+    }
+
+    T* allocate(std::size_t numberOfObjects)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Overaligned types are not supported");
+
+        const auto size = numberOfObjects * sizeof(T);
+        auto memory = std::malloc(size);
+        if (not memory)
+        {
+            throw std::bad_alloc{};
+        }
+        AllocationTracker::recordAllocation(Tag, size);
+        return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* memory, std::size_t numberOfObjects)
+    {
+        AllocationTracker::recordDeallocation(Tag, numberOfObjects * sizeof(T));
+        std::free(memory);
+    }
+};
+
+template <typename T, typename U, AllocationTag Tag>
+bool operator==(const TaggedAllocator<T, Tag>&, const TaggedAllocator<U, Tag>&)
+{
+    return true;
+}
+
+template <typename T, typename U, AllocationTag Tag>
+bool operator!=(const TaggedAllocator<T, Tag>&, const TaggedAllocator<U, Tag>&)
+{
+    return false;
+}
+}
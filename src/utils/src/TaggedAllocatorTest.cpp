@@ -0,0 +1,39 @@
+#include "TaggedAllocator.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace utils;
+
+TEST(TaggedAllocatorTest, containerAllocations_shouldBeAttributedToTag)
+{
+    const auto statisticsBefore = AllocationTracker::getStatistics(AllocationTag::Animations);
+
+    {
+        std::vector<std::uint32_t, TaggedAllocator<std::uint32_t, AllocationTag::Animations>> values;
+        values.reserve(16);
+
+        const auto statisticsDuring = AllocationTracker::getStatistics(AllocationTag::Animations);
+        ASSERT_EQ(statisticsDuring.numberOfAllocations - statisticsBefore.numberOfAllocations, 1u);
+        ASSERT_EQ(statisticsDuring.liveBytes - statisticsBefore.liveBytes, 16u * sizeof(std::uint32_t));
+    }
+
+    const auto statisticsAfter = AllocationTracker::getStatistics(AllocationTag::Animations);
+    ASSERT_EQ(statisticsAfter.liveBytes, statisticsBefore.liveBytes);
+}
+
+TEST(TaggedAllocatorTest, allocateShared_shouldAttributeControlBlockAndObjectToTag)
+{
+    const auto statisticsBefore = AllocationTracker::getStatistics(AllocationTag::Components);
+
+    const auto value =
+        std::allocate_shared<std::uint64_t>(TaggedAllocator<std::uint64_t, AllocationTag::Components>{}, 42u);
+
+    const auto statisticsAfter = AllocationTracker::getStatistics(AllocationTag::Components);
+    ASSERT_EQ(*value, 42u);
+    ASSERT_EQ(statisticsAfter.numberOfAllocations - statisticsBefore.numberOfAllocations, 1u);
+    ASSERT_GE(statisticsAfter.liveBytes - statisticsBefore.liveBytes, sizeof(std::uint64_t));
+}
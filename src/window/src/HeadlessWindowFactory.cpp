@@ -0,0 +1,14 @@
+#include "HeadlessWindowFactory.h"
+
+#include "DefaultWindowObservationHandler.h"
+#include "WindowHeadless.h"
+
+namespace window
+{
+
+std::unique_ptr<Window> HeadlessWindowFactory::createWindow(const utils::Vector2u& windowSize,
+                                                            const std::string&) const
+{
+    return std::make_unique<WindowHeadless>(windowSize, std::make_unique<DefaultWindowObservationHandler>());
+}
+}
@@ -25,6 +25,7 @@ public:
     virtual void close() = 0;
     virtual void setView(const sf::View&) = 0;
     virtual bool pollEvent(sf::Event& event) const = 0;
+    virtual void handleEvent(const sf::Event& event) = 0;
     virtual utils::Vector2f getMousePosition() const = 0;
     virtual WindowSettings getWindowSettings() const = 0;
     virtual bool setDisplayMode(DisplayMode) = 0;
@@ -1,6 +1,7 @@
 #include "WindowFactory.h"
 
 #include "DefaultWindowFactory.h"
+#include "HeadlessWindowFactory.h"
 
 namespace window
 {
@@ -9,4 +10,9 @@ std::unique_ptr<WindowFactory> WindowFactory::createWindowFactory()
 {
     return std::make_unique<DefaultWindowFactory>();
 }
+
+std::unique_ptr<WindowFactory> WindowFactory::createHeadlessWindowFactory()
+{
+    return std::make_unique<HeadlessWindowFactory>();
+}
 }
\ No newline at end of file
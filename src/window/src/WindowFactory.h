@@ -16,5 +16,6 @@ public:
                                                  const std::string& title) const = 0;
 
     static std::unique_ptr<WindowFactory> createWindowFactory();
+    static std::unique_ptr<WindowFactory> createHeadlessWindowFactory();
 };
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "WindowHeadless.h"
+
+#include <SFML/Window/Event.hpp>
+
+#include "SupportedFrameLimitsRetriever.h"
+
+namespace window
+{
+WindowHeadless::WindowHeadless(const utils::Vector2u& windowSize,
+                               std::unique_ptr<WindowObservationHandler> observationHandlerInit)
+    : windowSettings{DisplayMode::Window, Resolution{windowSize.x, windowSize.y}, false, 0},
+      observationHandler{std::move(observationHandlerInit)},
+      open{true},
+      mousePosition{0, 0},
+      numberOfDisplayedFrames{0}
+{
+}
+
+bool WindowHeadless::isOpen() const
+{
+    return open;
+}
+
+void WindowHeadless::display()
+{
+    numberOfDisplayedFrames++;
+}
+
+void WindowHeadless::update() {}
+
+void WindowHeadless::close()
+{
+    open = false;
+}
+
+void WindowHeadless::setView(const sf::View&) {}
+
+bool WindowHeadless::pollEvent(sf::Event&) const
+{
+    return false;
+}
+
+void WindowHeadless::handleEvent(const sf::Event& event)
+{
+    if (event.type == sf::Event::Closed)
+    {
+        close();
+    }
+    if (event.type == sf::Event::Resized)
+    {
+        windowSettings.resolution = Resolution{event.size.width, event.size.height};
+        notifyObservers();
+    }
+}
+
+utils::Vector2f WindowHeadless::getMousePosition() const
+{
+    return mousePosition;
+}
+
+WindowSettings WindowHeadless::getWindowSettings() const
+{
+    return windowSettings;
+}
+
+bool WindowHeadless::setDisplayMode(DisplayMode displayMode)
+{
+    if (displayMode != windowSettings.displayMode)
+    {
+        windowSettings.displayMode = displayMode;
+        return true;
+    }
+    return false;
+}
+
+bool WindowHeadless::setVerticalSync(bool vsyncEnabled)
+{
+    if (vsyncEnabled != windowSettings.vsync)
+    {
+        windowSettings.vsync = vsyncEnabled;
+        return true;
+    }
+    return false;
+}
+
+bool WindowHeadless::setFramerateLimit(unsigned int frameLimit)
+{
+    if (frameLimit != windowSettings.frameLimit)
+    {
+        windowSettings.frameLimit = frameLimit;
+        return true;
+    }
+    return false;
+}
+
+bool WindowHeadless::setResolution(const Resolution& resolution)
+{
+    if (resolution != windowSettings.resolution)
+    {
+        windowSettings.resolution = resolution;
+        return true;
+    }
+    return false;
+}
+
+std::vector<Resolution> WindowHeadless::getSupportedResolutions() const
+{
+    return {windowSettings.resolution};
+}
+
+std::vector<unsigned int> WindowHeadless::getSupportedFrameLimits() const
+{
+    return SupportedFrameLimitsRetriever::retrieveSupportedFrameLimits();
+}
+
+void WindowHeadless::registerObserver(WindowObserver* observer)
+{
+    observationHandler->registerObserver(observer);
+}
+
+void WindowHeadless::removeObserver(WindowObserver* observer)
+{
+    observationHandler->removeObserver(observer);
+}
+
+void WindowHeadless::setMousePosition(const utils::Vector2f& position)
+{
+    mousePosition = position;
+}
+
+std::size_t WindowHeadless::getNumberOfDisplayedFrames() const
+{
+    return numberOfDisplayedFrames;
+}
+
+void WindowHeadless::notifyObservers()
+{
+    observationHandler->notifyObservers({windowSettings.resolution.width, windowSettings.resolution.height});
+}
+
+}
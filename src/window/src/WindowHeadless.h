@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+
+#include "Window.h"
+#include "WindowObservationHandler.h"
+
+namespace window
+{
+class WindowHeadless : public Window
+{
+public:
+    WindowHeadless(const utils::Vector2u& windowSize, std::unique_ptr<WindowObservationHandler>);
+
+    bool isOpen() const override;
+    void display() override;
+    void update() override;
+    void close() override;
+    void setView(const sf::View&) override;
+    bool pollEvent(sf::Event& event) const override;
+    void handleEvent(const sf::Event& event) override;
+    utils::Vector2f getMousePosition() const override;
+    WindowSettings getWindowSettings() const override;
+    bool setDisplayMode(DisplayMode) override;
+    bool setVerticalSync(bool vsyncEnabled) override;
+    bool setFramerateLimit(unsigned int frameLimit) override;
+    bool setResolution(const Resolution&) override;
+    std::vector<Resolution> getSupportedResolutions() const override;
+    std::vector<unsigned int> getSupportedFrameLimits() const override;
+    void registerObserver(WindowObserver*) override;
+    void removeObserver(WindowObserver*) override;
+    void setMousePosition(const utils::Vector2f&);
+    std::size_t getNumberOfDisplayedFrames() const;
+
+private:
+    void notifyObservers() override;
+
+    WindowSettings windowSettings;
+    std::unique_ptr<WindowObservationHandler> observationHandler;
+    bool open;
+    utils::Vector2f mousePosition;
+    std::size_t numberOfDisplayedFrames;
+};
+}
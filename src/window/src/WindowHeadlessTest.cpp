@@ -0,0 +1,80 @@
+#include "WindowHeadless.h"
+
+#include <SFML/Window/Event.hpp>
+
+#include "gtest/gtest.h"
+
+#include "WindowObservationHandlerMock.h"
+
+using namespace ::testing;
+using namespace window;
+
+namespace
+{
+const utils::Vector2u windowSize{800, 600};
+const utils::Vector2u windowSizeChanged{1024, 768};
+const WindowSettings initialWindowSettings{DisplayMode::Window, Resolution{windowSize.x, windowSize.y}, false,
+                                           0};
+}
+
+class WindowHeadlessTest : public Test
+{
+public:
+    std::unique_ptr<WindowObservationHandlerMock> observationHandlerInit =
+        std::make_unique<StrictMock<WindowObservationHandlerMock>>();
+    WindowObservationHandlerMock* observationHandler = observationHandlerInit.get();
+    WindowHeadless window{windowSize, std::move(observationHandlerInit)};
+};
+
+TEST_F(WindowHeadlessTest, initialWindow_shouldBeOpenWithoutEvents)
+{
+    sf::Event event{};
+
+    ASSERT_TRUE(window.isOpen());
+    ASSERT_FALSE(window.pollEvent(event));
+    ASSERT_EQ(window.getWindowSettings(), initialWindowSettings);
+}
+
+TEST_F(WindowHeadlessTest, display_shouldCountDisplayedFrames)
+{
+    window.display();
+    window.display();
+
+    ASSERT_EQ(window.getNumberOfDisplayedFrames(), 2u);
+}
+
+TEST_F(WindowHeadlessTest, givenClosedEvent_shouldCloseWindow)
+{
+    sf::Event event{};
+    event.type = sf::Event::Closed;
+
+    window.handleEvent(event);
+
+    ASSERT_FALSE(window.isOpen());
+}
+
+TEST_F(WindowHeadlessTest, givenResizedEvent_shouldChangeResolutionAndNotifyObservers)
+{
+    sf::Event event{};
+    event.type = sf::Event::Resized;
+    event.size.width = windowSizeChanged.x;
+    event.size.height = windowSizeChanged.y;
+    EXPECT_CALL(*observationHandler, notifyObservers(windowSizeChanged));
+
+    window.handleEvent(event);
+
+    ASSERT_EQ(window.getWindowSettings().resolution, (Resolution{windowSizeChanged.x, windowSizeChanged.y}));
+}
+
+TEST_F(WindowHeadlessTest, shouldSetMousePosition)
+{
+    window.setMousePosition({4, 2});
+
+    ASSERT_EQ(window.getMousePosition(), (utils::Vector2f{4, 2}));
+}
+
+TEST_F(WindowHeadlessTest, givenDifferentResolution_shouldSetResolution)
+{
+    ASSERT_TRUE(window.setResolution(Resolution{640, 480}));
+    ASSERT_FALSE(window.setResolution(Resolution{640, 480}));
+}
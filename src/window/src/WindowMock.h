@@ -17,6 +17,7 @@ public:
     MOCK_METHOD(void, close, (), (override));
     MOCK_METHOD(void, setView, (const sf::View&), (override));
     MOCK_METHOD(bool, pollEvent, (sf::Event&), (const override));
+    MOCK_METHOD(void, handleEvent, (const sf::Event&), (override));
     MOCK_METHOD(utils::Vector2f, getMousePosition, (), (const override));
     MOCK_METHOD(void, registerObserver, (WindowObserver*), (override));
     MOCK_METHOD(void, removeObserver, (WindowObserver*), (override));
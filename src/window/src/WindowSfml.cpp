@@ -36,19 +36,11 @@ void WindowSfml::display()
 
 void WindowSfml::update()
 {
-    // TODO: sf::Event in update param
     sf::Event event{};
 
     while (window->pollEvent(event))
     {
-        if (event.type == sf::Event::Closed)
-        {
-            window->close();
-        }
-        if (event.type == sf::Event::Resized)
-        {
-            notifyObservers();
-        }
+        handleEvent(event);
     }
 }
 
@@ -67,6 +59,18 @@ bool WindowSfml::pollEvent(sf::Event& event) const
     return window->pollEvent(event);
 }
 
+void WindowSfml::handleEvent(const sf::Event& event)
+{
+    if (event.type == sf::Event::Closed)
+    {
+        window->close();
+    }
+    if (event.type == sf::Event::Resized)
+    {
+        notifyObservers();
+    }
+}
+
 utils::Vector2f WindowSfml::getMousePosition() const
 {
     sf::Vector2i windowCoordinates = sf::Mouse::getPosition(*window);
@@ -23,6 +23,7 @@ public:
     void close() override;
     void setView(const sf::View&) override;
     bool pollEvent(sf::Event& event) const override;
+    void handleEvent(const sf::Event& event) override;
     utils::Vector2f getMousePosition() const override;
     WindowSettings getWindowSettings() const override;
     bool setDisplayMode(DisplayMode) override;